@@ -17,6 +17,7 @@ flat in vec4 vLineColor;
 flat in vec2 vWorldSize;
 flat in float vLineWidth;
 flat in int vShape;
+uniform sampler2D uGlyphAtlas;
 
 layout(location = 0) out vec4 FragColor;
 
@@ -47,8 +48,38 @@ vec4 evalute_color(float sdf)
     return mix(fill_color,line_color,line_color.a);
 }
 
+// distance field glyph: atlas stores 128 + 127 * distance / spread, positive inside the glyph
+vec4 glyph_color(vec2 tex_coord, float outline_width, float glow_width)
+{
+    float signed_distance = (texture(uGlyphAtlas, tex_coord).r * 255.0 - 128.0) / 127.0;
+    float aa = max(fwidth(signed_distance) * 0.5, 0.001); // about one screen pixel at any scale
+
+    float fill_alpha = smoothstep(-aa, aa, signed_distance);
+    float line_alpha = outline_width > 0.0 ? smoothstep(-outline_width - aa, -outline_width + aa, signed_distance) : 0.0;
+    if (glow_width > 0.0)
+    {
+        float glow = clamp(1.0 + (signed_distance + outline_width) / glow_width, 0.0, 1.0);
+        line_alpha = max(line_alpha, glow * glow);
+    }
+
+    // fill over outline/glow
+    float fill_a = fill_alpha * vFillColor.a;
+    float line_a = line_alpha * vLineColor.a * (1.0 - fill_a);
+    float alpha = fill_a + line_a;
+    vec3 rgb = (vFillColor.rgb * fill_a + vLineColor.rgb * line_a) / max(alpha, 0.0001);
+    return vec4(rgb, alpha);
+}
+
 void main()
 {
+    if(vShape == 2){ // This pixel belongs to a Glyph, vTestPoint is its atlas coordinate
+        vec4 glyph = glyph_color(vTestPoint, vLineWidth, vWorldSize.x);
+        if(glyph.a <= 0.0)
+            discard;
+        FragColor = glyph;
+        return;
+    }
+
     float sdf = 0.0;
     
     // 3. Check 'vShape' (from vertex) instead of 'uShape' (uniform)
@@ -0,0 +1,18 @@
+#version 300 es
+precision mediump float;
+
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+// never runs, the update pass draws with GL_RASTERIZER_DISCARD. ES still needs a fragment stage to link.
+layout(location = 0) out vec4 FragColor;
+
+void main()
+{
+    FragColor = vec4(0.0);
+}
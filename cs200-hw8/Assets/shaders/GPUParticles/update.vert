@@ -0,0 +1,110 @@
+#version 300 es
+
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+// One vertex per particle slot, drawn as GL_POINTS with rasterizer discard.
+// Reads last frame's state and writes the next one through transform feedback.
+// The record layout (44 bytes) must match GPUParticleEmitter::State.
+
+//last state, same layout as the outputs
+layout(location = 0) in vec3 aCenterSize;
+layout(location = 1) in uint aTint;
+layout(location = 2) in vec2 aPosition;
+layout(location = 3) in vec2 aVelocity;
+layout(location = 4) in vec2 aLife; // remaining, total
+layout(location = 5) in vec4 aColor;
+
+//captured in this order, the first 16 bytes are what particle.vert reads as an instance
+out vec3 vCenterSize;
+flat out uint vTint;
+out vec2 vPosition;
+out vec2 vVelocity;
+out vec2 vLife;
+flat out uint vColor;
+
+const int MAX_EMITS = 8; // GPUParticleEmitter::MaxEmitsPerPass
+
+uniform int uEmitCount;
+uniform int uCapacity;
+uniform ivec2 uEmitRange[MAX_EMITS];     // first slot, slot count (wraps around uCapacity)
+uniform vec4 uEmitMotion[MAX_EMITS];     // emitter position.xy, emitter velocity.xy
+uniform vec4 uEmitDirection[MAX_EMITS];  // direction.xy, spread, unused
+uniform vec4 uEmitColor[MAX_EMITS];
+
+uniform float uMaxLife;
+uniform float uDeltaTime;
+uniform vec2 uGravity;
+uniform mat3 uCamera;
+uniform float uSize; // already scaled by the camera zoom
+uniform uint uSeed;
+
+uint hash(uint x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+float random01(uint x)
+{
+    return float(hash(x) >> 8) * (1.0 / 16777216.0);
+}
+
+void main()
+{
+    vec2 position = aPosition;
+    vec2 velocity = aVelocity;
+    vec2 life = aLife;
+    vec4 color = aColor;
+
+    //later emits win, same as the ring buffer overwrite in ParticleManager
+    bool spawned = false;
+    for (int i = 0; i < uEmitCount; ++i)
+    {
+        int offset = gl_VertexID - uEmitRange[i].x;
+        if (offset < 0)
+            offset += uCapacity;
+        if (offset < uEmitRange[i].y)
+        {
+            uint key = uSeed ^ (uint(gl_VertexID) * 0x9e3779b9u);
+            float angle = uEmitDirection[i].z * (random01(key) - 0.5);
+            vec2 magnitude = uEmitDirection[i].xy * mix(0.5, 1.0, random01(key ^ 0x68bc21ebu));
+            float c = cos(angle);
+            float s = sin(angle);
+            velocity = vec2(c * magnitude.x - s * magnitude.y, s * magnitude.x + c * magnitude.y) + uEmitMotion[i].zw;
+            position = uEmitMotion[i].xy;
+            life = vec2(uMaxLife);
+            color = uEmitColor[i];
+            spawned = true;
+        }
+    }
+
+    if (!spawned && life.x > 0.0)
+    {
+        velocity += uGravity * uDeltaTime;
+        position += velocity * uDeltaTime;
+        life.x -= uDeltaTime;
+    }
+
+    //dead slots keep their place with size 0, the quad collapses and produces no fragments
+    bool alive = life.x > 0.0;
+    vec3 screen = uCamera * vec3(position, 1.0);
+    float fade = life.y > 0.0 ? clamp(life.x / life.y, 0.0, 1.0) : 0.0;
+
+    vCenterSize = vec3(screen.xy, alive ? uSize : 0.0);
+    vTint = packUnorm4x8(vec4(color.rgb, color.a * fade));
+    vPosition = position;
+    vVelocity = velocity;
+    vLife = life;
+    vColor = packUnorm4x8(color);
+    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+}
@@ -18,6 +18,8 @@ uniform vec4 uLineColor;
 uniform vec2 uWorldSize;
 uniform float uLineWidth;
 uniform int uShape;
+uniform sampler2D uGlyphAtlas;
+in vec2 vTexCoord;
 
 float sdCircle( vec2 p, float r )
 {
@@ -42,8 +44,39 @@ vec4 evalute_color(float sdf)
     return mix(fill_color,line_color,line_color.a);
 }
 
+// distance field glyph: atlas stores 128 + 127 * distance / spread, positive inside the glyph
+vec4 glyph_color(vec2 tex_coord, float outline_width, float glow_width)
+{
+    float signed_distance = (texture(uGlyphAtlas, tex_coord).r * 255.0 - 128.0) / 127.0;
+    float aa = max(fwidth(signed_distance) * 0.5, 0.001); // about one screen pixel at any scale
+
+    float fill_alpha = smoothstep(-aa, aa, signed_distance);
+    float line_alpha = outline_width > 0.0 ? smoothstep(-outline_width - aa, -outline_width + aa, signed_distance) : 0.0;
+    if (glow_width > 0.0)
+    {
+        float glow = clamp(1.0 + (signed_distance + outline_width) / glow_width, 0.0, 1.0);
+        line_alpha = max(line_alpha, glow * glow);
+    }
+
+    // fill over outline/glow
+    float fill_a = fill_alpha * uFillColor.a;
+    float line_a = line_alpha * uLineColor.a * (1.0 - fill_a);
+    float alpha = fill_a + line_a;
+    vec3 rgb = (uFillColor.rgb * fill_a + uLineColor.rgb * line_a) / max(alpha, 0.0001);
+    return vec4(rgb, alpha);
+}
+
 void main()
 {
+    //glyphs read their distance from the atlas instead
+    if(uShape == 2){
+        vec4 glyph = glyph_color(vTexCoord, uLineWidth, uWorldSize.x);
+        if(glyph.a <= 0.0)
+            discard;
+        FragColor = glyph;
+        return;
+    }
+
     //based off shape evaluate the sdf
     float sdf = 0.0;
     if(uShape == 0){
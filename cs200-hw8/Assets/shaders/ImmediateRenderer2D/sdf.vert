@@ -18,10 +18,14 @@ uniform vec2 uSDFScale;
 
 out vec2 vTestPoint;
 
+uniform vec4 uTexCoordRect; // glyphs: atlas left, bottom, width, height
+out vec2 vTexCoord;
+
 uniform float uDepth;
 void main()
 {
     vec3 ndc_point = uToNDC * uModel * vec3(aVertexPosition,1.0);
     gl_Position = vec4(ndc_point.xy, uDepth, 1.0);
     vTestPoint = aVertexPosition * uSDFScale; //scale
+    vTexCoord = uTexCoordRect.xy + (aVertexPosition + 0.5) * uTexCoordRect.zw;
 }
@@ -0,0 +1,38 @@
+#version 300 es
+
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+//per vertex
+layout(location = 0) in vec2 aModelPosition;
+layout(location = 1) in vec2 aTexCoord;
+
+//per instance, 16 bytes: center + size, tint
+layout(location = 2) in vec3 aCenterSize;
+layout(location = 3) in vec4 aTint;
+
+out vec2 vTexCoord;
+flat out vec4 vTint;
+
+layout(std140) uniform NDC
+{
+    mat3 uToNDC;
+};
+
+//every particle of one DrawParticles call shares the texture region and depth
+uniform vec4 uTexCoordRect; // left, bottom, width, height
+uniform float uDepth;
+
+void main()
+{
+    vec2 world_position = aCenterSize.xy + aModelPosition * aCenterSize.z;
+    vec3 ndc_point = uToNDC * vec3(world_position, 1.0);
+    gl_Position = vec4(ndc_point.xy, uDepth, 1.0);
+    vTexCoord = uTexCoordRect.xy + aTexCoord * uTexCoordRect.zw;
+    vTint = aTint;
+}
@@ -21,6 +21,7 @@ layout(location = 5) in vec2 aWorldSize;
 layout(location = 6) in float aLineWidth;
 layout(location = 7) in int aShape;
 layout(location = 8) in float aDepth;
+layout(location = 9) in vec4 aTexCoordRect; // glyphs: atlas left, bottom, width, height
 
 
 layout(std140) uniform NDC
@@ -35,6 +36,7 @@ flat out vec4 vLineColor;
 flat out vec2 vWorldSize;
 flat out float vLineWidth;
 flat out int vShape;
+out vec2 vTexCoord;
 
 void main()
 {
@@ -54,4 +56,5 @@ void main()
     vWorldSize = aWorldSize;
     vLineWidth = aLineWidth;
     vShape = aShape;
+    vTexCoord = aTexCoordRect.xy + (aModelPosition + 0.5) * aTexCoordRect.zw;
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ *
+ * Small helpers shared by the benchmark executables.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace bench
+{
+	/**
+	 * mt19937 output is specified by the standard, but the distributions are not, so the
+	 * conversion to [min,max) is done by hand to keep the scenes identical across toolchains.
+	 */
+	class SeededRandom
+	{
+	public:
+		explicit SeededRandom(std::uint32_t seed) : engine(seed)
+		{
+		}
+
+		double Next(double min, double max)
+		{
+			const double unit = static_cast<double>(engine() >> 8) * (1.0 / 16777216.0);
+			return min + (max - min) * unit;
+		}
+
+		int Next(int min, int max) // inclusive
+		{
+			const auto range = static_cast<std::uint32_t>(max - min) + 1u;
+			return min + static_cast<int>(engine() % range);
+		}
+
+	private:
+		std::mt19937 engine;
+	};
+
+	using clock = std::chrono::steady_clock;
+
+	inline double elapsed_ns(clock::time_point start, clock::time_point end)
+	{
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+	}
+
+	inline double percentile(std::vector<double> values, double p)
+	{
+		if (values.empty())
+			return 0.0;
+		std::sort(values.begin(), values.end());
+		const auto index = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+		return values[std::min(index, values.size() - 1)];
+	}
+
+	inline double mean(const std::vector<double>& values)
+	{
+		double sum = 0;
+		for (const double value : values)
+			sum += value;
+		return values.empty() ? 0.0 : sum / static_cast<double>(values.size());
+	}
+}
@@ -0,0 +1,909 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ *
+ * CPU side engine benchmarks (no window, no GL context).
+ *
+ * Results are printed as JSON, one entry per (benchmark, object count) pair, so the numbers
+ * can be tracked between commits next to the renderer_bench output.
+ */
+#include "BenchCommon.h"
+#include "Engine/AABBTree.h"
+#include "Engine/Affine2D.h"
+#include "Engine/Animation.h"
+#include "Engine/BakedAsset.h"
+#include "Engine/ComponentManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameObject.h"
+#include "Engine/GameObjectManager.h"
+#include "Engine/JobSystem.h"
+#include "Engine/MappedFile.h"
+#include "Engine/Matrix.h"
+#include "Engine/Narrowphase.h"
+#include "Engine/ParticleEmitter.h"
+#include "Engine/SpatialGrid.h"
+#include "Engine/SpriteDefinition.h"
+#include "Engine/TransformStore.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	struct Options
+	{
+		int				 frames			= 120;
+		std::vector<int> counts			= { 1'000, 10'000, 100'000 };
+		int				 baseline_limit = 20'000; // the std::list baseline is O(n*k) per frame, keep it to sizes that finish
+		int				 asset_files	= 2'000;  // .spt + .anm pairs written to a temp folder for the load benchmarks
+		unsigned		 workers		= CS230::JobSystem::DefaultWorkerCount();
+		std::uint32_t	 seed			= 0x5EED2025u;
+		std::string		 out{};
+	};
+
+	/** Minimal particle: moves, ages and destroys itself. No sprite so only the object store is measured. */
+	class BenchParticle : public CS230::GameObject
+	{
+	public:
+		BenchParticle(Math::vec2 start_position, Math::vec2 start_velocity, double life_time) : GameObject(start_position), life(life_time)
+		{
+			SetVelocity(start_velocity);
+		}
+
+		GameObjectTypes Type() override
+		{
+			return GameObjectTypes::Particle;
+		}
+
+		std::string TypeName() override
+		{
+			return "Bench Particle";
+		}
+
+		bool IsThreadSafeUpdate() const override
+		{
+			return true;
+		}
+
+		void Update(double dt) override
+		{
+			GameObject::Update(dt);
+			life -= dt;
+			if (life <= 0)
+			{
+				Destroy();
+			}
+		}
+
+	private:
+		double life;
+	};
+
+	BenchParticle* spawn(bench::SeededRandom& random)
+	{
+		return new BenchParticle({ random.Next(0.0, 1280.0), random.Next(0.0, 720.0) }, { random.Next(-100.0, 100.0), random.Next(-100.0, 100.0) }, random.Next(0.1, 1.5));
+	}
+
+	struct Result
+	{
+		std::string_view	name;
+		int					count = 0;
+		std::vector<double> frame_ns{};
+	};
+
+	/** The removal strategy GameObjectManager used before the slot map, kept here as a reference point. */
+	Result run_list_baseline(const Options& options, int count)
+	{
+		constexpr double			  dt = 1.0 / 60.0;
+		bench::SeededRandom			  random(options.seed);
+		std::list<CS230::GameObject*> objects;
+		for (int i = 0; i < count; ++i)
+			objects.push_back(spawn(random));
+
+		Result result{ "spawn_die_list_baseline", count };
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto						start = bench::clock::now();
+			std::vector<CS230::GameObject*> destroyed;
+			for (CS230::GameObject* object : objects)
+			{
+				object->Update(dt);
+				if (object->Destroyed())
+					destroyed.push_back(object);
+			}
+			for (CS230::GameObject* object : destroyed)
+			{
+				objects.remove(object);
+				delete object;
+			}
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+
+			for (size_t i = objects.size(); i < static_cast<size_t>(count); ++i)
+				objects.push_back(spawn(random));
+		}
+		for (CS230::GameObject* object : objects)
+			delete object;
+		return result;
+	}
+
+	Result run_slot_map(const Options& options, int count, std::string_view name = "spawn_die_slot_map")
+	{
+		constexpr double		 dt = 1.0 / 60.0;
+		bench::SeededRandom		 random(options.seed);
+		CS230::GameObjectManager manager;
+		for (int i = 0; i < count; ++i)
+			manager.Add(spawn(random));
+
+		Result result{ name, count };
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto start = bench::clock::now();
+			manager.UpdateAll(dt);
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+
+			for (size_t i = manager.Count(); i < static_cast<size_t>(count); ++i)
+				manager.Add(spawn(random));
+		}
+		manager.Unload();
+		return result;
+	}
+
+	/** 100k moving sprites: every position changes every frame, rotation/scale stay put. Only the affine rebuild is timed. */
+	Result run_transform_store(const Options& options, int count)
+	{
+		bench::SeededRandom					   random(options.seed);
+		CS230::TransformStore				   store;
+		std::vector<CS230::TransformStore::Id> ids;
+		std::vector<Math::vec2>				   positions;
+		for (int i = 0; i < count; ++i)
+		{
+			positions.push_back({ random.Next(0.0, 1280.0), random.Next(0.0, 720.0) });
+			ids.push_back(store.Create(positions.back(), random.Next(0.0, 6.28), { random.Next(8.0, 64.0), random.Next(8.0, 64.0) }));
+		}
+
+		Result result{ "transform_store_update", count };
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			for (size_t i = 0; i < ids.size(); ++i)
+			{
+				positions[i] += Math::vec2{ 1.0, 0.5 };
+				store.SetPosition(ids[i], positions[i]);
+			}
+			const auto start = bench::clock::now();
+			store.Flush();
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		return result;
+	}
+
+	/** What GameObject::GetMatrix used to do for every moved object: three double 3x3 multiplies. */
+	Result run_transform_matrix_baseline(const Options& options, int count)
+	{
+		bench::SeededRandom						random(options.seed);
+		std::vector<Math::vec2>					positions, scales;
+		std::vector<double>						rotations;
+		std::vector<Math::TransformationMatrix> matrices(static_cast<size_t>(count));
+		for (int i = 0; i < count; ++i)
+		{
+			positions.push_back({ random.Next(0.0, 1280.0), random.Next(0.0, 720.0) });
+			rotations.push_back(random.Next(0.0, 6.28));
+			scales.push_back({ random.Next(8.0, 64.0), random.Next(8.0, 64.0) });
+		}
+
+		Result result{ "transform_matrix_baseline", count };
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			for (auto& position : positions)
+				position += Math::vec2{ 1.0, 0.5 };
+			const auto start = bench::clock::now();
+			for (size_t i = 0; i < matrices.size(); ++i)
+				matrices[i] = Math::TranslationMatrix(positions[i]) * Math::RotationMatrix(rotations[i]) * Math::ScaleMatrix(scales[i]);
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		return result;
+	}
+
+	/** Five components per object, the looked up one added last so the old scan walks the whole list. */
+	volatile long long result_sink = 0; // keeps the measured loops from being optimized away
+
+	template <int N>
+	class BenchComponent : public CS230::Component
+	{
+	public:
+		int value = N;
+	};
+
+	using FirstComponent	= BenchComponent<0>;
+	using LookedUpComponent = BenchComponent<4>;
+
+	void add_bench_components(auto&& add)
+	{
+		add(new BenchComponent<0>());
+		add(new BenchComponent<1>());
+		add(new BenchComponent<2>());
+		add(new BenchComponent<3>());
+		add(new BenchComponent<4>());
+	}
+
+	Result run_component_lookup(const Options& options, int count)
+	{
+		std::vector<CS230::ComponentManager> managers(static_cast<size_t>(count));
+		for (CS230::ComponentManager& manager : managers)
+			add_bench_components([&manager](auto* component) { manager.AddComponent(component); });
+
+		Result	  result{ "component_lookup_table", count };
+		long long sink = 0;
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto start = bench::clock::now();
+			for (CS230::ComponentManager& manager : managers)
+				sink += manager.GetComponent<LookedUpComponent>()->value + manager.GetComponent<FirstComponent>()->value;
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = sink;
+		return result;
+	}
+
+	/** The dynamic_cast scan ComponentManager::GetComponent used before the type table. */
+	Result run_component_lookup_baseline(const Options& options, int count)
+	{
+		std::vector<std::vector<CS230::Component*>> lists(static_cast<size_t>(count));
+		for (std::vector<CS230::Component*>& list : lists)
+			add_bench_components([&list](CS230::Component* component) { list.push_back(component); });
+
+		const auto find = []<typename T>(const std::vector<CS230::Component*>& list, T*) -> T*
+		{
+			for (CS230::Component* component : list)
+			{
+				if (T* found = dynamic_cast<T*>(component))
+					return found;
+			}
+			return nullptr;
+		};
+
+		Result	  result{ "component_lookup_dynamic_cast", count };
+		long long sink = 0;
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto start = bench::clock::now();
+			for (const std::vector<CS230::Component*>& list : lists)
+				sink += find(list, static_cast<LookedUpComponent*>(nullptr))->value + find(list, static_cast<FirstComponent*>(nullptr))->value;
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = sink;
+		for (std::vector<CS230::Component*>& list : lists)
+		{
+			for (CS230::Component* component : list)
+				delete component;
+		}
+		return result;
+	}
+
+	/** Sprites under 64 parent groups drawn through a camera: camera * parent * TRS per object, float affine or double 3x3. */
+	Result run_transform_compose(const Options& options, int count, bool affine)
+	{
+		bench::SeededRandom		random(options.seed);
+		std::vector<Math::vec2> positions, scales;
+		std::vector<double>		rotations;
+		for (int i = 0; i < count; ++i)
+		{
+			positions.push_back({ random.Next(0.0, 1280.0), random.Next(0.0, 720.0) });
+			rotations.push_back(random.Next(0.0, 6.28));
+			scales.push_back({ random.Next(8.0, 64.0), random.Next(8.0, 64.0) });
+		}
+		std::vector<Math::TransformationMatrix> parents;
+		for (int i = 0; i < 64; ++i)
+			parents.push_back(Math::TranslationMatrix(Math::vec2{ random.Next(-200.0, 200.0), random.Next(-200.0, 200.0) }) * Math::RotationMatrix(random.Next(0.0, 6.28)));
+		const Math::TransformationMatrix camera = Math::ScaleMatrix(Math::vec2{ 2.0 / 1280.0, 2.0 / 720.0 }) * Math::TranslationMatrix(Math::vec2{ -640.0, -360.0 });
+
+		Result result{ affine ? "transform_compose_affine" : "transform_compose_matrix", count };
+		if (affine)
+		{
+			std::vector<Math::Affine2D> affine_parents;
+			for (const auto& parent : parents)
+				affine_parents.emplace_back(parent);
+			const Math::Affine2D		camera_affine(camera);
+			std::vector<Math::Affine2D> out(static_cast<size_t>(count));
+			for (int frame = 0; frame < options.frames; ++frame)
+			{
+				for (auto& position : positions)
+					position += Math::vec2{ 1.0, 0.5 };
+				const auto start = bench::clock::now();
+				for (size_t i = 0; i < out.size(); ++i)
+					out[i] = camera_affine * affine_parents[i % 64] * Math::Affine2D::FromTRS(positions[i], rotations[i], scales[i]);
+				result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+			}
+			result_sink = static_cast<long long>(out.back()[0][2]);
+		}
+		else
+		{
+			std::vector<Math::TransformationMatrix> out(static_cast<size_t>(count));
+			for (int frame = 0; frame < options.frames; ++frame)
+			{
+				for (auto& position : positions)
+					position += Math::vec2{ 1.0, 0.5 };
+				const auto start = bench::clock::now();
+				for (size_t i = 0; i < out.size(); ++i)
+					out[i] = camera * parents[i % 64] * Math::TranslationMatrix(positions[i]) * Math::RotationMatrix(rotations[i]) * Math::ScaleMatrix(scales[i]);
+				result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+			}
+			result_sink = static_cast<long long>(out.back()[0][2]);
+		}
+		return result;
+	}
+
+	/** The four quad corners of every object taken to world space, what BatchRenderer2D does per DrawQuad. */
+	Result run_transform_points(const Options& options, int count, bool affine)
+	{
+		bench::SeededRandom random(options.seed);
+		std::vector<Math::TransformationMatrix> matrices;
+		for (int i = 0; i < count; ++i)
+			matrices.push_back(
+				Math::TranslationMatrix(Math::vec2{ random.Next(0.0, 1280.0), random.Next(0.0, 720.0) }) * Math::RotationMatrix(random.Next(0.0, 6.28)) *
+				Math::ScaleMatrix(Math::vec2{ random.Next(8.0, 64.0), random.Next(8.0, 64.0) }));
+
+		Result result{ affine ? "transform_points_affine" : "transform_points_matrix", count };
+		double sink = 0.0;
+		if (affine)
+		{
+			std::vector<Math::Affine2D> affines;
+			for (const auto& matrix : matrices)
+				affines.emplace_back(matrix);
+			constexpr Math::fvec2 corners[4] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { -0.5f, 0.5f }, { 0.5f, 0.5f } };
+			Math::fvec2			  world[4];
+			for (int frame = 0; frame < options.frames; ++frame)
+			{
+				const auto start = bench::clock::now();
+				for (const Math::Affine2D& transform : affines)
+				{
+					transform.TransformPoints(corners, world);
+					sink += static_cast<double>(world[0].x + world[3].y);
+				}
+				result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+			}
+		}
+		else
+		{
+			constexpr Math::vec2 corners[4] = { { -0.5, -0.5 }, { 0.5, -0.5 }, { -0.5, 0.5 }, { 0.5, 0.5 } };
+			Math::vec2			 world[4];
+			for (int frame = 0; frame < options.frames; ++frame)
+			{
+				const auto start = bench::clock::now();
+				for (const Math::TransformationMatrix& transform : matrices)
+				{
+					for (int c = 0; c < 4; ++c)
+						world[c] = transform * corners[c];
+					sink += world[0].x + world[3].y;
+				}
+				result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+			}
+		}
+		result_sink = static_cast<long long>(sink);
+		return result;
+	}
+
+	/** Boxes of 8-48 units drifting over a 4k x 2k world, bounds rebuilt every frame like CollisionTest does. */
+	std::vector<Math::rect> make_boxes(bench::SeededRandom& random, int count)
+	{
+		std::vector<Math::rect> boxes;
+		for (int i = 0; i < count; ++i)
+		{
+			const Math::vec2 corner{ random.Next(0.0, 4096.0), random.Next(0.0, 2048.0) };
+			boxes.push_back({ corner, corner + Math::vec2{ random.Next(8.0, 48.0), random.Next(8.0, 48.0) } });
+		}
+		return boxes;
+	}
+
+	void drift(std::vector<Math::rect>& boxes, int frame)
+	{
+		const Math::vec2 step{ (frame % 2 == 0) ? 1.5 : -1.0, 0.75 };
+		for (Math::rect& box : boxes)
+		{
+			box.point_1 += step;
+			box.point_2 += step;
+		}
+	}
+
+	Result run_broadphase(const Options& options, int count)
+	{
+		bench::SeededRandom		random(options.seed);
+		std::vector<Math::rect> boxes = make_boxes(random, count);
+		CS230::SpatialGrid		grid;
+
+		Result result{ "collision_broadphase_grid", count };
+		size_t pair_count = 0;
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			drift(boxes, frame);
+			const auto start = bench::clock::now();
+			grid.Build(boxes);
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+			pair_count += grid.Pairs().size();
+		}
+		result_sink = static_cast<long long>(pair_count);
+		return result;
+	}
+
+	/** The all pairs loop CollisionTest used before the grid, bounds test only. */
+	Result run_broadphase_baseline(const Options& options, int count)
+	{
+		bench::SeededRandom		random(options.seed);
+		std::vector<Math::rect> boxes = make_boxes(random, count);
+
+		Result result{ "collision_all_pairs_baseline", count };
+		size_t pair_count = 0;
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			drift(boxes, frame);
+			const auto start = bench::clock::now();
+			for (size_t i = 0; i < boxes.size(); ++i)
+			{
+				for (size_t j = i + 1; j < boxes.size(); ++j)
+				{
+					const Math::rect& a = boxes[i];
+					const Math::rect& b = boxes[j];
+					if (a.Left() <= b.Right() && b.Left() <= a.Right() && a.Bottom() <= b.Top() && b.Bottom() <= a.Top())
+						++pair_count;
+				}
+			}
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = static_cast<long long>(pair_count);
+		return result;
+	}
+
+	constexpr int PointQueriesPerFrame = 1'000;
+
+	/** Mouse picking style point queries; the boxes move first so the timed part also sees the tree after MoveProxy. */
+	Result run_tree_point_query(const Options& options, int count)
+	{
+		bench::SeededRandom					  random(options.seed);
+		std::vector<Math::rect>				  boxes = make_boxes(random, count);
+		CS230::AABBTree						  tree;
+		std::vector<CS230::AABBTree::ProxyId> proxies;
+		for (size_t i = 0; i < boxes.size(); ++i)
+			proxies.push_back(tree.CreateProxy(boxes[i], static_cast<uint32_t>(i)));
+
+		Result result{ "aabb_tree_point_query", count };
+		size_t hits = 0;
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			drift(boxes, frame);
+			for (size_t i = 0; i < boxes.size(); ++i)
+				tree.MoveProxy(proxies[i], boxes[i], { 1.5, 0.75 });
+
+			const auto start = bench::clock::now();
+			for (int query = 0; query < PointQueriesPerFrame; ++query)
+			{
+				const Math::vec2 point{ random.Next(0.0, 4096.0), random.Next(0.0, 2048.0) };
+				tree.QueryPoint(point, [&](CS230::AABBTree::ProxyId proxy)
+				{
+					const Math::rect& box = boxes[tree.GetUserData(proxy)];
+					hits += (box.Left() <= point.x && point.x <= box.Right() && box.Bottom() <= point.y && point.y <= box.Top()) ? 1u : 0u;
+					return true;
+				});
+			}
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = static_cast<long long>(hits);
+		return result;
+	}
+
+	/** What IsCollidingWith(point) over every object costs for the same queries. */
+	Result run_linear_point_query(const Options& options, int count)
+	{
+		bench::SeededRandom		random(options.seed);
+		std::vector<Math::rect> boxes = make_boxes(random, count);
+
+		Result result{ "linear_point_query_baseline", count };
+		size_t hits = 0;
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			drift(boxes, frame);
+			const auto start = bench::clock::now();
+			for (int query = 0; query < PointQueriesPerFrame; ++query)
+			{
+				const Math::vec2 point{ random.Next(0.0, 4096.0), random.Next(0.0, 2048.0) };
+				for (const Math::rect& box : boxes)
+					hits += (box.Left() <= point.x && point.x <= box.Right() && box.Bottom() <= point.y && point.y <= box.Top()) ? 1u : 0u;
+			}
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = static_cast<long long>(hits);
+		return result;
+	}
+
+	/** Mixed boxes (rotated) and circles packed close enough that roughly half the pairs touch. */
+	std::vector<std::pair<CS230::WorldShape, CS230::WorldShape>> make_shape_pairs(bench::SeededRandom& random, int count)
+	{
+		const auto make = [&random]()
+		{
+			CS230::WorldShape shape;
+			shape.center = { random.Next(0.0, 64.0), random.Next(0.0, 64.0) };
+			if (random.Next(0.0, 1.0) < 0.5)
+			{
+				const double angle = random.Next(0.0, 6.28);
+				shape.type		   = CS230::WorldShape::Type::Box;
+				shape.axis		   = { std::cos(angle), std::sin(angle) };
+				shape.half_extents = { random.Next(4.0, 24.0), random.Next(4.0, 24.0) };
+			}
+			else
+			{
+				shape.type	 = CS230::WorldShape::Type::Circle;
+				shape.radius = random.Next(4.0, 24.0);
+			}
+			return shape;
+		};
+		std::vector<std::pair<CS230::WorldShape, CS230::WorldShape>> pairs;
+		for (int i = 0; i < count; ++i)
+		{
+			CS230::WorldShape a = make();
+			pairs.push_back({ a, make() });
+		}
+		return pairs;
+	}
+
+	Result run_narrowphase(const Options& options, int count, bool batched)
+	{
+		bench::SeededRandom random(options.seed);
+		const auto			pairs = make_shape_pairs(random, count);
+		CS230::Narrowphase	narrowphase;
+
+		Result result{ batched ? "narrowphase_batched" : "narrowphase_single_pair", count };
+		size_t touching = 0;
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto start = bench::clock::now();
+			if (batched)
+			{
+				narrowphase.Clear();
+				for (const auto& [a, b] : pairs)
+					narrowphase.Add(a, b);
+				narrowphase.Run();
+				for (const CS230::Contact& contact : narrowphase.Contacts())
+					touching += contact.IsTouching() ? 1u : 0u;
+			}
+			else
+			{
+				for (const auto& [a, b] : pairs)
+					touching += CS230::Narrowphase::Test(a, b).IsTouching() ? 1u : 0u;
+			}
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = static_cast<long long>(touching);
+		return result;
+	}
+
+	/** Emitter simulation only (no texture, nothing drawn): particles live for the whole run so the count stays put. */
+	Result run_particle_emitter(const Options& options, int count)
+	{
+		CS230::ParticleEmitter emitter(nullptr, static_cast<size_t>(count), 1'000.0, 4.0);
+		emitter.SetGravity({ 0.0, -98.0 });
+		emitter.Emit(static_cast<size_t>(count), { 640.0, 360.0 }, { 0.0, 0.0 }, { 0.0, 200.0 }, 3.14);
+
+		Result result{ Engine::GetJobSystem().WorkerCount() > 0 ? "particle_emitter_update_parallel" : "particle_emitter_update", count };
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto start = bench::clock::now();
+			emitter.Update(1.0 / 60.0);
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = static_cast<long long>(emitter.Count());
+		return result;
+	}
+
+	/** Walk cycle shape: eight frames of slightly different length, then Loop back to the start. */
+	CS230::AnimationData make_walk_animation()
+	{
+		std::vector<CS230::AnimationFrame> frames;
+		for (uint32_t i = 0; i < 8; ++i)
+			frames.push_back({ i, 0.08f + 0.01f * static_cast<float>(i % 3), (i + 1) % 8 });
+		return CS230::AnimationData(std::move(frames));
+	}
+
+	Result run_animation_advance_all(const Options& options, int count)
+	{
+		bench::SeededRandom				   random(options.seed);
+		const CS230::AnimationData		   walk = make_walk_animation();
+		CS230::AnimationPlayer			   player;
+		std::vector<CS230::AnimationPlayer::Id> ids;
+		for (int i = 0; i < count; ++i)
+		{
+			ids.push_back(player.Create());
+			player.Play(ids.back(), walk);
+			// sprites start at different times so frame changes are spread over the frames
+			if (i % 64 == 0)
+				player.AdvanceAll(random.Next(0.0, 0.1));
+		}
+
+		Result result{ "animation_advance_all", count };
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto start = bench::clock::now();
+			player.AdvanceAll(1.0 / 60.0);
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = static_cast<long long>(player.CurrentFrame(ids.front()));
+		return result;
+	}
+
+	/** The old per-Sprite Animation: heap allocated polymorphic commands, one virtual walk per sprite. */
+	class BaselineAnimation
+	{
+	public:
+		struct Command
+		{
+			virtual ~Command()		 = default;
+			virtual int Type() const = 0; // 0 PlayFrame, 1 Loop
+		};
+
+		struct PlayFrame : Command
+		{
+			PlayFrame(size_t frame_index, double duration) : frame(frame_index), target_time(duration) {}
+			int	   Type() const override { return 0; }
+			size_t frame;
+			double target_time;
+			double timer = 0.0;
+		};
+
+		struct Loop : Command
+		{
+			explicit Loop(size_t index) : loop_index(index) {}
+			int	   Type() const override { return 1; }
+			size_t loop_index;
+		};
+
+		BaselineAnimation()
+		{
+			for (size_t i = 0; i < 8; ++i)
+				commands.push_back(std::make_unique<PlayFrame>(i, 0.08 + 0.01 * static_cast<double>(i % 3)));
+			commands.push_back(std::make_unique<Loop>(0));
+			current_frame = static_cast<PlayFrame*>(commands.front().get());
+		}
+
+		void Update(double dt)
+		{
+			current_frame->timer += dt;
+			if (current_frame->timer < current_frame->target_time)
+				return;
+			current_frame->timer = 0.0;
+			++current_command;
+			if (commands[current_command]->Type() == 1)
+				current_command = static_cast<Loop*>(commands[current_command].get())->loop_index;
+			current_frame = static_cast<PlayFrame*>(commands[current_command].get());
+		}
+
+		size_t CurrentFrame() const { return current_frame->frame; }
+
+	private:
+		std::vector<std::unique_ptr<Command>> commands;
+		size_t								  current_command = 0;
+		PlayFrame*							  current_frame	  = nullptr;
+	};
+
+	Result run_animation_virtual_baseline(const Options& options, int count)
+	{
+		bench::SeededRandom							 random(options.seed);
+		std::vector<std::unique_ptr<BaselineAnimation>> animations;
+		for (int i = 0; i < count; ++i)
+		{
+			animations.push_back(std::make_unique<BaselineAnimation>());
+			for (int steps = static_cast<int>(random.Next(0.0, 8.0)); steps > 0; --steps)
+				animations.back()->Update(1.0);
+		}
+
+		Result result{ "animation_virtual_baseline", count };
+		for (int frame = 0; frame < options.frames; ++frame)
+		{
+			const auto start = bench::clock::now();
+			for (const auto& animation : animations)
+				animation->Update(1.0 / 60.0);
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+		}
+		result_sink = static_cast<long long>(animations.front()->CurrentFrame());
+		return result;
+	}
+
+	/** A fake asset set on disk: every sprite has its own walk animation, each source file next to its baked version. */
+	struct AssetSet
+	{
+		explicit AssetSet(int file_count) : folder(std::filesystem::temp_directory_path() / "engine_bench_assets")
+		{
+			std::filesystem::create_directories(folder);
+			for (int i = 0; i < file_count; ++i)
+			{
+				const std::filesystem::path animation_path = folder / ("walk_" + std::to_string(i) + ".anm");
+				const std::filesystem::path sprite_path	   = folder / ("unit_" + std::to_string(i) + ".spt");
+				{
+					std::ofstream animation(animation_path);
+					for (int frame = 0; frame < 8; ++frame)
+						animation << "PlayFrame " << frame << ' ' << 0.08 + 0.01 * (frame % 3) << '\n';
+					animation << "Loop 0\n";
+					std::ofstream sprite(sprite_path);
+					sprite << "Assets/images/unit.png\nFrameSize 64 64\nNumFrames 8\nHotSpot 32 0\nHotSpot 32 48\nAnim " << animation_path.generic_string()
+						   << "\nRectCollision 8 0 56 60\n";
+				}
+				write(CS230::baked::BakedPathFor(animation_path), CS230::baked::WriteAnimation(CS230::AnimationData(animation_path).Frames()));
+				write(CS230::baked::BakedPathFor(sprite_path), CS230::baked::WriteSprite(CS230::SpriteSource::ParseText(sprite_path, texture_size)));
+				animations.push_back(animation_path);
+				sprites.push_back(sprite_path);
+			}
+		}
+
+		~AssetSet()
+		{
+			std::error_code ignored;
+			std::filesystem::remove_all(folder, ignored);
+		}
+
+		static Math::ivec2 texture_size(const std::string&)
+		{
+			return { 512, 64 };
+		}
+
+		static void write(const std::filesystem::path& path, const std::vector<std::byte>& bytes)
+		{
+			std::ofstream file(path, std::ios::binary);
+			file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		}
+
+		std::filesystem::path			   folder;
+		std::vector<std::filesystem::path> animations;
+		std::vector<std::filesystem::path> sprites;
+	};
+
+	/** Loads every sprite and animation of the set once per frame, through the text parsers or the baked files. */
+	Result run_asset_load(const Options& options, const AssetSet& assets, bool baked)
+	{
+		const int file_count = static_cast<int>(assets.sprites.size() + assets.animations.size());
+		Result	  result{ baked ? "asset_load_baked" : "asset_load_text", file_count };
+		// every frame touches the whole set, a handful of repetitions is enough
+		for (int frame = 0; frame < std::min(options.frames, 20); ++frame)
+		{
+			size_t	   frames_loaded = 0;
+			const auto start		 = bench::clock::now();
+			for (size_t i = 0; i < assets.sprites.size(); ++i)
+			{
+				if (baked)
+				{
+					const auto sprite_file	  = CS230::MappedFile::Open(CS230::baked::BakedPathFor(assets.sprites[i]));
+					const auto sprite		  = CS230::baked::ReadSprite(sprite_file->Bytes());
+					auto	   animation_file = CS230::MappedFile::Open(CS230::baked::BakedPathFor(assets.animations[i]));
+					const auto frames		  = CS230::baked::ReadAnimation(animation_file->Bytes());
+					const CS230::AnimationData animation(frames, std::move(animation_file));
+					frames_loaded += sprite->frame_texels.size() + animation.Frames().size();
+				}
+				else
+				{
+					const auto				   sprite = CS230::SpriteSource::ParseText(assets.sprites[i], AssetSet::texture_size);
+					const CS230::AnimationData animation(assets.animations[i]);
+					frames_loaded += sprite.frame_texels.size() + animation.Frames().size();
+				}
+			}
+			result.frame_ns.push_back(bench::elapsed_ns(start, bench::clock::now()));
+			result_sink = static_cast<long long>(frames_loaded);
+		}
+		return result;
+	}
+
+	void write_result(std::ostream& json, const Result& result, bool last)
+	{
+		using bench::percentile;
+		json << "    {\"bench\": \"" << result.name << "\", \"count\": " << result.count << ", \"ns_per_object\": " << bench::mean(result.frame_ns) / static_cast<double>(result.count)
+			 << ", \"frame_us\": {\"p50\": " << percentile(result.frame_ns, 0.50) / 1000.0 << ", \"p90\": " << percentile(result.frame_ns, 0.90) / 1000.0
+			 << ", \"p99\": " << percentile(result.frame_ns, 0.99) / 1000.0 << "}}" << (last ? "\n" : ",\n");
+	}
+
+	Options parse_options(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg		 = argv[i];
+			const bool			   has_value = i + 1 < argc;
+			if (arg == "--frames" && has_value)
+				options.frames = std::max(1, std::atoi(argv[++i]));
+			else if (arg == "--count" && has_value)
+				options.counts = { std::max(1, std::atoi(argv[++i])) };
+			else if (arg == "--baseline-limit" && has_value)
+				options.baseline_limit = std::atoi(argv[++i]);
+			else if (arg == "--assets" && has_value)
+				options.asset_files = std::max(1, std::atoi(argv[++i]));
+			else if (arg == "--workers" && has_value)
+				options.workers = static_cast<unsigned>(std::max(0, std::atoi(argv[++i])));
+			else if (arg == "--seed" && has_value)
+				options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 0));
+			else if (arg == "--out" && has_value)
+				options.out = argv[++i];
+			else
+			{
+				std::cerr << "usage: engine_bench [--frames N] [--count N] [--baseline-limit N] [--assets N] [--workers N] [--seed S] [--out file.json]\n";
+				std::exit(-1);
+			}
+		}
+		return options;
+	}
+}
+
+int main(int argc, char** argv)
+try
+{
+	const Options options = parse_options(argc, argv);
+
+	std::vector<Result> results;
+	for (const int count : options.counts)
+	{
+		// job system is not started yet, so this is the single threaded number
+		results.push_back(run_slot_map(options, count));
+		if (options.workers > 0)
+		{
+			Engine::GetJobSystem().Start(options.workers);
+			results.push_back(run_slot_map(options, count, "spawn_die_slot_map_parallel"));
+			Engine::GetJobSystem().Stop();
+		}
+		if (count <= options.baseline_limit)
+			results.push_back(run_list_baseline(options, count));
+		results.push_back(run_transform_store(options, count));
+		results.push_back(run_transform_matrix_baseline(options, count));
+		results.push_back(run_transform_compose(options, count, true));
+		results.push_back(run_transform_compose(options, count, false));
+		results.push_back(run_transform_points(options, count, true));
+		results.push_back(run_transform_points(options, count, false));
+		results.push_back(run_component_lookup(options, count));
+		results.push_back(run_component_lookup_baseline(options, count));
+		results.push_back(run_broadphase(options, count));
+		if (count <= options.baseline_limit)
+			results.push_back(run_broadphase_baseline(options, count));
+		results.push_back(run_tree_point_query(options, count));
+		results.push_back(run_narrowphase(options, count, true));
+		results.push_back(run_narrowphase(options, count, false));
+		results.push_back(run_animation_advance_all(options, count));
+		if (count <= options.baseline_limit)
+			results.push_back(run_animation_virtual_baseline(options, count));
+		results.push_back(run_particle_emitter(options, count));
+		if (options.workers > 0)
+		{
+			Engine::GetJobSystem().Start(options.workers);
+			results.push_back(run_particle_emitter(options, count));
+			Engine::GetJobSystem().Stop();
+		}
+		if (count <= options.baseline_limit)
+			results.push_back(run_linear_point_query(options, count));
+	}
+	{
+		const AssetSet assets(options.asset_files);
+		results.push_back(run_asset_load(options, assets, false));
+		results.push_back(run_asset_load(options, assets, true));
+	}
+
+	std::ostringstream json;
+	json << "{\n  \"seed\": " << options.seed << ", \"frames\": " << options.frames << ", \"workers\": " << options.workers << ",\n  \"results\": [\n";
+	for (size_t i = 0; i < results.size(); ++i)
+		write_result(json, results[i], i + 1 == results.size());
+	json << "  ]\n}\n";
+
+	std::cout << json.str();
+	if (!options.out.empty())
+	{
+		std::ofstream file(options.out);
+		file << json.str();
+	}
+	return 0;
+}
+catch (const std::exception& e)
+{
+	std::cerr << e.what() << '\n';
+	return -1;
+}
@@ -0,0 +1,691 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ *
+ * Headless benchmark for the IRenderer2D implementations.
+ *
+ * Every renderer is pushed through the same scripted scenes (textured quads, SDF shapes,
+ * depth sorted translucent sprites, glyph quads, distance field glyphs, and a sprite hierarchy
+ * composed once with TransformationMatrix and once with Math::Affine2D) and the results are
+ * printed as JSON so they can be diffed between commits. A last scene with a CPU heavy update is
+ * run once drawing directly and once recorded and replayed on CS230::RenderThread, to show what
+ * the overlap buys. All scene data comes from a fixed seed, so two runs with the same arguments
+ * submit exactly the same draw calls.
+ *
+ * By default SDL's "offscreen" video driver is requested, which gives an EGL pbuffer context
+ * (Mesa llvmpipe works fine on CI machines without a display). Setting SDL_VIDEODRIVER
+ * in the environment overrides this.
+ */
+#include "BenchCommon.h"
+#include "CS200/BatchRenderer2D.h"
+#include "CS200/DeferredRenderer2D.h"
+#include "CS200/IRenderer2D.h"
+#include "CS200/ImmediateRenderer2D.h"
+#include "CS200/InstancedRenderer2D.h"
+#include "CS200/NDC.h"
+#include "CS200/RenderingAPI.h"
+#include "Engine/Affine2D.h"
+#include "Engine/Error.h"
+#include "Engine/Matrix.h"
+#include "Engine/RenderThread.h"
+#include "Engine/SDFFont.h"
+#include "OpenGL/GL.h"
+#include "OpenGL/Texture.h"
+
+#include <GL/glew.h>
+#include <SDL.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	using bench::SeededRandom;
+
+	constexpr int BenchWidth  = 1280;
+	constexpr int BenchHeight = 720;
+
+	struct Options
+	{
+		int			  frames   = 240;
+		int			  warmup   = 16;
+		int			  quads	   = 20'000;
+		int			  textures = 8;
+		std::uint32_t seed	   = 0x5EED2025u;
+		std::string	  out{};
+	};
+
+	/**
+	 * Hidden window + GL context. The window is never shown or swapped, everything is
+	 * rendered into the default framebuffer of the pbuffer and finished with glFinish.
+	 */
+	class HeadlessContext
+	{
+	public:
+		HeadlessContext()
+		{
+			if (std::getenv("SDL_VIDEODRIVER") == nullptr)
+			{
+				SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+			}
+			if (SDL_Init(SDL_INIT_VIDEO) < 0)
+			{
+				// offscreen driver not compiled into this SDL build, fall back to whatever is available
+				SDL_SetHint(SDL_HINT_VIDEODRIVER, "");
+				if (SDL_Init(SDL_INIT_VIDEO) < 0)
+				{
+					throw_error_message("Failed to init SDL video: ", SDL_GetError());
+				}
+			}
+
+#if defined(IS_WEBGL2)
+			SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+			SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
+			SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
+#else
+			SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+#endif
+			SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+			SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
+			SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
+			SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8);
+			SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+
+			window = SDL_CreateWindow("renderer_bench", 0, 0, BenchWidth, BenchHeight, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+			if (window == nullptr)
+			{
+				throw_error_message("Failed to create bench window: ", SDL_GetError());
+			}
+			if (context = SDL_GL_CreateContext(window); context == nullptr)
+			{
+				throw_error_message("Failed to create opengl context: ", SDL_GetError());
+			}
+			SDL_GL_MakeCurrent(window, context);
+			SDL_GL_SetSwapInterval(0);
+
+#if !defined(IS_WEBGL2)
+			glewExperimental = GL_TRUE;
+			const auto result = glewInit();
+#	if defined(GLEW_ERROR_NO_GLX_DISPLAY)
+			// GLX builds of GLEW report this on EGL contexts even though the entry points loaded fine
+			const bool glew_ok = result == GLEW_OK || result == GLEW_ERROR_NO_GLX_DISPLAY;
+#	else
+			const bool glew_ok = result == GLEW_OK;
+#	endif
+			if (!glew_ok)
+			{
+				throw_error_message("Unable to initialize GLEW - error: ", glewGetErrorString(result));
+			}
+#endif
+			CS200::RenderingAPI::Init();
+			CS200::RenderingAPI::SetViewport({ BenchWidth, BenchHeight });
+		}
+
+		HeadlessContext(const HeadlessContext&)			   = delete;
+		HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+		~HeadlessContext()
+		{
+			SDL_GL_DeleteContext(context);
+			SDL_DestroyWindow(window);
+			SDL_Quit();
+		}
+
+		SDL_Window* GetWindow() const noexcept
+		{
+			return window;
+		}
+
+		SDL_GLContext GetContext() const noexcept
+		{
+			return context;
+		}
+
+	private:
+		SDL_Window*	  window  = nullptr;
+		SDL_GLContext context = nullptr;
+	};
+
+	struct Sprite
+	{
+		Math::vec2 position{};
+		Math::vec2 velocity{};
+		Math::vec2 size{};
+		double	   rotation = 0;
+		double	   spin		= 0;
+		int		   texture	= 0;
+		int		   kind		= 0; // sdf: 0 circle, 1 rectangle, 2 line
+		float	   depth	= 0;
+		CS200::RGBA color = CS200::WHITE;
+	};
+
+	CS200::RGBA random_color(SeededRandom& random, int min_alpha, int max_alpha)
+	{
+		const auto r = static_cast<CS200::RGBA>(random.Next(0, 255));
+		const auto g = static_cast<CS200::RGBA>(random.Next(0, 255));
+		const auto b = static_cast<CS200::RGBA>(random.Next(0, 255));
+		const auto a = static_cast<CS200::RGBA>(random.Next(min_alpha, max_alpha));
+		return (r << 24) | (g << 16) | (b << 8) | a;
+	}
+
+	std::vector<Sprite> make_sprites(SeededRandom& random, int count, int texture_count, int min_alpha, int max_alpha)
+	{
+		std::vector<Sprite> sprites(static_cast<size_t>(count));
+		for (auto& sprite : sprites)
+		{
+			sprite.position = { random.Next(0.0, double(BenchWidth)), random.Next(0.0, double(BenchHeight)) };
+			sprite.velocity = { random.Next(-120.0, 120.0), random.Next(-120.0, 120.0) };
+			sprite.size		= { random.Next(4.0, 48.0), random.Next(4.0, 48.0) };
+			sprite.rotation = random.Next(0.0, 2.0 * std::numbers::pi);
+			sprite.spin		= random.Next(-3.0, 3.0);
+			sprite.texture	= random.Next(0, texture_count - 1);
+			sprite.kind		= random.Next(0, 2);
+			sprite.depth	= static_cast<float>(random.Next(0.0, 1.0));
+			sprite.color	= random_color(random, min_alpha, max_alpha);
+		}
+		return sprites;
+	}
+
+	/** Scripted motion: positions are a pure function of the frame index so every renderer sees the same input. */
+	Math::TransformationMatrix sprite_matrix(const Sprite& sprite, int frame)
+	{
+		constexpr double dt = 1.0 / 60.0;
+		const double	 t	= dt * frame;
+		Math::vec2		 p	= sprite.position + sprite.velocity * t;
+		p.x					= std::fmod(std::fmod(p.x, double(BenchWidth)) + BenchWidth, double(BenchWidth));
+		p.y					= std::fmod(std::fmod(p.y, double(BenchHeight)) + BenchHeight, double(BenchHeight));
+		return Math::TranslationMatrix(p) * Math::RotationMatrix(sprite.rotation + sprite.spin * t) * Math::ScaleMatrix(sprite.size);
+	}
+
+	/** sprite_matrix() built straight into the float affine. */
+	Math::Affine2D sprite_affine(const Sprite& sprite, int frame)
+	{
+		constexpr double dt = 1.0 / 60.0;
+		const double	 t	= dt * frame;
+		Math::vec2		 p	= sprite.position + sprite.velocity * t;
+		p.x					= std::fmod(std::fmod(p.x, double(BenchWidth)) + BenchWidth, double(BenchWidth));
+		p.y					= std::fmod(std::fmod(p.y, double(BenchHeight)) + BenchHeight, double(BenchHeight));
+		return Math::Affine2D::FromTRS(p, sprite.rotation + sprite.spin * t, sprite.size);
+	}
+
+	/** Parents for the hierarchy scenes: groups slowly turning about the screen center, above a fixed camera. */
+	constexpr int HierarchyGroups = 64;
+
+	Math::TransformationMatrix group_matrix(int group, int frame)
+	{
+		const Math::vec2 center{ BenchWidth * 0.5, BenchHeight * 0.5 };
+		return Math::TranslationMatrix(center) * Math::RotationMatrix(0.002 * frame * (group % 5 - 2)) * Math::TranslationMatrix(-center);
+	}
+
+	/** Procedural textures so the bench does not depend on the asset folder content. */
+	std::vector<OpenGL::TextureHandle> make_textures(SeededRandom& random, int count)
+	{
+		constexpr int					   size = 64;
+		std::vector<OpenGL::TextureHandle> handles;
+		std::vector<CS200::RGBA>		   texels(size * size);
+		for (int i = 0; i < count; ++i)
+		{
+			const CS200::RGBA a = random_color(random, 255, 255);
+			const CS200::RGBA b = random_color(random, 255, 255);
+			for (int y = 0; y < size; ++y)
+			{
+				for (int x = 0; x < size; ++x)
+				{
+					texels[static_cast<size_t>(y * size + x)] = (((x / 8) + (y / 8)) % 2 == 0) ? a : b;
+				}
+			}
+			handles.push_back(OpenGL::CreateTextureFromMemory({ size, size }, texels));
+		}
+		return handles;
+	}
+
+	/** 16x6 grid of 8x8 cells, the same layout as a bitmap font atlas covering ' '..'o'. */
+	constexpr int GlyphColumns = 16;
+	constexpr int GlyphRows	   = 6;
+	constexpr int GlyphSize	   = 8;
+
+	OpenGL::TextureHandle make_glyph_atlas(SeededRandom& random)
+	{
+		constexpr int			 width	= GlyphColumns * GlyphSize;
+		constexpr int			 height = GlyphRows * GlyphSize;
+		std::vector<CS200::RGBA> texels(width * height, CS200::CLEAR);
+		for (auto& texel : texels)
+		{
+			if (random.Next(0, 2) == 0)
+				texel = CS200::WHITE;
+		}
+		return OpenGL::CreateTextureFromMemory({ width, height }, texels);
+	}
+
+	/** The same cell grid as a baked distance field atlas: every cell holds a disc of random radius, encoded like SDFFont::Bake. */
+	constexpr int SDFGlyphTexels = 32;
+
+	OpenGL::TextureHandle make_sdf_glyph_atlas(SeededRandom& random)
+	{
+		constexpr int			 width	= GlyphColumns * SDFGlyphTexels;
+		constexpr int			 height = GlyphRows * SDFGlyphTexels;
+		std::vector<CS200::RGBA> texels(width * height);
+		for (int cell = 0; cell < GlyphColumns * GlyphRows; ++cell)
+		{
+			const double radius = random.Next(4.0, 12.0);
+			const int	 left	= (cell % GlyphColumns) * SDFGlyphTexels;
+			const int	 bottom = (cell / GlyphColumns) * SDFGlyphTexels;
+			for (int y = 0; y < SDFGlyphTexels; ++y)
+			{
+				for (int x = 0; x < SDFGlyphTexels; ++x)
+				{
+					const double distance = radius - std::hypot(x + 0.5 - SDFGlyphTexels * 0.5, y + 0.5 - SDFGlyphTexels * 0.5);
+					const double encoded  = std::clamp(std::round(128.0 + 127.0 * distance / double(CS230::SDFFont::Spread)), 0.0, 255.0);
+					texels[static_cast<size_t>((bottom + y) * width + left + x)] = static_cast<CS200::RGBA>(encoded) * 0x01010101u;
+				}
+			}
+		}
+		return OpenGL::CreateTextureFromMemory({ width, height }, texels, OpenGL::Filtering::Linear, OpenGL::Wrapping::ClampToEdge);
+	}
+
+	struct FrameStats
+	{
+		std::vector<double> submit_ns{};
+		std::vector<double> frame_ms{};
+		size_t				draw_calls	   = 0;
+		size_t				texture_draws  = 0;
+		size_t				bytes_uploaded = 0;
+		size_t				primitives	   = 0;
+	};
+
+	/**
+	 * Runs one scene. draw_frame submits everything between BeginScene/EndScene and returns
+	 * the number of primitives it submitted. Submission time is measured on the CPU,
+	 * frame time additionally waits for the GPU with glFinish.
+	 */
+	template <typename DrawFrame>
+	FrameStats run_scene(CS200::IRenderer2D& renderer, const Options& options, DrawFrame&& draw_frame)
+	{
+		using bench::clock;
+		const auto ndc = CS200::build_ndc_matrix({ BenchWidth, BenchHeight });
+
+		FrameStats stats;
+		stats.submit_ns.reserve(static_cast<size_t>(options.frames));
+		stats.frame_ms.reserve(static_cast<size_t>(options.frames));
+		for (int frame = -options.warmup; frame < options.frames; ++frame)
+		{
+			CS200::RenderingAPI::Clear();
+			const auto start = clock::now();
+			renderer.BeginScene(ndc);
+			const size_t primitives = draw_frame(renderer, frame);
+			renderer.EndScene();
+			const auto submitted = clock::now();
+			GL::Finish();
+			const auto finished = clock::now();
+
+			if (frame < 0)
+				continue;
+			stats.submit_ns.push_back(bench::elapsed_ns(start, submitted));
+			stats.frame_ms.push_back(std::chrono::duration<double, std::milli>(finished - start).count());
+			stats.draw_calls	 = renderer.GetDrawCallCounter();
+			stats.texture_draws	 = renderer.GetDrawTextureCounter();
+			stats.bytes_uploaded = renderer.GetUploadedBytesCounter();
+			stats.primitives	 = primitives;
+		}
+		return stats;
+	}
+
+	/**
+	 * Update + draw loop where the update is as expensive as the draw. Synchronous frames update, submit and
+	 * glFinish on this thread. Threaded frames update and record into a command list, the render thread
+	 * replays and finishes it while the next frame updates. frame_ms is the time between frame starts on
+	 * this thread and submit_ns the time spent recording or submitting the draw calls.
+	 */
+	template <typename Update, typename DrawFrame>
+	FrameStats run_pipelined(CS200::IRenderer2D& renderer, CS230::RenderThread* render_thread, const Options& options, Update&& update, DrawFrame&& draw_frame)
+	{
+		using bench::clock;
+		const auto ndc = CS200::build_ndc_matrix({ BenchWidth, BenchHeight });
+
+		CS200::DeferredRenderer2D deferred;
+		FrameStats				  stats;
+		stats.submit_ns.reserve(static_cast<size_t>(options.frames));
+		stats.frame_ms.reserve(static_cast<size_t>(options.frames));
+		auto previous_start = clock::now();
+		for (int frame = -options.warmup; frame < options.frames; ++frame)
+		{
+			const auto start = clock::now();
+			if (frame > 0) // closes the previous measured frame
+			{
+				stats.frame_ms.push_back(std::chrono::duration<double, std::milli>(start - previous_start).count());
+			}
+			previous_start = start;
+			update(frame);
+
+			size_t	   primitives = 0;
+			const auto submit	  = clock::now();
+			if (render_thread == nullptr)
+			{
+				CS200::RenderingAPI::Clear();
+				renderer.BeginScene(ndc);
+				primitives = draw_frame(renderer);
+				renderer.EndScene();
+			}
+			else
+			{
+				CS200::RenderCommandList& list = render_thread->BeginFrame();
+				deferred.Record(&list);
+				list.Clear();
+				deferred.BeginScene(ndc);
+				primitives = draw_frame(deferred);
+				deferred.EndScene();
+				deferred.Record(nullptr);
+			}
+			const auto submitted = clock::now();
+			if (render_thread == nullptr)
+			{
+				GL::Finish();
+			}
+			else
+			{
+				render_thread->SubmitFrame(renderer, [] { GL::Finish(); });
+			}
+
+			if (frame < 0)
+				continue;
+			stats.submit_ns.push_back(bench::elapsed_ns(submit, submitted));
+			stats.primitives = primitives;
+		}
+		if (render_thread != nullptr)
+		{
+			render_thread->WaitIdle();
+		}
+		stats.frame_ms.push_back(std::chrono::duration<double, std::milli>(clock::now() - previous_start).count());
+		stats.draw_calls	 = renderer.GetDrawCallCounter();
+		stats.texture_draws	 = renderer.GetDrawTextureCounter();
+		stats.bytes_uploaded = renderer.GetUploadedBytesCounter();
+		return stats;
+	}
+
+	void write_result(std::ostream& json, std::string_view renderer_name, std::string_view scene_name, const FrameStats& stats, bool last)
+	{
+		using bench::percentile;
+		const double mean_submit = bench::mean(stats.submit_ns);
+		const double ns_per_quad = stats.primitives == 0 ? 0.0 : mean_submit / static_cast<double>(stats.primitives);
+
+		json << "    {\"renderer\": \"" << renderer_name << "\", \"scene\": \"" << scene_name << "\""
+			 << ", \"primitives\": " << stats.primitives
+			 << ", \"cpu_ns_per_quad\": " << ns_per_quad
+			 << ", \"draw_calls\": " << stats.draw_calls
+			 << ", \"texture_draws\": " << stats.texture_draws
+			 << ", \"bytes_uploaded\": " << stats.bytes_uploaded
+			 << ", \"submit_us\": {\"p50\": " << percentile(stats.submit_ns, 0.50) / 1000.0 << ", \"p90\": " << percentile(stats.submit_ns, 0.90) / 1000.0
+			 << ", \"p99\": " << percentile(stats.submit_ns, 0.99) / 1000.0 << "}"
+			 << ", \"frame_ms\": {\"p50\": " << percentile(stats.frame_ms, 0.50) << ", \"p90\": " << percentile(stats.frame_ms, 0.90)
+			 << ", \"p99\": " << percentile(stats.frame_ms, 0.99) << ", \"max\": " << percentile(stats.frame_ms, 1.0) << "}}" << (last ? "\n" : ",\n");
+	}
+
+	Options parse_options(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+			const bool			   has_value = i + 1 < argc;
+			if (arg == "--frames" && has_value)
+				options.frames = std::max(1, std::atoi(argv[++i]));
+			else if (arg == "--warmup" && has_value)
+				options.warmup = std::max(0, std::atoi(argv[++i]));
+			else if (arg == "--quads" && has_value)
+				options.quads = std::max(1, std::atoi(argv[++i]));
+			else if (arg == "--textures" && has_value)
+				options.textures = std::max(1, std::atoi(argv[++i]));
+			else if (arg == "--seed" && has_value)
+				options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 0));
+			else if (arg == "--out" && has_value)
+				options.out = argv[++i];
+			else
+				throw_error_message("Unknown argument: ", arg, "\nusage: renderer_bench [--frames N] [--warmup N] [--quads N] [--textures K] [--seed S] [--out file.json]");
+		}
+		return options;
+	}
+
+	std::string gl_string(GLenum name)
+	{
+		const auto* value = GL::GetString(name);
+		return value == nullptr ? std::string{} : std::string{ reinterpret_cast<const char*>(value) };
+	}
+}
+
+int main(int argc, char** argv)
+try
+{
+	const Options	options = parse_options(argc, argv);
+	HeadlessContext context;
+
+	SeededRandom	  random(options.seed);
+	const auto		  textures		 = make_textures(random, options.textures);
+	const auto		  glyph_atlas	 = make_glyph_atlas(random);
+	const auto		  sdf_atlas		 = make_sdf_glyph_atlas(random);
+	const auto		  quads			 = make_sprites(random, options.quads, options.textures, 255, 255);
+	const auto		  shapes		 = make_sprites(random, options.quads, options.textures, 255, 255);
+	auto			  translucent	 = make_sprites(random, options.quads, options.textures, 32, 200);
+	const std::string text_line		 = "The quick brown fox jumps over the lazy dog 0123456789 !?";
+	const int		  text_lines	 = std::max(1, options.quads / static_cast<int>(text_line.size()));
+	const double	  glyph_u		 = 1.0 / GlyphColumns;
+	const double	  glyph_v		 = 1.0 / GlyphRows;
+
+	struct Entry
+	{
+		std::string_view					name;
+		std::unique_ptr<CS200::IRenderer2D> renderer;
+	};
+	std::vector<Entry> renderers;
+	renderers.push_back({ "Immediate", std::make_unique<CS200::ImmediateRenderer2D>() });
+	renderers.push_back({ "Batch", std::make_unique<CS200::BatchRenderer2D>() });
+	renderers.push_back({ "Instanced", std::make_unique<CS200::InstancedRenderer2D>() });
+
+	std::ostringstream json;
+	json << "{\n  \"seed\": " << options.seed << ", \"frames\": " << options.frames << ", \"quads\": " << options.quads << ", \"textures\": " << options.textures
+		 << ",\n  \"video_driver\": \"" << (SDL_GetCurrentVideoDriver() ? SDL_GetCurrentVideoDriver() : "") << "\", \"gl_renderer\": \"" << gl_string(GL_RENDERER)
+		 << "\", \"gl_version\": \"" << gl_string(GL_VERSION) << "\",\n  \"results\": [\n";
+
+	for (size_t r = 0; r < renderers.size(); ++r)
+	{
+		auto& [name, renderer] = renderers[r];
+		renderer->Init();
+
+		const auto textured = run_scene(*renderer, options,
+										[&](CS200::IRenderer2D& r2d, int frame)
+										{
+											for (const auto& sprite : quads)
+											{
+												r2d.DrawQuad(sprite_matrix(sprite, frame), textures[static_cast<size_t>(sprite.texture)], { 0, 0 }, { 1, 1 }, sprite.color, sprite.depth);
+											}
+											return quads.size();
+										});
+		write_result(json, name, "textured_quads", textured, false);
+
+		const auto sdf = run_scene(*renderer, options,
+								   [&](CS200::IRenderer2D& r2d, int frame)
+								   {
+									   for (const auto& shape : shapes)
+									   {
+										   const auto transform = sprite_matrix(shape, frame);
+										   switch (shape.kind)
+										   {
+											   case 0: r2d.DrawCircle(transform, shape.color, CS200::BLACK, 2.0, shape.depth); break;
+											   case 1: r2d.DrawRectangle(transform, shape.color, CS200::BLACK, 2.0, shape.depth); break;
+											   default: r2d.DrawLine(transform, { -0.5, 0 }, { 0.5, 0 }, shape.color, 2.0, shape.depth); break;
+										   }
+									   }
+									   return shapes.size();
+								   });
+		write_result(json, name, "sdf_shapes", sdf, false);
+
+		const auto sorted = run_scene(*renderer, options,
+									  [&](CS200::IRenderer2D& r2d, int frame)
+									  {
+										  // translucent sprites have to be drawn back to front, the sort is part of the measured cost
+										  std::sort(translucent.begin(), translucent.end(), [](const Sprite& a, const Sprite& b) { return a.depth > b.depth; });
+										  for (auto& sprite : translucent)
+										  {
+											  r2d.DrawQuad(sprite_matrix(sprite, frame), textures[static_cast<size_t>(sprite.texture)], { 0, 0 }, { 1, 1 }, sprite.color, sprite.depth);
+										  }
+										  // nudge depths every frame so the sort never sees already sorted input
+										  for (size_t i = 0; i < translucent.size(); i += 7)
+										  {
+											  translucent[i].depth = 1.0f - translucent[i].depth;
+										  }
+										  return translucent.size();
+									  });
+		write_result(json, name, "translucent_sorted", sorted, false);
+
+		const auto text = run_scene(*renderer, options,
+									[&](CS200::IRenderer2D& r2d, int frame)
+									{
+										size_t glyphs = 0;
+										for (int line = 0; line < text_lines; ++line)
+										{
+											Math::vec2 pen{ double((line * 37 + frame) % 200), double((line * GlyphSize) % BenchHeight) };
+											for (const char c : text_line)
+											{
+												const int  index = std::clamp(c - ' ', 0, GlyphColumns * GlyphRows - 1);
+												const auto bl	 = Math::vec2{ (index % GlyphColumns) * glyph_u, 1.0 - (index / GlyphColumns + 1) * glyph_v };
+												r2d.DrawQuad(Math::TranslationMatrix(pen) * Math::ScaleMatrix(double(GlyphSize)), glyph_atlas, bl, bl + Math::vec2{ glyph_u, glyph_v }, CS200::WHITE, 0.f);
+												pen.x += GlyphSize;
+												++glyphs;
+											}
+										}
+										return glyphs;
+									});
+		write_result(json, name, "text", text, false);
+
+		// the text scene again on the distance field path, outlined glyphs share the SDF shapes' draw call
+		const auto sdf_text = run_scene(*renderer, options,
+										[&](CS200::IRenderer2D& r2d, int frame)
+										{
+											size_t glyphs = 0;
+											for (int line = 0; line < text_lines; ++line)
+											{
+												Math::vec2 pen{ double((line * 37 + frame) % 200), double((line * GlyphSize) % BenchHeight) };
+												for (const char c : text_line)
+												{
+													const int  index = std::clamp(c - ' ', 0, GlyphColumns * GlyphRows - 1);
+													const auto bl	 = Math::vec2{ (index % GlyphColumns) * glyph_u, 1.0 - (index / GlyphColumns + 1) * glyph_v };
+													r2d.DrawSDFGlyph(
+														Math::TranslationMatrix(pen) * Math::ScaleMatrix(double(GlyphSize)), sdf_atlas, bl, bl + Math::vec2{ glyph_u, glyph_v }, CS200::WHITE,
+														CS200::BLACK, 0.25, 0.0, 0.f);
+													pen.x += GlyphSize;
+													++glyphs;
+												}
+											}
+											return glyphs;
+										});
+		write_result(json, name, "sdf_text", sdf_text, false);
+
+		// camera * group * object for every sprite, the way GameObject::Draw composes a child under its parent
+		const Math::TransformationMatrix camera = Math::TranslationMatrix(Math::vec2{ -20.0, -10.0 });
+		const auto hierarchy_matrix = run_scene(*renderer, options,
+												[&](CS200::IRenderer2D& r2d, int frame)
+												{
+													std::array<Math::TransformationMatrix, HierarchyGroups> groups;
+													for (int g = 0; g < HierarchyGroups; ++g)
+														groups[static_cast<size_t>(g)] = camera * group_matrix(g, frame);
+													for (size_t i = 0; i < quads.size(); ++i)
+													{
+														const auto& sprite = quads[i];
+														r2d.DrawQuad(
+															groups[i % HierarchyGroups] * sprite_matrix(sprite, frame), textures[static_cast<size_t>(sprite.texture)], { 0, 0 }, { 1, 1 }, sprite.color,
+															sprite.depth);
+													}
+													return quads.size();
+												});
+		write_result(json, name, "hierarchy_sprites_matrix", hierarchy_matrix, false);
+
+		const auto hierarchy_affine = run_scene(*renderer, options,
+												[&](CS200::IRenderer2D& r2d, int frame)
+												{
+													std::array<Math::Affine2D, HierarchyGroups> groups;
+													for (int g = 0; g < HierarchyGroups; ++g)
+														groups[static_cast<size_t>(g)] = Math::Affine2D(camera * group_matrix(g, frame));
+													for (size_t i = 0; i < quads.size(); ++i)
+													{
+														const auto& sprite = quads[i];
+														r2d.DrawQuad(
+															groups[i % HierarchyGroups] * sprite_affine(sprite, frame), textures[static_cast<size_t>(sprite.texture)], { 0, 0 }, { 1, 1 }, sprite.color,
+															sprite.depth);
+													}
+													return quads.size();
+												});
+		write_result(json, name, "hierarchy_sprites_affine", hierarchy_affine, false);
+
+		renderer->Shutdown();
+	}
+
+	{
+		// the update stands in for game logic: every transform is rebuilt and the sprites are depth sorted
+		std::vector<Math::TransformationMatrix> transforms(translucent.size());
+		const auto								update = [&](int frame)
+		{
+			for (size_t i = 0; i < translucent.size(); ++i)
+			{
+				transforms[i] = sprite_matrix(translucent[i], frame);
+			}
+			std::sort(translucent.begin(), translucent.end(), [](const Sprite& a, const Sprite& b) { return a.depth > b.depth; });
+			for (size_t i = 0; i < translucent.size(); i += 7)
+			{
+				translucent[i].depth = 1.0f - translucent[i].depth;
+			}
+		};
+		const auto draw = [&](CS200::IRenderer2D& r2d)
+		{
+			for (size_t i = 0; i < translucent.size(); ++i)
+			{
+				const Sprite& sprite = translucent[i];
+				r2d.DrawQuad(transforms[i], textures[static_cast<size_t>(sprite.texture)], { 0, 0 }, { 1, 1 }, sprite.color, sprite.depth);
+			}
+			return translucent.size();
+		};
+
+		CS200::BatchRenderer2D batch;
+		batch.Init();
+		const auto synchronous = run_pipelined(batch, nullptr, options, update, draw);
+		write_result(json, "Batch", "update_then_draw_sync", synchronous, false);
+
+		CS230::RenderThread render_thread;
+		render_thread.Start(context.GetWindow(), context.GetContext());
+		const auto threaded = run_pipelined(batch, &render_thread, options, update, draw);
+		render_thread.Stop();
+		write_result(json, "Batch", "update_then_draw_render_thread", threaded, true);
+		batch.Shutdown();
+	}
+	json << "  ]\n}\n";
+
+	for (auto handle : textures)
+		GL::DeleteTextures(1, &handle);
+	GL::DeleteTextures(1, &glyph_atlas);
+	GL::DeleteTextures(1, &sdf_atlas);
+
+	std::cout << json.str();
+	if (!options.out.empty())
+	{
+		std::ofstream file(options.out);
+		file << json.str();
+	}
+	return 0;
+}
+catch (const std::exception& e)
+{
+	std::cerr << e.what() << '\n';
+	return -1;
+}
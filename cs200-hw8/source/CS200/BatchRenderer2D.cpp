@@ -12,9 +12,8 @@
 #include "OpenGL/GL.h"
 #include "OpenGL/VertexArray.h"
 #include "Renderer2DUtils.h"
-#include <fstream>
+#include <algorithm>
 #include <numeric>
-#include <sstream>
 
 namespace CS200
 {
@@ -39,6 +38,7 @@ namespace CS200
           sdfModelHandle(other.sdfModelHandle),
           sdfVertexDataEnd(other.sdfVertexDataEnd),
           sdfIndexCount(other.sdfIndexCount),
+          sdfAtlas(other.sdfAtlas),
           indexBufferHandle(other.indexBufferHandle),
           camera_uniform_buffer(other.camera_uniform_buffer),
           camera_array(other.camera_array),
@@ -50,7 +50,8 @@ namespace CS200
           textureSlots(std::move(other.textureSlots)),
           activeTextureSize(other.activeTextureSize),
           draw_call(other.draw_call), 
-		  texture_call(other.texture_call)
+		  texture_call(other.texture_call),
+		  upload_bytes(other.upload_bytes)
 	{
 		other.vertexBufferHandle	 = 0;
 		other.modelHandle			 = 0;
@@ -64,9 +65,11 @@ namespace CS200
 		other.indexCount			 = 0;
 		other.sdfVertexDataEnd		 = nullptr;
 		other.sdfIndexCount			 = 0;
+		other.sdfAtlas				 = 0;
 		other.activeTextureSize		 = 0;
 		other.draw_call				 = 0;
 		other.texture_call			 = 0;
+		other.upload_bytes			 = 0;
 	}
 
 	BatchRenderer2D& BatchRenderer2D::operator=(BatchRenderer2D&& other) noexcept
@@ -84,11 +87,13 @@ namespace CS200
 		std::swap(sdfModelHandle, other.sdfModelHandle);
 		std::swap(sdfVertexDataEnd, other.sdfVertexDataEnd);
 		std::swap(sdfIndexCount, other.sdfIndexCount);
+		std::swap(sdfAtlas, other.sdfAtlas);
 
 		std::swap(camera_uniform_buffer, other.camera_uniform_buffer);
 		std::swap(camera_array, other.camera_array);
 		std::swap(draw_call, other.draw_call);
 		std::swap(texture_call, other.texture_call);
+		std::swap(upload_bytes, other.upload_bytes);
 
 		std::swap(maxVertices, other.maxVertices);
 		std::swap(maxIndices, other.maxIndices);
@@ -112,18 +117,8 @@ namespace CS200
 		textureSlots.resize(static_cast<size_t>(std::min(max_tex_units, 64)));
 
 		// load shaders with parsing
-		const std::filesystem::path vertex_file = assets::locate_asset("Assets/shaders/BatchRenderer2D/quad.vert");
-		std::ifstream				vert_stream(vertex_file);
-		std::stringstream			vert_text_stream;
-		vert_text_stream << vert_stream.rdbuf();
-		const std::string vertex_glsl = vert_text_stream.str();
-
-
-		const std::filesystem::path fragment_file = assets::locate_asset("Assets/shaders/BatchRenderer2D/quad.frag");
-		std::ifstream				frag_stream(fragment_file);
-		std::stringstream			frag_text_stream;
-		frag_text_stream << frag_stream.rdbuf();
-		std::string		  frag_glsl		= frag_text_stream.str();
+		const std::string vertex_glsl = std::string(assets::read_asset("Assets/shaders/BatchRenderer2D/quad.vert").text());
+		std::string		  frag_glsl		= std::string(assets::read_asset("Assets/shaders/BatchRenderer2D/quad.frag").text());
 		const size_t	  first_newline = frag_glsl.find('\n');
 		const std::string define_line	= "\n#define MAX_TEXTURE_SLOTS " + std::to_string(textureSlots.size());
 		frag_glsl.insert(first_newline, define_line);
@@ -192,6 +187,11 @@ namespace CS200
 		};
 		sdfModelHandle = OpenGL::CreateVertexArrayObject(sdfLayout, indexBufferHandle);
 
+		// glyph atlas always goes to unit 0, bound in flush after the textured quads are drawn
+		GL::UseProgram(sdfShader.Shader);
+		GL::Uniform1i(GL::GetUniformLocation(sdfShader.Shader, "uGlyphAtlas"), 0);
+		GL::UseProgram(0);
+
 		//- Create uniform buffer for camera/view-projection matrix
 		camera_uniform_buffer = OpenGL::CreateBuffer(OpenGL::BufferType::UniformBlocks, sizeof(camera_array));
 
@@ -230,6 +230,7 @@ namespace CS200
 
 		draw_call	 = 0;
 		texture_call = 0;
+		upload_bytes = sizeof(camera_array);
 		startBatch();
 	}
 
@@ -239,6 +240,11 @@ namespace CS200
 	}
 
 	void BatchRenderer2D::DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
+	{
+		DrawQuad(Math::Affine2D(transform), texture, texture_coord_bl, texture_coord_tr, tintColor, depth);
+	}
+
+	void BatchRenderer2D::DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
 	{
 		if (sdfIndexCount + 6 > maxIndices)
 		{
@@ -289,23 +295,20 @@ namespace CS200
 
 		// const std::array<unsigned char, 4> tint = pack_color(tint_color);
 
-		constexpr std::array<float, 2> model_positions[4] = {
-			{ -0.5, -0.5 }, //  bottom left
-			{ +0.5, -0.5 }, //  bottom right
-			{ +0.5, +0.5 }, //  top right
-			{ -0.5, +0.5 }	//  top left
+		constexpr std::array<Math::fvec2, 4> model_positions = {
+			Math::fvec2{ -0.5f, -0.5f }, //  bottom left
+			Math::fvec2{ +0.5f, -0.5f }, //  bottom right
+			Math::fvec2{ +0.5f, +0.5f }, //  top right
+			Math::fvec2{ -0.5f, +0.5f }	 //  top left
 		};
-
+		// model to world for all four corners at once, already in float
+		std::array<Math::fvec2, 4> world_positions;
+		transform.TransformPoints(model_positions, world_positions);
 
 		for (unsigned i = 0; i < 4; ++i) // i is for 4 vertex(bottom/top - right/left)
 		{
-			// matrix multiply manually (3by 3, transform matrix) * (3 by 1, position matrix) => model to world!
-			const float x =
-				static_cast<float>(static_cast<double>(model_positions[i][0])  * transform[0][0] + static_cast<double>(model_positions[i][1])  * transform[0][1] + transform[0][2]);
-			const float y = static_cast<float>(static_cast<double>(model_positions[i][0]) * transform[1][0] + static_cast<double>(model_positions[i][1]) * transform[1][1] + transform[1][2]);
-
-			vertexDataEnd->x			= x;
-			vertexDataEnd->y			= y;
+			vertexDataEnd->x			= world_positions[i].x;
+			vertexDataEnd->y			= world_positions[i].y;
 			vertexDataEnd->s			= texture_coords[i][0];
 			vertexDataEnd->t			= texture_coords[i][1];
 			vertexDataEnd->tint			= ColorArray(tintColor);
@@ -429,6 +432,140 @@ namespace CS200
 		DrawLine(Math::TransformationMatrix{}, start_point, end_point, line_color, line_width, depth);
 	}
 
+	void BatchRenderer2D::DrawSDFGlyph(
+		const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+		double outline_width, double glow_width, float depth)
+	{
+		if (indexCount + 6 > maxIndices)
+		{
+			flush();
+		}
+		if (sdfIndexCount + 6 > maxIndices || (sdfAtlas != 0 && sdfAtlas != atlas))
+		{
+			flush();
+		}
+		sdfAtlas = atlas;
+
+		const auto fill_bytes = ColorArray(fill_color);
+		const auto line_bytes = ColorArray(line_color);
+
+		const float left   = static_cast<float>(texture_coord_bl.x);
+		const float bottom = static_cast<float>(texture_coord_bl.y);
+		const float right  = static_cast<float>(texture_coord_tr.x);
+		const float top	   = static_cast<float>(texture_coord_tr.y);
+
+		const std::array<float, 2> texture_coords[4] = {
+			{  left, bottom }, //  bottom left
+			{ right, bottom }, //  bottom right
+			{ right,	 top }, //  top right
+			{  left,	top }  //  top left
+		};
+
+		constexpr std::array<float, 2> model_positions[4] = {
+			{ -0.5, -0.5 }, //  bottom left
+			{ +0.5, -0.5 }, //  bottom right
+			{ +0.5, +0.5 }, //  top right
+			{ -0.5, +0.5 }	//  top left
+		};
+
+		for (unsigned i = 0; i < 4; ++i)
+		{
+			const float x =
+				static_cast<float>(static_cast<double>(model_positions[i][0]) * transform[0][0] + static_cast<double>(model_positions[i][1]) * transform[0][1] + transform[0][2]);
+			const float y = static_cast<float>(static_cast<double>(model_positions[i][0]) * transform[1][0] + static_cast<double>(model_positions[i][1]) * transform[1][1] + transform[1][2]);
+
+			sdfVertexDataEnd->x			  = x;
+			sdfVertexDataEnd->y			  = y;
+			sdfVertexDataEnd->testPoint_s = texture_coords[i][0];
+			sdfVertexDataEnd->testPoint_t = texture_coords[i][1];
+			sdfVertexDataEnd->fillColor	  = fill_bytes;
+			sdfVertexDataEnd->lineColor	  = line_bytes;
+			sdfVertexDataEnd->worldSize_x = static_cast<float>(glow_width);
+			sdfVertexDataEnd->worldSize_y = 0.0f;
+			sdfVertexDataEnd->lineWidth	  = static_cast<float>(outline_width);
+			sdfVertexDataEnd->shape		  = static_cast<int>(SDFShape::Glyph); // 2
+			sdfVertexDataEnd->depth		  = depth;
+
+			++sdfVertexDataEnd;
+		}
+		sdfIndexCount += 6;
+
+		++texture_call;
+	}
+
+	void BatchRenderer2D::DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth)
+	{
+		Renderer2DUtils::DrawParticlesAsQuads(*this, particles, texture, texture_coord_bl, texture_coord_tr, depth);
+	}
+
+	void BatchRenderer2D::DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth)
+	{
+		const std::array<unsigned char, 4> tint_bytes = ColorArray(tint);
+		const float						   m00		  = static_cast<float>(transform[0][0]);
+		const float						   m01		  = static_cast<float>(transform[0][1]);
+		const float						   m02		  = static_cast<float>(transform[0][2]);
+		const float						   m10		  = static_cast<float>(transform[1][0]);
+		const float						   m11		  = static_cast<float>(transform[1][1]);
+		const float						   m12		  = static_cast<float>(transform[1][2]);
+
+		// the run goes in as one block of vertices, only split when it does not fit in what is left of the batch
+		size_t next = 0;
+		while (next < quads.size())
+		{
+			if (indexCount + 6 > maxIndices)
+			{
+				flush();
+			}
+
+			int	 tex_index = 0;
+			bool found	   = false;
+			for (size_t i = 0; i < activeTextureSize; ++i)
+			{
+				if (textureSlots[i] == texture)
+				{
+					found	  = true;
+					tex_index = static_cast<int>(i);
+				}
+			}
+			if (!found)
+			{
+				if (activeTextureSize >= textureSlots.size())
+				{
+					flush();
+				}
+				tex_index						= static_cast<int>(activeTextureSize);
+				textureSlots[activeTextureSize] = texture;
+				++activeTextureSize;
+			}
+
+			const size_t room  = (maxIndices - indexCount) / 6;
+			const size_t count = std::min(room, quads.size() - next);
+			for (const GlyphQuad& quad : quads.subspan(next, count))
+			{
+				const float corners[4][4] = {
+					{  quad.left, quad.bottom, quad.s0, quad.t0 }, //  bottom left
+					{ quad.right, quad.bottom, quad.s1, quad.t0 }, //  bottom right
+					{ quad.right,	 quad.top, quad.s1, quad.t1 }, //  top right
+					{  quad.left,	 quad.top, quad.s0, quad.t1 }  //  top left
+				};
+				for (const auto& corner : corners)
+				{
+					vertexDataEnd->x			= m00 * corner[0] + m01 * corner[1] + m02;
+					vertexDataEnd->y			= m10 * corner[0] + m11 * corner[1] + m12;
+					vertexDataEnd->s			= corner[2];
+					vertexDataEnd->t			= corner[3];
+					vertexDataEnd->tint			= tint_bytes;
+					vertexDataEnd->textureIndex = tex_index;
+					vertexDataEnd->depth		= depth;
+					++vertexDataEnd;
+				}
+			}
+			indexCount += static_cast<unsigned>(count * 6);
+			next += count;
+		}
+		++texture_call;
+	}
+
 	void BatchRenderer2D::startBatch()
 	{
 		vertexDataEnd	  = vertexData.data();
@@ -437,6 +574,7 @@ namespace CS200
 
 		sdfVertexDataEnd = sdfVertexData.data();
 		sdfIndexCount	 = 0;
+		sdfAtlas		 = 0;
 
 	}
 
@@ -453,6 +591,7 @@ namespace CS200
 			GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(QuadVertex) * maxVertices), nullptr, GL_DYNAMIC_DRAW); // orphaning
 
 			OpenGL::UpdateBufferData(OpenGL::BufferType::Vertices, vertexBufferHandle, bytes_to_send);
+			upload_bytes += bytes_to_send.size();
 
 
 			// select our texture
@@ -478,7 +617,13 @@ namespace CS200
 			GL::BindBuffer(GL_ARRAY_BUFFER, sdfVertexBufferHandle);
 			GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(SDFVertex) * maxVertices), nullptr, GL_DYNAMIC_DRAW); // orphaning
 			OpenGL::UpdateBufferData(OpenGL::BufferType::Vertices, sdfVertexBufferHandle, sdf_bytes_to_send);
+			upload_bytes += sdf_bytes_to_send.size();
 
+			if (sdfAtlas != 0)
+			{
+				GL::ActiveTexture(GL_TEXTURE0);
+				GL::BindTexture(GL_TEXTURE_2D, sdfAtlas);
+			}
 			GL::UseProgram(sdfShader.Shader);
 			GL::BindVertexArray(sdfModelHandle);
 			GL::DrawElements(GL_TRIANGLES, static_cast<GLsizei>(sdfIndexCount), GL_UNSIGNED_INT, nullptr);
@@ -520,4 +665,9 @@ namespace CS200
 		return texture_call;
 	}
 
+	size_t BatchRenderer2D::GetUploadedBytesCounter()
+	{
+		return upload_bytes;
+	}
+
 } // namespace CS200
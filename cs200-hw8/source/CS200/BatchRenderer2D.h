@@ -37,11 +37,17 @@ namespace CS200
 		void EndScene() override;
 		void
 			DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
+		void DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
 		// void DrawQuad(std::span<const float, 9> transform, OpenGL::Handle texture, std::span<const float, 4> texture_coords_lbrt, std::span<const float, 4> tint_color) override;
 		void DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth) override;
 		void DrawRectangle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth) override;
 		void DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth) override;
 		void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth) override;
+		void DrawSDFGlyph(
+			const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+			double outline_width, double glow_width, float depth) override;
+		void DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth) override;
+		void DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth) override;
 
 	private:
 		struct QuadVertex
@@ -64,12 +70,12 @@ namespace CS200
 		struct SDFVertex
 		{
 			float						 x = 0, y = 0;					   // Layout 0: aWorldPosition
-			float						 testPoint_s = 0, testPoint_t = 0; // Layout 1: aTestPoint
+			float						 testPoint_s = 0, testPoint_t = 0; // Layout 1: aTestPoint (atlas texture coordinate for glyphs)
 			std::array<unsigned char, 4> fillColor{};					   // Layout 2: aFillColor
 			std::array<unsigned char, 4> lineColor{};					   // Layout 3: aLineColor
-			float						 worldSize_x = 0, worldSize_y = 0; // Layout 4: aWorldSize
-			float						 lineWidth = 0;					   // Layout 5: aLineWidth
-			int							 shape	   = 0;					   // Layout 6: aShape (0=Circle, 1=Rect)
+			float						 worldSize_x = 0, worldSize_y = 0; // Layout 4: aWorldSize (glow width, unused for glyphs)
+			float						 lineWidth = 0;					   // Layout 5: aLineWidth (outline width for glyphs)
+			int							 shape	   = 0;					   // Layout 6: aShape (0=Circle, 1=Rect, 2=Glyph)
 			float						 depth	   = 0;					   // Layout 7: aDepth
 		};
 
@@ -79,6 +85,7 @@ namespace CS200
 		OpenGL::VertexArrayHandle sdfModelHandle{};
 		SDFVertex*				  sdfVertexDataEnd = nullptr; // pointing where we are
 		unsigned				  sdfIndexCount	   = 0;
+		OpenGL::TextureHandle	  sdfAtlas		   = 0; // glyph atlas of this batch, one per SDF draw call
 
 		OpenGL::BufferHandle	   indexBufferHandle{};
 		OpenGL::BufferHandle	   camera_uniform_buffer{};
@@ -95,6 +102,7 @@ namespace CS200
 		{
 			Circle	  = 0,
 			Rectangle = 1,
+			Glyph	  = 2,
 		};
 		// void DrawSDF(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, SDFShape sdf_shape);
 
@@ -115,6 +123,9 @@ namespace CS200
 
 		size_t texture_call = 0;
 		size_t GetDrawTextureCounter() override;
+
+		size_t upload_bytes = 0;
+		size_t GetUploadedBytesCounter() override;
 	};
 
 }
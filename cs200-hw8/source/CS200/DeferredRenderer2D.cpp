@@ -0,0 +1,116 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#include "DeferredRenderer2D.h"
+
+#include "Engine/Affine2D.h"
+#include "RenderCommandList.h"
+
+namespace CS200
+{
+	void DeferredRenderer2D::SetCounters(size_t draw_calls, size_t texture_draws, size_t uploaded_bytes)
+	{
+		drawCallCounter.store(draw_calls, std::memory_order_relaxed);
+		drawTextureCounter.store(texture_draws, std::memory_order_relaxed);
+		uploadedBytesCounter.store(uploaded_bytes, std::memory_order_relaxed);
+	}
+
+	void DeferredRenderer2D::Init()
+	{
+	}
+
+	void DeferredRenderer2D::Shutdown()
+	{
+		recording = nullptr;
+	}
+
+	void DeferredRenderer2D::BeginScene(const Math::TransformationMatrix& view_projection)
+	{
+		if (recording != nullptr)
+			recording->BeginScene(view_projection);
+	}
+
+	void DeferredRenderer2D::EndScene()
+	{
+		if (recording != nullptr)
+			recording->EndScene();
+	}
+
+	void DeferredRenderer2D::DrawQuad(
+		const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawQuad(Math::Affine2D(transform), texture, texture_coord_bl, texture_coord_tr, tintColor, depth);
+	}
+
+	void DeferredRenderer2D::DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawQuad(transform, texture, texture_coord_bl, texture_coord_tr, tintColor, depth);
+	}
+
+	void DeferredRenderer2D::DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawCircle(transform, fill_color, line_color, line_width, depth);
+	}
+
+	void DeferredRenderer2D::DrawRectangle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawRectangle(transform, fill_color, line_color, line_width, depth);
+	}
+
+	void DeferredRenderer2D::DrawLine(
+		const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawLine(transform, start_point, end_point, line_color, line_width, depth);
+	}
+
+	void DeferredRenderer2D::DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawLine(start_point, end_point, line_color, line_width, depth);
+	}
+
+	void DeferredRenderer2D::DrawSDFGlyph(
+		const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+		double outline_width, double glow_width, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawSDFGlyph(transform, atlas, texture_coord_bl, texture_coord_tr, fill_color, line_color, outline_width, glow_width, depth);
+	}
+
+	void DeferredRenderer2D::DrawParticles(
+		std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawParticles(particles, texture, texture_coord_bl, texture_coord_tr, depth);
+	}
+
+	void DeferredRenderer2D::DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth)
+	{
+		if (recording != nullptr)
+			recording->DrawGlyphQuads(transform, quads, texture, tint, depth);
+	}
+
+	size_t DeferredRenderer2D::GetDrawCallCounter()
+	{
+		return drawCallCounter.load(std::memory_order_relaxed);
+	}
+
+	size_t DeferredRenderer2D::GetDrawTextureCounter()
+	{
+		return drawTextureCounter.load(std::memory_order_relaxed);
+	}
+
+	size_t DeferredRenderer2D::GetUploadedBytesCounter()
+	{
+		return uploadedBytesCounter.load(std::memory_order_relaxed);
+	}
+}
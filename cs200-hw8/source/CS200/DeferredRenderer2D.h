@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+
+#include "IRenderer2D.h"
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * IRenderer2D that touches no GL: every call is appended to the command list set with Record(), and the
+ * render thread replays that list into a real renderer (Engine/RenderThread.h). Draw calls outside of
+ * a recorded frame are a programming error and are dropped.
+ */
+namespace CS200
+{
+	class RenderCommandList;
+
+	class DeferredRenderer2D : public IRenderer2D
+	{
+	public:
+		void Record(RenderCommandList* list) { recording = list; }
+		// counters of the last frame the render thread replayed, so stats overlays keep working
+		void SetCounters(size_t draw_calls, size_t texture_draws, size_t uploaded_bytes);
+
+		void Init() override;
+		void Shutdown() override;
+		void BeginScene(const Math::TransformationMatrix& view_projection) override;
+		void EndScene() override;
+		void
+			DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
+		void DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
+		void DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth) override;
+		void DrawRectangle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth) override;
+		void DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth) override;
+		void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth) override;
+		void DrawSDFGlyph(
+			const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+			double outline_width, double glow_width, float depth) override;
+		void DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth) override;
+		void DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth) override;
+
+		size_t GetDrawCallCounter() override;
+		size_t GetDrawTextureCounter() override;
+		size_t GetUploadedBytesCounter() override;
+
+	private:
+		RenderCommandList*	recording = nullptr;
+		std::atomic<size_t> drawCallCounter{ 0 };
+		std::atomic<size_t> drawTextureCounter{ 0 };
+		std::atomic<size_t> uploadedBytesCounter{ 0 };
+	};
+}
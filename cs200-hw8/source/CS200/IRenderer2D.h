@@ -12,13 +12,32 @@
 #include "OpenGL/Texture.h"
 #include "RGBA.h"
 
+#include <array>
+#include <span>
+
 namespace Math
 {
     class TransformationMatrix;
+    class Affine2D;
 }
 
 namespace CS200
 {
+    // one particle for DrawParticles: world space center, edge length, tint. 16 bytes so a million fit a 16MB upload
+    struct ParticleInstance
+    {
+        float                        x = 0, y = 0;
+        float                        size = 0;
+        std::array<unsigned char, 4> tint{};
+    };
+
+    // one glyph of a laid out text run (Engine/TextLayout.h): corners in the run's own space and the texture rectangle in 0..1
+    struct GlyphQuad
+    {
+        float left = 0, bottom = 0, right = 0, top = 0;
+        float s0 = 0, t0 = 0, s1 = 0, t1 = 0;
+    };
+
     class IRenderer2D
     {
     public:
@@ -33,6 +52,11 @@ namespace CS200
         virtual void DrawQuad(
             const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl = Math::vec2{ 0.0, 0.0 }, Math::vec2 texture_coord_tr = Math::vec2{ 1.0, 1.0 },
             CS200::RGBA tintColor = CS200::WHITE, float depth = 1.f) = 0;
+        // the same quad from a float 2x3 affine (Engine/Affine2D.h), which Texture and Sprite draw with. Renderers use
+        // it as is; their TransformationMatrix overload converts once and forwards here
+        virtual void DrawQuad(
+            const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl = Math::vec2{ 0.0, 0.0 }, Math::vec2 texture_coord_tr = Math::vec2{ 1.0, 1.0 },
+            CS200::RGBA tintColor = CS200::WHITE, float depth = 1.f) = 0;
         virtual void
 			DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color = CS200::CLEAR, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0, float depth = 0.f) = 0;
         virtual void
@@ -40,9 +64,24 @@ namespace CS200
         virtual void
 			DrawLine(const Math::TransformationMatrix& transform, Math::vec2 startPoint, Math::vec2 endPoint, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0, float depth = 0.f) = 0;
         virtual void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color = CS200::WHITE, double line_width = 2.0, float depth = 0.f) = 0;
+        // one glyph quad of a distance field font atlas (Engine/SDFFont.h), drawn through the same SDF path as circles and rectangles.
+        // The inside of the 0.5 contour is filled, outline_width and glow_width put line_color around it; both are in units of the
+        // atlas spread (0..1), so a single atlas gives plain, outlined and glowing text at any scale.
+        virtual void DrawSDFGlyph(
+            const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr,
+            CS200::RGBA fill_color = CS200::WHITE, CS200::RGBA line_color = CS200::CLEAR, double outline_width = 0.0, double glow_width = 0.0, float depth = 0.f) = 0;
+        // axis aligned quads sharing one texture region, instanced renderers draw the whole span in a single call
+        virtual void DrawParticles(
+            std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl = Math::vec2{ 0.0, 0.0 },
+            Math::vec2 texture_coord_tr = Math::vec2{ 1.0, 1.0 }, float depth = 0.5f) = 0;
+        // every quad of a text run under one transform, texture and tint; batching renderers append the run as one block
+        virtual void DrawGlyphQuads(
+            const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint = CS200::WHITE, float depth = 0.6f) = 0;
 
         virtual size_t GetDrawCallCounter() = 0;
         virtual size_t GetDrawTextureCounter() = 0;
+        // bytes handed to the driver (buffer uploads + uniforms) since the last BeginScene
+        virtual size_t GetUploadedBytesCounter() = 0;
     };
 
 }
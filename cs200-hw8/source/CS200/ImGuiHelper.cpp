@@ -39,6 +39,8 @@ namespace ImGuiHelper
         }
         ImGui_ImplSDL2_InitForOpenGL(sdl_window, gl_context);
         ImGui_ImplOpenGL3_Init();
+        // made here instead of lazily in the first NewFrame, so Begin() never needs the GL context
+        ImGui_ImplOpenGL3_CreateDeviceObjects();
     }
 
     void FeedEvent(const SDL_Event& event)
@@ -88,8 +90,18 @@ namespace ImGuiHelper
     }
 
     void End()
+    {
+        Render();
+        Present();
+    }
+
+    void Render()
     {
         ImGui::Render();
+    }
+
+    void Present()
+    {
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
         const ImGuiIO& io = ImGui::GetIO();
         if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
@@ -100,6 +112,15 @@ namespace ImGuiHelper
         }
     }
 
+    void SetPlatformWindowsEnabled(bool enabled)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        if (enabled)
+            io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+        else
+            io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+    }
+
     void Shutdown()
     {
         ImGui_ImplOpenGL3_Shutdown();
@@ -27,7 +27,14 @@ namespace ImGuiHelper
     };
 
     Viewport Begin();
-    void     End();
+    void     End(); // Render() then Present()
+    // builds the frame's draw data, no GL
+    void Render();
+    // draws the data from the last Render(), on whichever thread owns the GL context; the draw data stays
+    // valid until the next Begin()
+    void Present();
+    // platform windows are created and drawn through the main thread's context, the render thread turns them off
+    void SetPlatformWindowsEnabled(bool enabled);
     void     Shutdown();
 
 }
@@ -18,11 +18,13 @@ namespace CS200
 {
     Image::Image(const std::filesystem::path& image_path, bool flip_vertical)
     {
-        const std::filesystem::path image_path_ctor = assets::locate_asset(image_path);
+        // through the asset archive when one is mounted, a mapped file otherwise
+        const assets::AssetData file = assets::read_asset(image_path);
         stbi_set_flip_vertically_on_load(flip_vertical);
-        constexpr int num_channels       = 4;                                                                                                            // rgba
-        int           files_num_channels = 0;                                                                                                            // to here
-        image_data                       = stbi_load(image_path_ctor.string().c_str(), &dimensions.x, &dimensions.y, &files_num_channels, num_channels); // loading, use dynamic memory so we need free
+        constexpr int num_channels       = 4; // rgba
+        int           files_num_channels = 0; // to here
+        const auto*   encoded            = reinterpret_cast<const stbi_uc*>(file.bytes.data());
+        image_data = stbi_load_from_memory(encoded, gsl::narrow<int>(file.bytes.size()), &dimensions.x, &dimensions.y, &files_num_channels, num_channels); // loading, use dynamic memory so we need free
         if (!image_data)
         {
             throw_error_message("Loading Fail ");
@@ -123,6 +123,7 @@ namespace CS200
 
         draw_call = 0;
 		texture_call = 0;
+		upload_bytes = sizeof(camera_array);
     }
 
     void ImmediateRenderer2D::EndScene()
@@ -131,7 +132,12 @@ namespace CS200
     }
 
     void ImmediateRenderer2D::DrawQuad(
-		[[maybe_unused]] const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
+		const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
+    {
+        DrawQuad(Math::Affine2D(transform), texture, texture_coord_bl, texture_coord_tr, tintColor, depth);
+    }
+
+    void ImmediateRenderer2D::DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
     {
         //- Bind texture to texture unit 0
         GL::UseProgram(texturingCombineShader.Shader);
@@ -175,6 +181,7 @@ namespace CS200
         GL::DrawElements(primitive_pattern, quad.indicesCount, indices_type, byte_offset_into_indices);
 		++draw_call;
 		++texture_call;
+		upload_bytes += sizeof(world_transform_opengl) + sizeof(texture_transform) + sizeof(depth) + sizeof(colors) + sizeof(GLint);
         GL::BindTexture(GL_TEXTURE_2D, 0);
         GL::BindVertexArray(0);
         GL::UseProgram(0);
@@ -201,6 +208,52 @@ namespace CS200
         DrawLine(Math::TransformationMatrix{}, start_point, end_point, line_color, line_width, depth);
     }
 
+    void ImmediateRenderer2D::DrawSDFGlyph(
+        const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+        double outline_width, double glow_width, float depth)
+    {
+        GL::UseProgram(sdfShader.Shader);
+        const auto& locations = sdfShader.UniformLocations;
+
+        // vertex: the glyph quad is not grown by the line width like the shapes, the atlas padding already leaves room
+        GL::UniformMatrix3fv(locations.at("uModel"), 1, GL_FALSE, Renderer2DUtils::to_opengl_mat3(transform).data());
+        GL::Uniform2f(locations.at("uSDFScale"), 1.0f, 1.0f);
+        GL::Uniform1f(locations.at("uDepth"), depth);
+        GL::Uniform4f(
+            locations.at("uTexCoordRect"), static_cast<float>(texture_coord_bl.x), static_cast<float>(texture_coord_bl.y), static_cast<float>(texture_coord_tr.x - texture_coord_bl.x),
+            static_cast<float>(texture_coord_tr.y - texture_coord_bl.y));
+
+        // fragment
+        GL::Uniform4fv(locations.at("uFillColor"), 1, CS200::unpack_color(fill_color).data());
+        GL::Uniform4fv(locations.at("uLineColor"), 1, CS200::unpack_color(line_color).data());
+        GL::Uniform2f(locations.at("uWorldSize"), static_cast<float>(glow_width), 0.0f);
+        GL::Uniform1f(locations.at("uLineWidth"), static_cast<float>(outline_width));
+        GL::Uniform1i(locations.at("uShape"), static_cast<int>(SDFShape::Glyph));
+        GL::Uniform1i(locations.at("uGlyphAtlas"), 0);
+        GL::ActiveTexture(GL_TEXTURE0);
+        GL::BindTexture(GL_TEXTURE_2D, atlas);
+
+        GL::BindVertexArray(sdfVeretexArrayHandle);
+        GL::DrawElements(GL_TRIANGLES, quad.indicesCount, GL_UNSIGNED_BYTE, nullptr);
+        ++draw_call;
+        ++texture_call;
+        upload_bytes += 9 * sizeof(float) + 2 * sizeof(float) + sizeof(depth) + 4 * sizeof(float) + 2 * sizeof(std::array<float, 4>) + 3 * sizeof(float) + 2 * sizeof(GLint);
+
+        GL::BindTexture(GL_TEXTURE_2D, 0);
+        GL::BindVertexArray(0);
+        GL::UseProgram(0);
+    }
+
+    void ImmediateRenderer2D::DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth)
+    {
+        Renderer2DUtils::DrawParticlesAsQuads(*this, particles, texture, texture_coord_bl, texture_coord_tr, depth);
+    }
+
+    void ImmediateRenderer2D::DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth)
+    {
+        Renderer2DUtils::DrawGlyphQuadsAsQuads(*this, transform, quads, texture, tint, depth);
+    }
+
     void ImmediateRenderer2D::updateCameraUniformValues(const Math::TransformationMatrix& view_projection)
     {
         const auto as_3x3 = Renderer2DUtils::to_opengl_mat3(view_projection);
@@ -245,6 +298,7 @@ namespace CS200
         GL::DrawElements(primitive_pattern, quad.indicesCount, indices_type, byte_offset_into_indices);
 		++draw_call;
 		++texture_call;
+		upload_bytes += sizeof(sdf_transform) + sizeof(depth) + 2 * sizeof(std::array<float, 4>) + sizeof(float) + sizeof(GLint);
         // Shape rendering handled entirely in fragment shader
         GL::BindVertexArray(0);
         GL::UseProgram(0);
@@ -260,6 +314,11 @@ namespace CS200
 		return texture_call;
 	}
 
+	size_t ImmediateRenderer2D::GetUploadedBytesCounter()
+	{
+		return upload_bytes;
+	}
+
 
     ImmediateRenderer2D::ImmediateRenderer2D(ImmediateRenderer2D&& other) noexcept
 		: quad(other.quad),												   // 1.
@@ -271,7 +330,8 @@ namespace CS200
 		  camera_array(other.camera_array),								   // 7.
 		  currentCameraMatrix(other.currentCameraMatrix),				   // 8.
 		  draw_call(other.draw_call),									   // 9.
-		  texture_call(other.texture_call)								   // 10.
+		  texture_call(other.texture_call),								   // 10.
+		  upload_bytes(other.upload_bytes)								   // 11.
     {
 		other.quad.positionBufferHandle = 0;
 		other.quad.texCoordBufferHandle = 0;
@@ -287,6 +347,7 @@ namespace CS200
 
         other.draw_call	   = 0;
 		other.texture_call = 0;
+		other.upload_bytes = 0;
     }
 
     ImmediateRenderer2D& ImmediateRenderer2D::operator=(ImmediateRenderer2D&& other) noexcept
@@ -309,6 +370,7 @@ namespace CS200
 		std::swap(currentCameraMatrix, other.currentCameraMatrix);
 		std::swap(draw_call, other.draw_call);
 		std::swap(texture_call, other.texture_call);
+		std::swap(upload_bytes, other.upload_bytes);
 
 		return *this;
     }
@@ -200,6 +200,7 @@ namespace CS200
 		 */
 		void
 			DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
+		void DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
 
 		/**
 		 * \brief Draw a filled circle with optional outline using SDF rendering
@@ -253,6 +254,26 @@ namespace CS200
 		 * - Useful for simple line drawing without additional transformations
 		 */
 		void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth) override;
+		/**
+		 * \brief Draw one glyph of a distance field font atlas
+		 * \param transform World transformation of the glyph quad
+		 * \param atlas Distance field atlas texture
+		 * \param texture_coord_bl Bottom-left atlas texture coordinate of the glyph
+		 * \param texture_coord_tr Top-right atlas texture coordinate of the glyph
+		 * \param fill_color Color inside the glyph contour
+		 * \param line_color Color of the outline and glow
+		 * \param outline_width Outline width in atlas spread units (0..1)
+		 * \param glow_width Glow falloff beyond the outline in atlas spread units
+		 *
+		 * Implementation notes:
+		 * - Same SDF shader as circles and rectangles with uShape set to the glyph shape
+		 * - Atlas bound to texture unit 0, glyph rectangle passed through uTexCoordRect
+		 */
+		void DrawSDFGlyph(
+			const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+			double outline_width, double glow_width, float depth) override;
+		void DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth) override;
+		void DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth) override;
 
 
 	private:
@@ -290,6 +311,7 @@ namespace CS200
 		{
 			Circle	  = 0,
 			Rectangle = 1,
+			Glyph	  = 2,
 		};
 
 		/**
@@ -313,5 +335,8 @@ namespace CS200
 
 		size_t texture_call = 0;
 		size_t GetDrawTextureCounter() override;
+
+		size_t upload_bytes = 0;
+		size_t GetUploadedBytesCounter() override;
 	};
 }
@@ -14,9 +14,8 @@
 #include "OpenGL/VertexArray.h"
 #include "Renderer2DUtils.h"
 
-#include <fstream>
+#include <algorithm>
 #include <numeric>
-#include <sstream>
 
 namespace CS200
 
@@ -41,7 +40,14 @@ namespace CS200
           sdfInstanceData(std::move(other.sdfInstanceData)),
           sdfShader(std::move(other.sdfShader)),
           sdfModelHandle(other.sdfModelHandle),
+          sdfAtlas(other.sdfAtlas),
           maxSDFInstances(other.maxSDFInstances),
+          particleShader(std::move(other.particleShader)),
+          particleInstanceBufferHandle(other.particleInstanceBufferHandle),
+          particleModelHandle(other.particleModelHandle),
+          particleBufferCapacity(other.particleBufferCapacity),
+          particleTexCoordLocation(other.particleTexCoordLocation),
+          particleDepthLocation(other.particleDepthLocation),
           indexBufferHandle(other.indexBufferHandle),
           camera_uniform_buffer(other.camera_uniform_buffer),
           camera_array(other.camera_array),
@@ -50,7 +56,8 @@ namespace CS200
           textureSlots(std::move(other.textureSlots)),
           activeTextureSize(other.activeTextureSize),
           draw_call(other.draw_call),
-          texture_call(other.texture_call)
+          texture_call(other.texture_call),
+          upload_bytes(other.upload_bytes)
 	{
 		other.fixedVertexBufferHandle	 = 0;
 		other.instanceBufferHandle		 = 0;
@@ -58,17 +65,23 @@ namespace CS200
 		other.sdfFixedVertexBufferHandle = 0;
 		other.sdfInstanceBufferHandle	 = 0;
 		other.sdfModelHandle			 = 0;
+		other.sdfAtlas					 = 0;
+		other.particleInstanceBufferHandle = 0;
+		other.particleModelHandle		   = 0;
+		other.particleBufferCapacity	   = 0;
 		other.indexBufferHandle			 = 0;
 		other.camera_uniform_buffer		 = 0;
 
 		other.texturingCombineShader = {};
 		other.sdfShader				 = {};
+		other.particleShader		 = {};
 
 		other.maxInstances		= 0;
 		other.maxSDFInstances	= 0;
 		other.activeTextureSize = 0;
 		other.draw_call			= 0;
 		other.texture_call		= 0;
+		other.upload_bytes		= 0;
 	}
 
 	InstancedRenderer2D& InstancedRenderer2D::operator=(InstancedRenderer2D&& other) noexcept
@@ -84,8 +97,16 @@ namespace CS200
 		std::swap(sdfInstanceBufferHandle, other.sdfInstanceBufferHandle);
 		std::swap(sdfShader, other.sdfShader);
 		std::swap(sdfModelHandle, other.sdfModelHandle);
+		std::swap(sdfAtlas, other.sdfAtlas);
 		std::swap(maxSDFInstances, other.maxSDFInstances);
 
+		std::swap(particleShader, other.particleShader);
+		std::swap(particleInstanceBufferHandle, other.particleInstanceBufferHandle);
+		std::swap(particleModelHandle, other.particleModelHandle);
+		std::swap(particleBufferCapacity, other.particleBufferCapacity);
+		std::swap(particleTexCoordLocation, other.particleTexCoordLocation);
+		std::swap(particleDepthLocation, other.particleDepthLocation);
+
 		std::swap(indexBufferHandle, other.indexBufferHandle);
 		std::swap(camera_uniform_buffer, other.camera_uniform_buffer);
 		std::swap(camera_array, other.camera_array);
@@ -95,6 +116,7 @@ namespace CS200
 		std::swap(activeTextureSize, other.activeTextureSize);
 		std::swap(draw_call, other.draw_call);
 		std::swap(texture_call, other.texture_call);
+		std::swap(upload_bytes, other.upload_bytes);
 
 		return *this;
 	}
@@ -119,17 +141,8 @@ namespace CS200
 
 
 		// load shaders with parsing
-		const std::filesystem::path vertex_file = assets::locate_asset("Assets/shaders/InstancedRenderer2D/quad.vert");
-		std::ifstream				vert_stream(vertex_file);
-		std::stringstream			vert_text_stream;
-		vert_text_stream << vert_stream.rdbuf();
-		const std::string vertex_glsl = vert_text_stream.str();
-
-		const std::filesystem::path fragment_file = assets::locate_asset("Assets/shaders/InstancedRenderer2D/quad.frag");
-		std::ifstream				frag_stream(fragment_file);
-		std::stringstream			frag_text_stream;
-		frag_text_stream << frag_stream.rdbuf();
-		std::string frag_glsl = frag_text_stream.str();
+		const std::string vertex_glsl = std::string(assets::read_asset("Assets/shaders/InstancedRenderer2D/quad.vert").text());
+		std::string frag_glsl = std::string(assets::read_asset("Assets/shaders/InstancedRenderer2D/quad.frag").text());
 
 		const size_t	  first_newline = frag_glsl.find('\n');
 		const std::string define_line	= "\n#define MAX_TEXTURE_SLOTS " + std::to_string(textureSlots.size());
@@ -208,13 +221,40 @@ namespace CS200
 								  OpenGL::Attribute::Float.WithDivisor(1),				// Layout 6: aLineWidth
 								  OpenGL::Attribute::Int.WithDivisor(1),				// Layout 7: aShape (0=Circle, 1=Rect)
 								  OpenGL::Attribute::Float.WithDivisor(1),				// Layout 8: aDepth
+								  OpenGL::Attribute::Float4.WithDivisor(1),				// Layout 9: aTexCoordRect
 								  } }
 		};
 		sdfModelHandle = OpenGL::CreateVertexArrayObject(sdf_fix_instance, indexBufferHandle);
 
+		// glyph atlas always goes to unit 0, bound in flush after the textured quads are drawn
+		GL::UseProgram(sdfShader.Shader);
+		GL::Uniform1i(GL::GetUniformLocation(sdfShader.Shader, "uGlyphAtlas"), 0);
+		GL::UseProgram(0);
+
+		// particles reuse the textured quad's corner buffer, only the instance stream differs
+		particleShader = OpenGL::CreateShader(assets::locate_asset("Assets/shaders/InstancedRenderer2D/particle.vert"), assets::locate_asset("Assets/shaders/InstancedRenderer2D/particle.frag"));
+		particleBufferCapacity		 = maxInstances;
+		particleInstanceBufferHandle = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, static_cast<GLsizeiptr>(sizeof(ParticleInstance) * particleBufferCapacity));
+		const auto particle_fix_instance = {
+			OpenGL::VertexBuffer{	   fixedVertexBufferHandle, { OpenGL::Attribute::Float2, OpenGL::Attribute::Float2 } },
+			OpenGL::VertexBuffer{ particleInstanceBufferHandle,
+								  {
+								  OpenGL::Attribute::Float3.WithDivisor(1),				// Layout 2: aCenterSize
+								  OpenGL::Attribute::UByte4ToNormalized.WithDivisor(1), // Layout 3: aTint
+								  } }
+		};
+		particleModelHandle = OpenGL::CreateVertexArrayObject(particle_fix_instance, indexBufferHandle);
+
+		GL::UseProgram(particleShader.Shader);
+		GL::Uniform1i(GL::GetUniformLocation(particleShader.Shader, "uTexture"), 0);
+		particleTexCoordLocation = GL::GetUniformLocation(particleShader.Shader, "uTexCoordRect");
+		particleDepthLocation	 = GL::GetUniformLocation(particleShader.Shader, "uDepth");
+		GL::UseProgram(0);
+
 		camera_uniform_buffer = OpenGL::CreateBuffer(OpenGL::BufferType::UniformBlocks, sizeof(camera_array));
 		OpenGL::BindUniformBufferToShader(texturingCombineShader.Shader, 0, camera_uniform_buffer, "NDC");
 		OpenGL::BindUniformBufferToShader(sdfShader.Shader, 0, camera_uniform_buffer, "NDC");
+		OpenGL::BindUniformBufferToShader(particleShader.Shader, 0, camera_uniform_buffer, "NDC");
 	}
 
 	void InstancedRenderer2D::Shutdown()
@@ -222,16 +262,20 @@ namespace CS200
 	{
 		OpenGL::DestroyShader(texturingCombineShader);
 		OpenGL::DestroyShader(sdfShader);
+		OpenGL::DestroyShader(particleShader);
 
 		GL::DeleteBuffers(1, &fixedVertexBufferHandle), fixedVertexBufferHandle		  = 0;
 		GL::DeleteBuffers(1, &instanceBufferHandle), instanceBufferHandle			  = 0;
 		GL::DeleteBuffers(1, &sdfFixedVertexBufferHandle), sdfFixedVertexBufferHandle = 0;
 		GL::DeleteBuffers(1, &sdfInstanceBufferHandle), sdfInstanceBufferHandle		  = 0;
+		GL::DeleteBuffers(1, &particleInstanceBufferHandle), particleInstanceBufferHandle = 0;
 		GL::DeleteBuffers(1, &indexBufferHandle), indexBufferHandle					  = 0;
 		GL::DeleteBuffers(1, &camera_uniform_buffer), camera_uniform_buffer			  = 0;
 
 		GL::DeleteVertexArrays(1, &modelHandle), modelHandle	   = 0;
 		GL::DeleteVertexArrays(1, &sdfModelHandle), sdfModelHandle = 0;
+		GL::DeleteVertexArrays(1, &particleModelHandle), particleModelHandle = 0;
+		particleBufferCapacity = 0;
 
 		instanceData.clear();
 		sdfInstanceData.clear();
@@ -240,6 +284,7 @@ namespace CS200
 		activeTextureSize = 0;
 		draw_call		  = 0;
 		texture_call	  = 0;
+		upload_bytes	  = 0;
 	}
 
 	void InstancedRenderer2D::BeginScene(const Math::TransformationMatrix& view_projection)
@@ -259,6 +304,7 @@ namespace CS200
 
 		draw_call	 = 0;
 		texture_call = 0;
+		upload_bytes = sizeof(camera_array);
 		startBatch();
 	}
 
@@ -269,6 +315,11 @@ namespace CS200
 
 	void InstancedRenderer2D::DrawQuad(
 		const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
+	{
+		DrawQuad(Math::Affine2D(transform), texture, texture_coord_bl, texture_coord_tr, tintColor, depth);
+	}
+
+	void InstancedRenderer2D::DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth)
 	{
 		if (instanceData.size() >= maxInstances)
 		{
@@ -315,12 +366,12 @@ namespace CS200
 		instance.texScale[1] = top - bottom;
 		instance.texOffset[0] = left;
 		instance.texOffset[1] = bottom;
-		instance.transformrow0[0] = static_cast<float>(transform[0][0]);
-		instance.transformrow0[1] = static_cast<float>(transform[0][1]);
-		instance.transformrow0[2] = static_cast<float>(transform[0][2]);
-		instance.transformrow1[0] = static_cast<float>(transform[1][0]);
-		instance.transformrow1[1] = static_cast<float>(transform[1][1]);
-		instance.transformrow1[2] = static_cast<float>(transform[1][2]);
+		instance.transformrow0[0] = transform[0][0];
+		instance.transformrow0[1] = transform[0][1];
+		instance.transformrow0[2] = transform[0][2];
+		instance.transformrow1[0] = transform[1][0];
+		instance.transformrow1[1] = transform[1][1];
+		instance.transformrow1[2] = transform[1][2];
 		instance.tint = ColorArray(tintColor);
 		instance.depth			  = depth;
 
@@ -338,6 +389,7 @@ namespace CS200
 
 
 		sdfInstanceData.clear();
+		sdfAtlas = 0;
 	}
 
 	void InstancedRenderer2D::flush()
@@ -347,6 +399,7 @@ namespace CS200
 			GL::BindBuffer(GL_ARRAY_BUFFER, instanceBufferHandle);
 			GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(QuadInstance) * maxInstances), nullptr, GL_DYNAMIC_DRAW);
 			OpenGL::UpdateBufferData(OpenGL::BufferType::Vertices, instanceBufferHandle, std::as_bytes(std::span{ instanceData.data(), instanceData.size() }));
+			upload_bytes += sizeof(QuadInstance) * instanceData.size();
 
 			// select our texture
 			for (size_t i = 0; i < activeTextureSize; ++i)
@@ -366,7 +419,13 @@ namespace CS200
 			GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(SDFInstance) * maxSDFInstances), nullptr, GL_DYNAMIC_DRAW);
 
 			OpenGL::UpdateBufferData(OpenGL::BufferType::Vertices, sdfInstanceBufferHandle, std::as_bytes(std::span{ sdfInstanceData.data(), sdfInstanceData.size() }));
+			upload_bytes += sizeof(SDFInstance) * sdfInstanceData.size();
 
+			if (sdfAtlas != 0)
+			{
+				GL::ActiveTexture(GL_TEXTURE0);
+				GL::BindTexture(GL_TEXTURE_2D, sdfAtlas);
+			}
 			GL::UseProgram(sdfShader.Shader);
 			GL::BindVertexArray(sdfModelHandle);
 			GL::DrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr, static_cast<GLsizei>(sdfInstanceData.size()));
@@ -380,6 +439,113 @@ namespace CS200
 		startBatch();
 	}
 
+	void InstancedRenderer2D::DrawParticles(
+		std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth)
+	{
+		if (particles.empty())
+		{
+			return;
+		}
+		flush(); // keep draw order with whatever was queued before
+
+		GL::BindBuffer(GL_ARRAY_BUFFER, particleInstanceBufferHandle);
+		if (particles.size() > particleBufferCapacity)
+		{
+			// respecifying the store keeps the VAO binding, only the size changes
+			particleBufferCapacity = particles.size();
+		}
+		GL::BufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(ParticleInstance) * particleBufferCapacity), nullptr, GL_DYNAMIC_DRAW);
+		OpenGL::UpdateBufferData(OpenGL::BufferType::Vertices, particleInstanceBufferHandle, std::as_bytes(particles));
+		upload_bytes += particles.size_bytes() + 5 * sizeof(float);
+
+		GL::UseProgram(particleShader.Shader);
+		GL::Uniform4f(
+			particleTexCoordLocation, static_cast<float>(texture_coord_bl.x), static_cast<float>(texture_coord_bl.y), static_cast<float>(texture_coord_tr.x - texture_coord_bl.x),
+			static_cast<float>(texture_coord_tr.y - texture_coord_bl.y));
+		GL::Uniform1f(particleDepthLocation, depth);
+		GL::ActiveTexture(GL_TEXTURE0);
+		GL::BindTexture(GL_TEXTURE_2D, texture);
+		GL::BindVertexArray(particleModelHandle);
+		GL::DrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr, static_cast<GLsizei>(particles.size()));
+		++draw_call;
+		++texture_call;
+
+		GL::BindVertexArray(0);
+		GL::UseProgram(0);
+		GL::BindTexture(GL_TEXTURE_2D, 0);
+		GL::BindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void InstancedRenderer2D::DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth)
+	{
+		const std::array<unsigned char, 4> tint_bytes = ColorArray(tint);
+		const float						   m00		  = static_cast<float>(transform[0][0]);
+		const float						   m01		  = static_cast<float>(transform[0][1]);
+		const float						   m02		  = static_cast<float>(transform[0][2]);
+		const float						   m10		  = static_cast<float>(transform[1][0]);
+		const float						   m11		  = static_cast<float>(transform[1][1]);
+		const float						   m12		  = static_cast<float>(transform[1][2]);
+
+		// one instance per glyph, appended as a block and only split when the instance buffer runs out
+		size_t next = 0;
+		while (next < quads.size())
+		{
+			if (instanceData.size() >= maxInstances)
+			{
+				flush();
+			}
+
+			int	 tex_index = 0;
+			bool found	   = false;
+			for (size_t i = 0; i < activeTextureSize; ++i)
+			{
+				if (textureSlots[i] == texture)
+				{
+					found	  = true;
+					tex_index = static_cast<int>(i);
+				}
+			}
+			if (!found)
+			{
+				if (activeTextureSize >= textureSlots.size())
+				{
+					flush();
+				}
+				tex_index						= static_cast<int>(activeTextureSize);
+				textureSlots[activeTextureSize] = texture;
+				++activeTextureSize;
+			}
+
+			const size_t count = std::min(maxInstances - instanceData.size(), quads.size() - next);
+			for (const GlyphQuad& quad : quads.subspan(next, count))
+			{
+				// transform * translation(center) * scale(size) of the unit quad, written out
+				const float width  = quad.right - quad.left;
+				const float height = quad.top - quad.bottom;
+				const float cx	   = (quad.left + quad.right) * 0.5f;
+				const float cy	   = (quad.bottom + quad.top) * 0.5f;
+
+				QuadInstance instance;
+				instance.textureIndex	  = tex_index;
+				instance.texScale[0]	  = quad.s1 - quad.s0;
+				instance.texScale[1]	  = quad.t1 - quad.t0;
+				instance.texOffset[0]	  = quad.s0;
+				instance.texOffset[1]	  = quad.t0;
+				instance.transformrow0[0] = m00 * width;
+				instance.transformrow0[1] = m01 * height;
+				instance.transformrow0[2] = m00 * cx + m01 * cy + m02;
+				instance.transformrow1[0] = m10 * width;
+				instance.transformrow1[1] = m11 * height;
+				instance.transformrow1[2] = m10 * cx + m11 * cy + m12;
+				instance.tint			  = tint_bytes;
+				instance.depth			  = depth;
+				instanceData.push_back(instance);
+			}
+			next += count;
+		}
+		++texture_call;
+	}
+
 	void InstancedRenderer2D::DrawCircle(
 		[[maybe_unused]] const Math::TransformationMatrix& transform, [[maybe_unused]] CS200::RGBA fill_color, [[maybe_unused]] CS200::RGBA line_color, [[maybe_unused]] double line_width, float depth)
 	{
@@ -460,6 +626,47 @@ namespace CS200
 		++texture_call;
 	}
 
+	void InstancedRenderer2D::DrawSDFGlyph(
+		const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+		double outline_width, double glow_width, float depth)
+	{
+		if (instanceData.size() >= maxInstances)
+		{
+			flush();
+		}
+
+		if (sdfInstanceData.size() >= maxSDFInstances || (sdfAtlas != 0 && sdfAtlas != atlas))
+		{
+			flush();
+		}
+		sdfAtlas = atlas;
+
+		SDFInstance sdf_instance;
+
+		sdf_instance.transformrow0[0] = static_cast<float>(transform[0][0]);
+		sdf_instance.transformrow0[1] = static_cast<float>(transform[0][1]);
+		sdf_instance.transformrow0[2] = static_cast<float>(transform[0][2]);
+
+		sdf_instance.transformrow1[0] = static_cast<float>(transform[1][0]);
+		sdf_instance.transformrow1[1] = static_cast<float>(transform[1][1]);
+		sdf_instance.transformrow1[2] = static_cast<float>(transform[1][2]);
+
+		sdf_instance.fillColor		 = ColorArray(fill_color);
+		sdf_instance.lineColor		 = ColorArray(line_color);
+		sdf_instance.worldSize_x	 = static_cast<float>(glow_width);
+		sdf_instance.lineWidth		 = static_cast<float>(outline_width);
+		sdf_instance.shape			 = static_cast<int>(SDFShape::Glyph); // 2
+		sdf_instance.depth			 = depth;
+		sdf_instance.texCoordRect[0] = static_cast<float>(texture_coord_bl.x);
+		sdf_instance.texCoordRect[1] = static_cast<float>(texture_coord_bl.y);
+		sdf_instance.texCoordRect[2] = static_cast<float>(texture_coord_tr.x - texture_coord_bl.x);
+		sdf_instance.texCoordRect[3] = static_cast<float>(texture_coord_tr.y - texture_coord_bl.y);
+
+		sdfInstanceData.push_back(sdf_instance);
+
+		++texture_call;
+	}
+
 	void InstancedRenderer2D::DrawLine(
 		[[maybe_unused]] const Math::TransformationMatrix& transform, [[maybe_unused]] Math::vec2 start_point, [[maybe_unused]] Math::vec2 end_point, [[maybe_unused]] CS200::RGBA line_color,
 		[[maybe_unused]] double line_width, float depth)
@@ -499,4 +706,9 @@ namespace CS200
 	{
 		return texture_call;
 	}
+
+	size_t InstancedRenderer2D::GetUploadedBytesCounter()
+	{
+		return upload_bytes;
+	}
 }
\ No newline at end of file
@@ -48,12 +48,19 @@ namespace CS200
 		void EndScene() override;
 		void
 			DrawQuad(const Math::TransformationMatrix& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
+		void DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA tintColor, float depth) override;
 		// void DrawQuad(std::span<const float, 9> transform, OpenGL::Handle texture, std::span<const float, 4> texture_coords_lbrt, std::span<const float, 4> tint_color) override;
 
 		void DrawCircle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth) override;
 		void DrawRectangle(const Math::TransformationMatrix& transform, CS200::RGBA fill_color, CS200::RGBA line_color, double line_width, float depth) override;
 		void DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth) override;
 		void DrawLine(Math::vec2 start_point, Math::vec2 end_point, CS200::RGBA line_color, double line_width, float depth) override;
+		// uploads the span as is and draws it with one instanced call, the buffer grows to the largest span seen
+		void DrawSDFGlyph(
+			const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, CS200::RGBA fill_color, CS200::RGBA line_color,
+			double outline_width, double glow_width, float depth) override;
+		void DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth) override;
+		void DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, CS200::RGBA tint, float depth) override;
 
 	private:
 		struct QuadInstance // maybe we can make more compact? bit width, ...
@@ -83,10 +90,11 @@ namespace CS200
 			float						 transformrow1[3]{};			   // Layout 2: aModelRow1
 			std::array<unsigned char, 4> fillColor{};					   // Layout 3: aFillColor
 			std::array<unsigned char, 4> lineColor{};					   // Layout 4: aLineColor
-			float						 worldSize_x = 0, worldSize_y = 0; // Layout 5: aWorldSize
-			float						 lineWidth = 0;					   // Layout 6: aLineWidth
-			int							 shape	   = 0;					   // Layout 7: aShape (0=Circle, 1=Rect)
+			float						 worldSize_x = 0, worldSize_y = 0; // Layout 5: aWorldSize (glow width for glyphs)
+			float						 lineWidth = 0;					   // Layout 6: aLineWidth (outline width for glyphs)
+			int							 shape	   = 0;					   // Layout 7: aShape (0=Circle, 1=Rect, 2=Glyph)
 			float						 depth	   = 0.f;					   // Layout 8: aDepth
+			float						 texCoordRect[4]{};				   // Layout 9: aTexCoordRect, glyphs only
 		};
 
 		OpenGL::BufferHandle	  sdfFixedVertexBufferHandle{};
@@ -94,15 +102,25 @@ namespace CS200
 		std::vector<SDFInstance>  sdfInstanceData{};
 		OpenGL::CompiledShader	  sdfShader{};
 		OpenGL::VertexArrayHandle sdfModelHandle{};
+		OpenGL::TextureHandle	  sdfAtlas = 0; // glyph atlas of this batch, one per SDF draw call
 
 		unsigned maxSDFInstances = 0;
 
+		// particles: same unit quad, 16 byte instances straight from the caller's span
+		OpenGL::CompiledShader	  particleShader{};
+		OpenGL::BufferHandle	  particleInstanceBufferHandle{};
+		OpenGL::VertexArrayHandle particleModelHandle{};
+		size_t					  particleBufferCapacity = 0; // in instances
+		GLint					  particleTexCoordLocation = -1;
+		GLint					  particleDepthLocation	   = -1;
+
 		OpenGL::BufferHandle indexBufferHandle{};
 
 		enum class SDFShape : uint8_t
 		{
 			Circle	  = 0,
 			Rectangle = 1,
+			Glyph	  = 2,
 		};
 
 
@@ -136,6 +154,9 @@ namespace CS200
 
 		size_t texture_call = 0;
 		size_t GetDrawTextureCounter() override;
+
+		size_t upload_bytes = 0;
+		size_t GetUploadedBytesCounter() override;
 	};
 
 }
@@ -0,0 +1,347 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#include "RenderCommandList.h"
+
+#include "Engine/Affine2D.h"
+#include "Engine/Matrix.h"
+#include "RenderingAPI.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+	constexpr size_t CommandAlignment = 8;
+
+	constexpr size_t align_up(size_t size)
+	{
+		return (size + CommandAlignment - 1) & ~(CommandAlignment - 1);
+	}
+
+	struct Affine
+	{
+		float m00, m01, m02, m10, m11, m12;
+	};
+
+	// Math::Affine2D without its row padding
+	Affine to_affine(const Math::Affine2D& affine)
+	{
+		return { affine[0][0], affine[0][1], affine[0][2], affine[1][0], affine[1][1], affine[1][2] };
+	}
+
+	Affine to_affine(const Math::TransformationMatrix& matrix)
+	{
+		return to_affine(Math::Affine2D(matrix));
+	}
+
+	Math::Affine2D to_affine2d(const Affine& affine)
+	{
+		return { affine.m00, affine.m01, affine.m02, affine.m10, affine.m11, affine.m12 };
+	}
+
+	Math::TransformationMatrix to_matrix(const Affine& affine)
+	{
+		return to_affine2d(affine).ToMatrix();
+	}
+
+	struct Point
+	{
+		float x, y;
+	};
+
+	Point to_point(Math::vec2 v)
+	{
+		return { static_cast<float>(v.x), static_cast<float>(v.y) };
+	}
+
+	Math::vec2 to_vec2(Point p)
+	{
+		return { static_cast<double>(p.x), static_cast<double>(p.y) };
+	}
+
+	struct SceneCommand
+	{
+		Affine view_projection;
+	};
+
+	struct QuadCommand
+	{
+		Affine				  transform;
+		OpenGL::TextureHandle texture;
+		Point				  texture_coord_bl, texture_coord_tr;
+		CS200::RGBA			  tint;
+		float				  depth;
+	};
+
+	// circles and rectangles
+	struct ShapeCommand
+	{
+		Affine		transform;
+		CS200::RGBA fill_color, line_color;
+		float		line_width;
+		float		depth;
+	};
+
+	struct LineCommand
+	{
+		Affine		transform;
+		Point		start_point, end_point;
+		CS200::RGBA line_color;
+		float		line_width;
+		float		depth;
+	};
+
+	struct SDFGlyphCommand
+	{
+		Affine				  transform;
+		OpenGL::TextureHandle atlas;
+		Point				  texture_coord_bl, texture_coord_tr;
+		CS200::RGBA			  fill_color, line_color;
+		float				  outline_width, glow_width;
+		float				  depth;
+	};
+
+	// followed by count ParticleInstances
+	struct ParticlesCommand
+	{
+		uint32_t			  count;
+		OpenGL::TextureHandle texture;
+		Point				  texture_coord_bl, texture_coord_tr;
+		float				  depth;
+	};
+
+	// followed by count GlyphQuads
+	struct GlyphQuadsCommand
+	{
+		Affine				  transform;
+		uint32_t			  count;
+		OpenGL::TextureHandle texture;
+		CS200::RGBA			  tint;
+		float				  depth;
+	};
+
+	struct ColorCommand
+	{
+		CS200::RGBA color;
+	};
+
+	struct ViewportCommand
+	{
+		int width, height, x, y;
+	};
+
+	struct EmptyCommand
+	{
+	};
+
+	template <typename Command>
+	Command read(const std::byte* at)
+	{
+		static_assert(std::is_trivially_copyable_v<Command>);
+		Command command;
+		std::memcpy(&command, at, sizeof(Command));
+		return command;
+	}
+
+	template <typename T>
+	std::span<const T> read_trailing(const std::byte* command_at, size_t command_size, uint32_t count)
+	{
+		// push() copied the elements in with memcpy, which started their lifetime at an 8 byte aligned offset
+		return { reinterpret_cast<const T*>(command_at + align_up(command_size)), count };
+	}
+}
+
+namespace CS200
+{
+	void RenderCommandList::Reset()
+	{
+		bytes.clear();
+		command_count = 0;
+	}
+
+	template <typename Command>
+	void RenderCommandList::push(Op op, const Command& command, std::span<const std::byte> trailing)
+	{
+		static_assert(std::is_trivially_copyable_v<Command>);
+		const size_t header_size  = align_up(sizeof(Header));
+		const size_t command_size = std::is_empty_v<Command> ? 0 : align_up(sizeof(Command));
+		const size_t total		  = header_size + command_size + align_up(trailing.size());
+		const size_t offset		  = bytes.size();
+		bytes.resize(offset + total);
+
+		std::byte* const at		= bytes.data() + offset;
+		const Header	 header = { op, static_cast<uint32_t>(total) };
+		std::memcpy(at, &header, sizeof(Header));
+		if constexpr (!std::is_empty_v<Command>)
+		{
+			std::memcpy(at + header_size, &command, sizeof(Command));
+		}
+		if (!trailing.empty())
+		{
+			std::memcpy(at + header_size + command_size, trailing.data(), trailing.size());
+		}
+		++command_count;
+	}
+
+	void RenderCommandList::BeginScene(const Math::TransformationMatrix& view_projection)
+	{
+		push(Op::BeginScene, SceneCommand{ to_affine(view_projection) });
+	}
+
+	void RenderCommandList::EndScene()
+	{
+		push(Op::EndScene, EmptyCommand{});
+	}
+
+	void RenderCommandList::DrawQuad(
+		const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, RGBA tint, float depth)
+	{
+		push(Op::DrawQuad, QuadCommand{ to_affine(transform), texture, to_point(texture_coord_bl), to_point(texture_coord_tr), tint, depth });
+	}
+
+	void RenderCommandList::DrawCircle(const Math::TransformationMatrix& transform, RGBA fill_color, RGBA line_color, double line_width, float depth)
+	{
+		push(Op::DrawCircle, ShapeCommand{ to_affine(transform), fill_color, line_color, static_cast<float>(line_width), depth });
+	}
+
+	void RenderCommandList::DrawRectangle(const Math::TransformationMatrix& transform, RGBA fill_color, RGBA line_color, double line_width, float depth)
+	{
+		push(Op::DrawRectangle, ShapeCommand{ to_affine(transform), fill_color, line_color, static_cast<float>(line_width), depth });
+	}
+
+	void RenderCommandList::DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, RGBA line_color, double line_width, float depth)
+	{
+		push(Op::DrawLine, LineCommand{ to_affine(transform), to_point(start_point), to_point(end_point), line_color, static_cast<float>(line_width), depth });
+	}
+
+	void RenderCommandList::DrawLine(Math::vec2 start_point, Math::vec2 end_point, RGBA line_color, double line_width, float depth)
+	{
+		push(Op::DrawScreenLine, LineCommand{ {}, to_point(start_point), to_point(end_point), line_color, static_cast<float>(line_width), depth });
+	}
+
+	void RenderCommandList::DrawSDFGlyph(
+		const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, RGBA fill_color, RGBA line_color,
+		double outline_width, double glow_width, float depth)
+	{
+		push(
+			Op::DrawSDFGlyph, SDFGlyphCommand{ to_affine(transform), atlas, to_point(texture_coord_bl), to_point(texture_coord_tr), fill_color, line_color,
+											   static_cast<float>(outline_width), static_cast<float>(glow_width), depth });
+	}
+
+	void RenderCommandList::DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth)
+	{
+		if (particles.empty())
+		{
+			return;
+		}
+		push(
+			Op::DrawParticles, ParticlesCommand{ static_cast<uint32_t>(particles.size()), texture, to_point(texture_coord_bl), to_point(texture_coord_tr), depth },
+			std::as_bytes(particles));
+	}
+
+	void RenderCommandList::DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, RGBA tint, float depth)
+	{
+		if (quads.empty())
+		{
+			return;
+		}
+		push(Op::DrawGlyphQuads, GlyphQuadsCommand{ to_affine(transform), static_cast<uint32_t>(quads.size()), texture, tint, depth }, std::as_bytes(quads));
+	}
+
+	void RenderCommandList::SetClearColor(RGBA color)
+	{
+		push(Op::SetClearColor, ColorCommand{ color });
+	}
+
+	void RenderCommandList::Clear()
+	{
+		push(Op::Clear, EmptyCommand{});
+	}
+
+	void RenderCommandList::SetViewport(Math::ivec2 size, Math::ivec2 anchor_left_bottom)
+	{
+		push(Op::SetViewport, ViewportCommand{ size.x, size.y, anchor_left_bottom.x, anchor_left_bottom.y });
+	}
+
+	void RenderCommandList::Replay(IRenderer2D& renderer) const
+	{
+		const size_t		   header_size = align_up(sizeof(Header));
+		const std::byte*	   at		   = bytes.data();
+		const std::byte* const end		   = at + bytes.size();
+		while (at < end)
+		{
+			const Header	 header	 = read<Header>(at);
+			const std::byte* command = at + header_size;
+			switch (header.op)
+			{
+				case Op::BeginScene: renderer.BeginScene(to_matrix(read<SceneCommand>(command).view_projection)); break;
+				case Op::EndScene: renderer.EndScene(); break;
+				case Op::DrawQuad:
+				{
+					const auto c = read<QuadCommand>(command);
+					renderer.DrawQuad(to_affine2d(c.transform), c.texture, to_vec2(c.texture_coord_bl), to_vec2(c.texture_coord_tr), c.tint, c.depth);
+					break;
+				}
+				case Op::DrawCircle:
+				{
+					const auto c = read<ShapeCommand>(command);
+					renderer.DrawCircle(to_matrix(c.transform), c.fill_color, c.line_color, static_cast<double>(c.line_width), c.depth);
+					break;
+				}
+				case Op::DrawRectangle:
+				{
+					const auto c = read<ShapeCommand>(command);
+					renderer.DrawRectangle(to_matrix(c.transform), c.fill_color, c.line_color, static_cast<double>(c.line_width), c.depth);
+					break;
+				}
+				case Op::DrawLine:
+				{
+					const auto c = read<LineCommand>(command);
+					renderer.DrawLine(to_matrix(c.transform), to_vec2(c.start_point), to_vec2(c.end_point), c.line_color, static_cast<double>(c.line_width), c.depth);
+					break;
+				}
+				case Op::DrawScreenLine:
+				{
+					const auto c = read<LineCommand>(command);
+					renderer.DrawLine(to_vec2(c.start_point), to_vec2(c.end_point), c.line_color, static_cast<double>(c.line_width), c.depth);
+					break;
+				}
+				case Op::DrawSDFGlyph:
+				{
+					const auto c = read<SDFGlyphCommand>(command);
+					renderer.DrawSDFGlyph(
+						to_matrix(c.transform), c.atlas, to_vec2(c.texture_coord_bl), to_vec2(c.texture_coord_tr), c.fill_color, c.line_color, static_cast<double>(c.outline_width),
+						static_cast<double>(c.glow_width), c.depth);
+					break;
+				}
+				case Op::DrawParticles:
+				{
+					const auto c = read<ParticlesCommand>(command);
+					renderer.DrawParticles(
+						read_trailing<ParticleInstance>(command, sizeof(ParticlesCommand), c.count), c.texture, to_vec2(c.texture_coord_bl), to_vec2(c.texture_coord_tr), c.depth);
+					break;
+				}
+				case Op::DrawGlyphQuads:
+				{
+					const auto c = read<GlyphQuadsCommand>(command);
+					renderer.DrawGlyphQuads(to_matrix(c.transform), read_trailing<GlyphQuad>(command, sizeof(GlyphQuadsCommand), c.count), c.texture, c.tint, c.depth);
+					break;
+				}
+				case Op::SetClearColor: RenderingAPI::SetClearColor(read<ColorCommand>(command).color); break;
+				case Op::Clear: RenderingAPI::Clear(); break;
+				case Op::SetViewport:
+				{
+					const auto c = read<ViewportCommand>(command);
+					RenderingAPI::SetViewport({ c.width, c.height }, { c.x, c.y });
+					break;
+				}
+			}
+			at += header.size;
+		}
+	}
+}
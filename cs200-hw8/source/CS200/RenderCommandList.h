@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+#pragma once
+
+#include "IRenderer2D.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CS200
+{
+	/**
+	 * One frame of IRenderer2D and RenderingAPI calls, recorded so they can be issued later on the thread
+	 * that owns the GL context (Engine/RenderThread.h).
+	 *
+	 * Commands are packed back to back into one byte buffer that keeps its capacity between frames, so after
+	 * the first few frames recording does not allocate. Transforms are stored as the six float entries of the
+	 * 2x3 affine, which is all the renderers upload anyway. Spans (particles, glyph quads) are copied in,
+	 * the caller's storage only has to live until the call returns.
+	 */
+	class RenderCommandList
+	{
+	public:
+		void   Reset();
+		bool   Empty() const { return command_count == 0; }
+		size_t CommandCount() const { return command_count; }
+		size_t ByteSize() const { return bytes.size(); }
+
+		void BeginScene(const Math::TransformationMatrix& view_projection);
+		void EndScene();
+		void DrawQuad(const Math::Affine2D& transform, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, RGBA tint, float depth);
+		void DrawCircle(const Math::TransformationMatrix& transform, RGBA fill_color, RGBA line_color, double line_width, float depth);
+		void DrawRectangle(const Math::TransformationMatrix& transform, RGBA fill_color, RGBA line_color, double line_width, float depth);
+		void DrawLine(const Math::TransformationMatrix& transform, Math::vec2 start_point, Math::vec2 end_point, RGBA line_color, double line_width, float depth);
+		void DrawLine(Math::vec2 start_point, Math::vec2 end_point, RGBA line_color, double line_width, float depth);
+		void DrawSDFGlyph(
+			const Math::TransformationMatrix& transform, OpenGL::TextureHandle atlas, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, RGBA fill_color, RGBA line_color,
+			double outline_width, double glow_width, float depth);
+		void DrawParticles(std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth);
+		void DrawGlyphQuads(const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, RGBA tint, float depth);
+
+		// RenderingAPI state changes, kept in order with the draws around them
+		void SetClearColor(RGBA color);
+		void Clear();
+		void SetViewport(Math::ivec2 size, Math::ivec2 anchor_left_bottom);
+
+		// issues every command in recording order, the caller must own the GL context
+		void Replay(IRenderer2D& renderer) const;
+
+	private:
+		enum class Op : uint32_t
+		{
+			BeginScene,
+			EndScene,
+			DrawQuad,
+			DrawCircle,
+			DrawRectangle,
+			DrawLine,
+			DrawScreenLine,
+			DrawSDFGlyph,
+			DrawParticles,
+			DrawGlyphQuads,
+			SetClearColor,
+			Clear,
+			SetViewport
+		};
+
+		// every command starts with one, size covers the header, the command and any trailing span
+		struct Header
+		{
+			Op		 op;
+			uint32_t size;
+		};
+
+		template <typename Command>
+		void push(Op op, const Command& command, std::span<const std::byte> trailing = {});
+
+		std::vector<std::byte> bytes;
+		size_t				   command_count = 0;
+	};
+}
@@ -43,4 +43,27 @@ namespace CS200::Renderer2DUtils
         quad_transform[4] *= scale_up[1];
         return { quad_transform, world_size, quad_size };
     }
+
+    void DrawParticlesAsQuads(IRenderer2D& renderer, std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth)
+    {
+        for (const ParticleInstance& particle : particles)
+        {
+            const RGBA tint = (static_cast<RGBA>(particle.tint[0]) << 24) | (static_cast<RGBA>(particle.tint[1]) << 16) | (static_cast<RGBA>(particle.tint[2]) << 8) | particle.tint[3];
+            const Math::TransformationMatrix transform =
+                Math::TranslationMatrix(Math::vec2{ static_cast<double>(particle.x), static_cast<double>(particle.y) }) * Math::ScaleMatrix(static_cast<double>(particle.size));
+            renderer.DrawQuad(transform, texture, texture_coord_bl, texture_coord_tr, tint, depth);
+        }
+    }
+
+    void DrawGlyphQuadsAsQuads(IRenderer2D& renderer, const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, RGBA tint, float depth)
+    {
+        for (const GlyphQuad& quad : quads)
+        {
+            const Math::vec2 center{ (static_cast<double>(quad.left) + static_cast<double>(quad.right)) * 0.5, (static_cast<double>(quad.bottom) + static_cast<double>(quad.top)) * 0.5 };
+            const Math::vec2 size{ static_cast<double>(quad.right - quad.left), static_cast<double>(quad.top - quad.bottom) };
+            renderer.DrawQuad(
+                transform * Math::TranslationMatrix(center) * Math::ScaleMatrix(size), texture, Math::vec2{ static_cast<double>(quad.s0), static_cast<double>(quad.t0) },
+                Math::vec2{ static_cast<double>(quad.s1), static_cast<double>(quad.t1) }, tint, depth);
+        }
+    }
 }
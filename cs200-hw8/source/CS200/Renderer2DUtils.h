@@ -7,8 +7,10 @@
  */
 #pragma once
 
+#include "Engine/Affine2D.h"
 #include "Engine/Matrix.h"
 #include "Engine/Vec2.h"
+#include "IRenderer2D.h"
 #include "RGBA.h"
 #include <array>
 #include <optional>
@@ -27,6 +29,11 @@ namespace CS200::Renderer2DUtils
                  static_cast<float>(transform[0][2]), static_cast<float>(transform[1][2]), static_cast<float>(transform[2][2]) };
     }
 
+    inline mat3 to_opengl_mat3(const Math::Affine2D& transform) noexcept
+    {
+        return { transform[0][0], transform[1][0], 0.0f, transform[0][1], transform[1][1], 0.0f, transform[0][2], transform[1][2], 1.0f };
+    }
+
     
     Math::TransformationMatrix CalculateLineTransform(const Math::TransformationMatrix& transform, const Math::vec2& start_point, const Math::vec2& end_point, double line_width) noexcept;
 
@@ -40,4 +47,10 @@ namespace CS200::Renderer2DUtils
 
     
     SDFTransform CalculateSDFTransform(const Math::TransformationMatrix& transform, double line_width) noexcept;
+
+    // DrawParticles for renderers without an instanced path: one DrawQuad per particle
+    void DrawParticlesAsQuads(IRenderer2D& renderer, std::span<const ParticleInstance> particles, OpenGL::TextureHandle texture, Math::vec2 texture_coord_bl, Math::vec2 texture_coord_tr, float depth);
+
+    // DrawGlyphQuads for renderers without a batch to append to: one DrawQuad per glyph
+    void DrawGlyphQuadsAsQuads(IRenderer2D& renderer, const Math::TransformationMatrix& transform, std::span<const GlyphQuad> quads, OpenGL::TextureHandle texture, RGBA tint, float depth);
 }
@@ -12,6 +12,7 @@
 #include "Engine/Error.h"
 #include "Engine/Logger.h"
 #include "OpenGL/Environment.h"
+#include "RenderCommandList.h"
 #include <GL/glew.h>
 #include <cassert>
 
@@ -19,6 +20,8 @@
 
 namespace
 {
+    thread_local CS200::RenderCommandList* gRecording = nullptr;
+
 #if defined(DEVELOPER_VERSION) && not defined(IS_WEBGL2)
     void OpenGLMessageCallback(
         [[maybe_unused]] unsigned source, [[maybe_unused]] unsigned type, [[maybe_unused]] unsigned id, unsigned severity, [[maybe_unused]] int length, const char* message,
@@ -82,33 +85,53 @@ namespace CS200::RenderingAPI
 		GL::Enable(GL_DEPTH_TEST);
 
         // GL_MAX_TEXTURE_IMAGE_UNITS, GL_MAX_TEXTURE_SIZE, GL_MAX_VIEWPORT_DIMS
-        Engine::GetLogger().LogDebug("VENDOR : " + std::to_string(GL_VENDOR));
-        Engine::GetLogger().LogDebug("RENDERER : " + std::to_string(GL_RENDERER));
-        Engine::GetLogger().LogDebug("VERSION : " + std::to_string(GL_VERSION));
-        Engine::GetLogger().LogDebug("SHADING LANGUAGE VERSION : " + std::to_string(GL_SHADING_LANGUAGE_VERSION));
-        Engine::GetLogger().LogDebug("MAJOR VERSION : " + std::to_string(OpenGL::MajorVersion));
-        Engine::GetLogger().LogDebug("MINOR VERSION : " + std::to_string(OpenGL::MinorVersion));
-        Engine::GetLogger().LogDebug("MAX ELEMENTS VERTICES : " + std::to_string(max_element_vertices));
-        Engine::GetLogger().LogDebug("MAX ELEMENTS INDICES : " + std::to_string(max_element_indices));
-        Engine::GetLogger().LogDebug("MAX TEXTURE IMAGE UNITS : " + std::to_string(OpenGL::MaxTextureImageUnits));
-        Engine::GetLogger().LogDebug("MAX TEXTURE SIZE : " + std::to_string(OpenGL::MaxTextureSize));
-        Engine::GetLogger().LogDebug("MAX VIEWPORT DIMS : " + std::to_string(max_viewport_dims[0]) + ", " + std::to_string(max_viewport_dims[1]));
+        LOG_DEBUG("VENDOR : {}", GL_VENDOR);
+        LOG_DEBUG("RENDERER : {}", GL_RENDERER);
+        LOG_DEBUG("VERSION : {}", GL_VERSION);
+        LOG_DEBUG("SHADING LANGUAGE VERSION : {}", GL_SHADING_LANGUAGE_VERSION);
+        LOG_DEBUG("MAJOR VERSION : {}", OpenGL::MajorVersion);
+        LOG_DEBUG("MINOR VERSION : {}", OpenGL::MinorVersion);
+        LOG_DEBUG("MAX ELEMENTS VERTICES : {}", max_element_vertices);
+        LOG_DEBUG("MAX ELEMENTS INDICES : {}", max_element_indices);
+        LOG_DEBUG("MAX TEXTURE IMAGE UNITS : {}", OpenGL::MaxTextureImageUnits);
+        LOG_DEBUG("MAX TEXTURE SIZE : {}", OpenGL::MaxTextureSize);
+        LOG_DEBUG("MAX VIEWPORT DIMS : {}, {}", max_viewport_dims[0], max_viewport_dims[1]);
     }
 
     void SetClearColor(CS200::RGBA color) noexcept
     {
+        if (gRecording != nullptr)
+        {
+            gRecording->SetClearColor(color);
+            return;
+        }
         const auto rgba = CS200::unpack_color(color);
         GL::ClearColor(rgba[0], rgba[1], rgba[2], rgba[3]);
     }
 
     void Clear() noexcept
     {
+        if (gRecording != nullptr)
+        {
+            gRecording->Clear();
+            return;
+        }
         //GL::Clear(GL_COLOR_BUFFER_BIT);
 		GL::Clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
     void SetViewport(Math::ivec2 size, Math::ivec2 anchor_left_bottom) noexcept
     {
+        if (gRecording != nullptr)
+        {
+            gRecording->SetViewport(size, anchor_left_bottom);
+            return;
+        }
         GL::Viewport(anchor_left_bottom.x, anchor_left_bottom.y, size.x, size.y);
     }
+
+    void RecordInto(RenderCommandList* list) noexcept
+    {
+        gRecording = list;
+    }
 }
@@ -10,10 +10,19 @@
 #include "Engine/Vec2.h"
 #include "RGBA.h"
 
+namespace CS200
+{
+    class RenderCommandList;
+}
+
 namespace CS200::RenderingAPI
 {
     void Init() noexcept;
     void SetClearColor(CS200::RGBA color) noexcept;
     void Clear() noexcept;
     void SetViewport(Math::ivec2 size, Math::ivec2 anchor_left_bottom = { 0, 0 }) noexcept;
+
+    // while a list is set, SetClearColor, Clear and SetViewport called on this thread are appended to it instead
+    // of going to GL; the Engine sets it around the frame it records for the render thread. nullptr stops recording.
+    void RecordInto(RenderCommandList* list) noexcept;
 }
@@ -101,6 +101,10 @@ void DemoDepthPost::Load()
 	// sort ducks by depth back to front(painter's algorithm)
 	std::sort(std::begin(ducks), std::end(ducks), [](const Duck& left, const Duck& right) { return left.depth > right.depth; });
 
+	auto* feathers = new CS230::GPUParticleEmitter("Assets/images/DemoDepthPost/duck.png", NUM_FEATHERS, 1.5, 24.0);
+	feathers->SetGravity({ 0.0, -600.0 });
+	AddGSComponent(feathers);
+
 	// msaa settings
 	const auto use_msaa = useMSAA ? OffscreenFramebuffer::MSAA::True : OffscreenFramebuffer::MSAA::False;
 	offscreenBuffer.Initialize(default_window_size.x, default_window_size.y, use_msaa, MSAASamples);
@@ -165,7 +169,7 @@ void DemoDepthPost::Load()
 	}
 }
 
-void DemoDepthPost::Update([[maybe_unused]] double dt)
+void DemoDepthPost::Update(double dt)
 {
 	// Update FPS tracker
 	const Uint32 currentTicks = SDL_GetTicks();
@@ -174,6 +178,21 @@ void DemoDepthPost::Update([[maybe_unused]] double dt)
 	LastTicks				  = currentTicks;
 	FPSTracker.Update(deltaSeconds);
 
+	UpdateGSComponents(dt);
+	if (Engine::GetInput().KeyJustPressed(CS230::Input::Keys::Space))
+	{
+		auto* feathers = GetGSComponent<CS230::GPUParticleEmitter>();
+		for (const auto& duck : ducks)
+		{
+#if defined(__EMSCRIPTEN__)
+			const Math::vec2 position = duck.position + Math::vec2{ -500, -500 };
+#else
+			const Math::vec2 position = duck.position;
+#endif
+			feathers->Emit(FEATHERS_PER_DUCK, position, { 0.0, 0.0 }, { 0.0, 500.0 }, 2.5, duck.color);
+		}
+	}
+
 	if (Engine::GetInput().KeyJustReleased(CS230::Input::Keys::Escape))
 	{
 		Engine::GetGameStateManager().PopState();
@@ -183,6 +202,7 @@ void DemoDepthPost::Update([[maybe_unused]] double dt)
 
 void DemoDepthPost::Unload()
 {
+	ClearGSComponents();
 	offscreenBuffer.Shutdown();
 	postProcessing.Shutdown();
 	if (screenVAO != 0)
@@ -250,6 +270,11 @@ void DemoDepthPost::Draw()
 	GL::DepthMask(GL_TRUE); // enable depth write
 	renderer_2d->EndScene();
 
+	// straight to GL after the batch is flushed, it still uses the batch's NDC block and the depth buffer
+	GL::DepthMask(GL_FALSE);
+	GetGSComponent<CS230::GPUParticleEmitter>()->Draw(Math::TransformationMatrix(), FEATHER_DEPTH);
+	GL::DepthMask(GL_TRUE);
+
 	// 2. Resolve (MSAA -> Texture) & PostProcess
 	OpenGL::TextureHandle scene_texture = offscreenBuffer.GetTexture();
 	OpenGL::TextureHandle final_texture = scene_texture;
@@ -292,6 +317,7 @@ void DemoDepthPost::DrawImGui()
 	ImGui::Begin("Demo Depth & Post-Processing Controls");
 	// Display FPS at the top
 	ImGui::Text("FPS: %d", static_cast<int>(FPSTracker));
+	ImGui::Text("Space: spray feathers from every duck");
 	ImGui::Separator();
 
 	ImGui::SeparatorText("Depth Settings");
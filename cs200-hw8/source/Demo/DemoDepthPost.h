@@ -10,6 +10,7 @@
 
 #include "Engine/FPS.h"
 #include "Engine/GameObjectManager.h"
+#include "Engine/GPUParticleEmitter.h"
 #include "Engine/GameState.h"
 #include "Engine/Particle.h"
 #include "Engine/Vec2.h"
@@ -33,6 +34,12 @@ public:
 		return "Demo Depth & Post-Processing";
 	}
 
+	// renders through its own framebuffers and post processing passes
+	bool CanDrawOnRenderThread() const override
+	{
+		return false;
+	}
+
 private:
 	struct BackGroundLayer
 	{
@@ -57,6 +64,11 @@ private:
 	static constexpr size_t		NUM_DUCKS = 10;
 	std::array<Duck, NUM_DUCKS> ducks{};
 
+	// space sprays every duck, simulated and drawn on the GPU into the offscreen buffer
+	static constexpr size_t NUM_FEATHERS	  = 4'096;
+	static constexpr size_t FEATHERS_PER_DUCK = 64;
+	static constexpr float	FEATHER_DEPTH	  = -0.95f; // in front of the nearest duck
+
 	util::FPS FPSTracker;
 	Uint32	  LastTicks = 0;
 
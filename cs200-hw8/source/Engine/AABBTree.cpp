@@ -0,0 +1,266 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  AABBTree.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "AABBTree.h"
+
+namespace CS230
+{
+    AABBTree::Box AABBTree::merge(const Box& a, const Box& b)
+    {
+        return { std::min(a.min_x, b.min_x), std::min(a.min_y, b.min_y), std::max(a.max_x, b.max_x), std::max(a.max_y, b.max_y) };
+    }
+
+    bool AABBTree::contains(const Box& outer, const Box& inner)
+    {
+        return outer.min_x <= inner.min_x && outer.min_y <= inner.min_y && inner.max_x <= outer.max_x && inner.max_y <= outer.max_y;
+    }
+
+    Math::rect AABBTree::GetFatBounds(ProxyId proxy) const
+    {
+        const Box& box = nodes[static_cast<size_t>(proxy)].box;
+        return { { box.min_x, box.min_y }, { box.max_x, box.max_y } };
+    }
+
+    AABBTree::ProxyId AABBTree::allocate_node()
+    {
+        if (free_list == NullProxy)
+        {
+            nodes.push_back(Node{});
+            return static_cast<ProxyId>(nodes.size() - 1);
+        }
+        const ProxyId id = free_list;
+        free_list        = node_at(id).parent;
+        node_at(id)      = Node{};
+        return id;
+    }
+
+    void AABBTree::free_node(ProxyId id)
+    {
+        Node& node  = node_at(id);
+        node.parent = free_list;
+        node.height = -1;
+        free_list   = id;
+    }
+
+    AABBTree::ProxyId AABBTree::CreateProxy(const Math::rect& bounds, uint32_t user_data)
+    {
+        const ProxyId id = allocate_node();
+        Node&         leaf = node_at(id);
+        Box           box  = to_box(bounds);
+        box.min_x -= FatMargin;
+        box.min_y -= FatMargin;
+        box.max_x += FatMargin;
+        box.max_y += FatMargin;
+        leaf.box       = box;
+        leaf.user_data = user_data;
+        leaf.height    = 0;
+        insert_leaf(id);
+        ++proxy_count;
+        return id;
+    }
+
+    void AABBTree::DestroyProxy(ProxyId proxy)
+    {
+        remove_leaf(proxy);
+        free_node(proxy);
+        --proxy_count;
+    }
+
+    bool AABBTree::MoveProxy(ProxyId proxy, const Math::rect& bounds, Math::vec2 displacement)
+    {
+        const Box tight = to_box(bounds);
+        if (contains(node_at(proxy).box, tight))
+        {
+            return false;
+        }
+
+        remove_leaf(proxy);
+        Box fat{ tight.min_x - FatMargin, tight.min_y - FatMargin, tight.max_x + FatMargin, tight.max_y + FatMargin };
+        // stretch towards where the object is heading so a steady mover reinserts every few frames, not every frame
+        const Math::vec2 predicted = displacement * DisplacementFactor;
+        (predicted.x < 0.0 ? fat.min_x : fat.max_x) += predicted.x;
+        (predicted.y < 0.0 ? fat.min_y : fat.max_y) += predicted.y;
+        node_at(proxy).box = fat;
+        insert_leaf(proxy);
+        return true;
+    }
+
+    void AABBTree::Clear()
+    {
+        nodes.clear();
+        root        = NullProxy;
+        free_list   = NullProxy;
+        proxy_count = 0;
+    }
+
+    void AABBTree::insert_leaf(ProxyId leaf)
+    {
+        if (root == NullProxy)
+        {
+            root                = leaf;
+            node_at(leaf).parent = NullProxy;
+            return;
+        }
+
+        // walk down picking the cheaper side, cost = perimeter added to the tree (2D surface area heuristic)
+        const Box leaf_box = node_at(leaf).box;
+        ProxyId   index    = root;
+        while (!node_at(index).IsLeaf())
+        {
+            const Node&  node         = node_at(index);
+            const double area         = perimeter(node.box);
+            const double combined     = perimeter(merge(node.box, leaf_box));
+            const double pair_cost    = 2.0 * combined;             // new parent here, holding this node and the leaf
+            const double inheritance  = 2.0 * (combined - area);    // growth every ancestor pays if we go deeper
+
+            const auto descend_cost = [&](ProxyId child_id)
+            {
+                const Node&  child = node_at(child_id);
+                const double grown = perimeter(merge(leaf_box, child.box));
+                return (child.IsLeaf() ? grown : grown - perimeter(child.box)) + inheritance;
+            };
+            const double cost1 = descend_cost(node.child1);
+            const double cost2 = descend_cost(node.child2);
+            if (pair_cost < cost1 && pair_cost < cost2)
+            {
+                break;
+            }
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const ProxyId sibling    = index;
+        const ProxyId old_parent = node_at(sibling).parent;
+        const ProxyId new_parent = allocate_node();
+        Node&         parent     = node_at(new_parent);
+        parent.parent            = old_parent;
+        parent.box               = merge(leaf_box, node_at(sibling).box);
+        parent.height            = node_at(sibling).height + 1;
+        parent.child1            = sibling;
+        parent.child2            = leaf;
+
+        if (old_parent != NullProxy)
+        {
+            Node& grand = node_at(old_parent);
+            (grand.child1 == sibling ? grand.child1 : grand.child2) = new_parent;
+        }
+        else
+        {
+            root = new_parent;
+        }
+        node_at(sibling).parent = new_parent;
+        node_at(leaf).parent    = new_parent;
+
+        refit_from(new_parent);
+    }
+
+    void AABBTree::remove_leaf(ProxyId leaf)
+    {
+        if (leaf == root)
+        {
+            root = NullProxy;
+            return;
+        }
+
+        const ProxyId parent      = node_at(leaf).parent;
+        const ProxyId grandparent = node_at(parent).parent;
+        const ProxyId sibling     = node_at(parent).child1 == leaf ? node_at(parent).child2 : node_at(parent).child1;
+
+        if (grandparent != NullProxy)
+        {
+            Node& grand = node_at(grandparent);
+            (grand.child1 == parent ? grand.child1 : grand.child2) = sibling;
+            node_at(sibling).parent = grandparent;
+            free_node(parent);
+            refit_from(grandparent);
+        }
+        else
+        {
+            root                    = sibling;
+            node_at(sibling).parent = NullProxy;
+            free_node(parent);
+        }
+    }
+
+    void AABBTree::refit_from(ProxyId index)
+    {
+        while (index != NullProxy)
+        {
+            index       = balance(index);
+            Node& node  = node_at(index);
+            node.height = 1 + std::max(node_at(node.child1).height, node_at(node.child2).height);
+            node.box    = merge(node_at(node.child1).box, node_at(node.child2).box);
+            index       = node.parent;
+        }
+    }
+
+    // Rotates the taller child up when the heights of a's children differ by more than one.
+    // Returns the node now sitting where a was.
+    AABBTree::ProxyId AABBTree::balance(ProxyId index_a)
+    {
+        Node& a = node_at(index_a);
+        if (a.IsLeaf() || a.height < 2)
+        {
+            return index_a;
+        }
+
+        const ProxyId index_b = a.child1;
+        const ProxyId index_c = a.child2;
+        Node&         b       = node_at(index_b);
+        Node&         c       = node_at(index_c);
+        const int     skew    = c.height - b.height;
+
+        // move `up` into a's place, a becomes its child and keeps the shorter grandchild
+        const auto rotate = [&](ProxyId index_up, Node& up, Node& stay, ProxyId& a_slot_for_grandchild, bool up_was_child2)
+        {
+            const ProxyId index_f = up.child1;
+            const ProxyId index_g = up.child2;
+            Node&         f       = node_at(index_f);
+            Node&         g       = node_at(index_g);
+
+            up.child1 = index_a;
+            up.parent = a.parent;
+            a.parent  = index_up;
+            if (up.parent != NullProxy)
+            {
+                Node& up_parent = node_at(up.parent);
+                (up_parent.child1 == index_a ? up_parent.child1 : up_parent.child2) = index_up;
+            }
+            else
+            {
+                root = index_up;
+            }
+
+            const bool    f_taller = f.height > g.height;
+            const ProxyId keep     = f_taller ? index_f : index_g;
+            const ProxyId give     = f_taller ? index_g : index_f;
+            Node&         kept     = node_at(keep);
+            Node&         given    = node_at(give);
+
+            up.child2             = keep;
+            a_slot_for_grandchild = give;
+            given.parent          = index_a;
+            a.box                 = up_was_child2 ? merge(stay.box, given.box) : merge(given.box, stay.box);
+            a.height              = 1 + std::max(stay.height, given.height);
+            up.box                = merge(a.box, kept.box);
+            up.height             = 1 + std::max(a.height, kept.height);
+        };
+
+        if (skew > 1)
+        {
+            rotate(index_c, c, b, a.child2, true);
+            return index_c;
+        }
+        if (skew < -1)
+        {
+            rotate(index_b, b, c, a.child1, false);
+            return index_b;
+        }
+        return index_a;
+    }
+}
@@ -0,0 +1,190 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  AABBTree.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "Rect.h"
+#include "Vec2.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace CS230
+{
+    // Dynamic bounding volume tree for colliders that stay around between frames.
+    // Leaves store a fat box (the real box grown by a margin and by the last displacement) so objects that jiggle
+    // or stand still never touch the tree. Leaves are inserted next to the sibling with the lowest surface area cost,
+    // and AVL style rotations on the way back up keep the tree balanced, so queries stay O(log n).
+    class AABBTree
+    {
+    public:
+        using ProxyId = int32_t;
+        static constexpr ProxyId NullProxy = -1;
+
+        static constexpr double FatMargin          = 4.0; // world units added around every leaf
+        static constexpr double DisplacementFactor = 2.0; // how many frames of movement the fat box predicts
+
+        ProxyId CreateProxy(const Math::rect& bounds, uint32_t user_data);
+        void    DestroyProxy(ProxyId proxy);
+        // returns true when the proxy had to be reinserted, false while bounds stay inside its fat box
+        bool    MoveProxy(ProxyId proxy, const Math::rect& bounds, Math::vec2 displacement);
+        void    Clear();
+
+        uint32_t   GetUserData(ProxyId proxy) const { return nodes[static_cast<size_t>(proxy)].user_data; }
+        Math::rect GetFatBounds(ProxyId proxy) const;
+        int        Height() const { return root == NullProxy ? 0 : nodes[static_cast<size_t>(root)].height; }
+        size_t     ProxyCount() const { return proxy_count; }
+
+        // callback(ProxyId) -> bool, return false to stop the query
+        template <typename Callback>
+        void QueryPoint(Math::vec2 point, Callback&& callback) const;
+        template <typename Callback>
+        void QueryRegion(const Math::rect& region, Callback&& callback) const;
+        // callback(ProxyId, double max_fraction) -> double: the new max fraction of the segment from..to,
+        // so returning the hit fraction clips the ray to the closest hit and 0 stops
+        template <typename Callback>
+        void RayCast(Math::vec2 from, Math::vec2 to, Callback&& callback) const;
+
+    private:
+        struct Box
+        {
+            double min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+        };
+
+        struct Node
+        {
+            Box      box{};
+            ProxyId  parent = NullProxy; // next free node while unused
+            ProxyId  child1 = NullProxy;
+            ProxyId  child2 = NullProxy;
+            int      height = -1;        // 0 for leaves, -1 for free nodes
+            uint32_t user_data = 0;
+
+            bool IsLeaf() const { return child1 == NullProxy; }
+        };
+
+        static Box    to_box(const Math::rect& rect) { return { rect.Left(), rect.Bottom(), rect.Right(), rect.Top() }; }
+        static Box    merge(const Box& a, const Box& b);
+        static double perimeter(const Box& box) { return 2.0 * ((box.max_x - box.min_x) + (box.max_y - box.min_y)); }
+        static bool   contains(const Box& outer, const Box& inner);
+        static bool   overlaps(const Box& a, const Box& b) { return a.min_x <= b.max_x && b.min_x <= a.max_x && a.min_y <= b.max_y && b.min_y <= a.max_y; }
+
+        ProxyId allocate_node();
+        void    free_node(ProxyId node);
+        void    insert_leaf(ProxyId leaf);
+        void    remove_leaf(ProxyId leaf);
+        void    refit_from(ProxyId node);
+        ProxyId balance(ProxyId node);
+
+        Node& node_at(ProxyId id) { return nodes[static_cast<size_t>(id)]; }
+
+        std::vector<Node> nodes;
+        ProxyId           root        = NullProxy;
+        ProxyId           free_list   = NullProxy;
+        size_t            proxy_count = 0;
+
+        mutable std::vector<ProxyId> stack; // traversal scratch, queries run on one thread
+    };
+
+    template <typename Callback>
+    void AABBTree::QueryPoint(Math::vec2 point, Callback&& callback) const
+    {
+        QueryRegion(Math::rect{ point, point }, callback);
+    }
+
+    template <typename Callback>
+    void AABBTree::QueryRegion(const Math::rect& region, Callback&& callback) const
+    {
+        if (root == NullProxy)
+        {
+            return;
+        }
+        const Box query = to_box(region);
+        stack.clear();
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            const ProxyId id = stack.back();
+            stack.pop_back();
+            const Node& node = nodes[static_cast<size_t>(id)];
+            if (!overlaps(node.box, query))
+            {
+                continue;
+            }
+            if (node.IsLeaf())
+            {
+                if (!callback(id))
+                {
+                    return;
+                }
+            }
+            else
+            {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    template <typename Callback>
+    void AABBTree::RayCast(Math::vec2 from, Math::vec2 to, Callback&& callback) const
+    {
+        if (root == NullProxy)
+        {
+            return;
+        }
+        const Math::vec2 direction = to - from;
+        // segment normal, for the separating axis test against each box
+        const Math::vec2 normal{ -direction.y, direction.x };
+        const Math::vec2 abs_normal{ std::abs(normal.x), std::abs(normal.y) };
+
+        double max_fraction = 1.0;
+        Box    segment_box{ std::min(from.x, to.x), std::min(from.y, to.y), std::max(from.x, to.x), std::max(from.y, to.y) };
+
+        stack.clear();
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            const ProxyId id = stack.back();
+            stack.pop_back();
+            const Node& node = nodes[static_cast<size_t>(id)];
+            if (!overlaps(node.box, segment_box))
+            {
+                continue;
+            }
+            const Math::vec2 center{ (node.box.min_x + node.box.max_x) * 0.5, (node.box.min_y + node.box.max_y) * 0.5 };
+            const Math::vec2 half{ (node.box.max_x - node.box.min_x) * 0.5, (node.box.max_y - node.box.min_y) * 0.5 };
+            const double     separation = std::abs(normal.x * (from.x - center.x) + normal.y * (from.y - center.y)) - (abs_normal.x * half.x + abs_normal.y * half.y);
+            if (separation > 0.0)
+            {
+                continue;
+            }
+            if (!node.IsLeaf())
+            {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+                continue;
+            }
+
+            const double value = callback(id, max_fraction);
+            if (value <= 0.0)
+            {
+                return;
+            }
+            if (value < max_fraction)
+            {
+                max_fraction = value;
+                const Math::vec2 end = from + direction * max_fraction;
+                segment_box          = { std::min(from.x, end.x), std::min(from.y, end.y), std::max(from.x, end.x), std::max(from.y, end.y) };
+            }
+        }
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "Affine2D.h"
+#include "Matrix.h"
+
+#include <cassert>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define AFFINE2D_SSE
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define AFFINE2D_NEON
+#endif
+
+static_assert(sizeof(Math::fvec2) == 2 * sizeof(float), "TransformPoints reads fvec2 spans as packed floats");
+
+namespace Math
+{
+    Affine2D::Affine2D(const TransformationMatrix& matrix) noexcept
+        : Affine2D(
+              static_cast<float>(matrix[0][0]), static_cast<float>(matrix[0][1]), static_cast<float>(matrix[0][2]), static_cast<float>(matrix[1][0]), static_cast<float>(matrix[1][1]),
+              static_cast<float>(matrix[1][2]))
+    {
+    }
+
+    Affine2D Affine2D::Translation(vec2 translate) noexcept
+    {
+        return { 1.0f, 0.0f, static_cast<float>(translate.x), 0.0f, 1.0f, static_cast<float>(translate.y) };
+    }
+
+    Affine2D Affine2D::Rotation(double theta) noexcept
+    {
+        const float c = static_cast<float>(std::cos(theta));
+        const float s = static_cast<float>(std::sin(theta));
+        return { c, -s, 0.0f, s, c, 0.0f };
+    }
+
+    Affine2D Affine2D::Scale(vec2 scale) noexcept
+    {
+        return { static_cast<float>(scale.x), 0.0f, 0.0f, 0.0f, static_cast<float>(scale.y), 0.0f };
+    }
+
+    Affine2D Affine2D::FromTRS(vec2 translate, double theta, vec2 scale) noexcept
+    {
+        const float c  = static_cast<float>(std::cos(theta));
+        const float s  = static_cast<float>(std::sin(theta));
+        const float sx = static_cast<float>(scale.x);
+        const float sy = static_cast<float>(scale.y);
+        return { c * sx, -s * sy, static_cast<float>(translate.x), s * sx, c * sy, static_cast<float>(translate.y) };
+    }
+
+    Affine2D Affine2D::operator*(const Affine2D& rhs) const noexcept
+    {
+        // row i of the product is lhs[i][0] * rhs row 0 + lhs[i][1] * rhs row 1 + (0, 0, lhs[i][2], 0)
+        Affine2D result;
+#if defined(AFFINE2D_SSE)
+        const __m128 b0     = _mm_load_ps(rhs.rows[0]);
+        const __m128 b1     = _mm_load_ps(rhs.rows[1]);
+        const __m128 z_lane = _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, 0));
+        for (int i = 0; i < 2; ++i)
+        {
+            const __m128 a  = _mm_load_ps(rows[i]);
+            const __m128 xy = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), b0), _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+            _mm_store_ps(result.rows[i], _mm_add_ps(xy, _mm_and_ps(a, z_lane)));
+        }
+#elif defined(AFFINE2D_NEON)
+        const float32x4_t b0 = vld1q_f32(rhs.rows[0]);
+        const float32x4_t b1 = vld1q_f32(rhs.rows[1]);
+        for (int i = 0; i < 2; ++i)
+        {
+            const float32x4_t xy = vmlaq_n_f32(vmulq_n_f32(b0, rows[i][0]), b1, rows[i][1]);
+            vst1q_f32(result.rows[i], vsetq_lane_f32(vgetq_lane_f32(xy, 2) + rows[i][2], xy, 2));
+        }
+#else
+        for (int i = 0; i < 2; ++i)
+        {
+            result.rows[i][0] = rows[i][0] * rhs.rows[0][0] + rows[i][1] * rhs.rows[1][0];
+            result.rows[i][1] = rows[i][0] * rhs.rows[0][1] + rows[i][1] * rhs.rows[1][1];
+            result.rows[i][2] = rows[i][0] * rhs.rows[0][2] + rows[i][1] * rhs.rows[1][2] + rows[i][2];
+        }
+#endif
+        return result;
+    }
+
+    Affine2D& Affine2D::operator*=(const Affine2D& rhs) noexcept
+    {
+        *this = *this * rhs;
+        return *this;
+    }
+
+    Affine2D Affine2D::Inverse() const noexcept
+    {
+        // inverse of the 2x2 part, then the translation moved back through it; a dozen flops, so it stays
+        // scalar, packing the cofactors into registers costs more shuffles than it saves
+        const float m00 = rows[0][0], m01 = rows[0][1], m02 = rows[0][2];
+        const float m10 = rows[1][0], m11 = rows[1][1], m12 = rows[1][2];
+        const float det = m00 * m11 - m01 * m10;
+        if (std::abs(det) < 1e-5f)
+        {
+            return {};
+        }
+        const float inv_det = 1.0f / det;
+        const float i00     = m11 * inv_det;
+        const float i01     = -m01 * inv_det;
+        const float i10     = -m10 * inv_det;
+        const float i11     = m00 * inv_det;
+        return { i00, i01, -(i00 * m02 + i01 * m12), i10, i11, -(i10 * m02 + i11 * m12) };
+    }
+
+    fvec2 Affine2D::operator*(fvec2 point) const noexcept
+    {
+        return { rows[0][0] * point.x + rows[0][1] * point.y + rows[0][2], rows[1][0] * point.x + rows[1][1] * point.y + rows[1][2] };
+    }
+
+    vec2 Affine2D::operator*(vec2 point) const noexcept
+    {
+        const fvec2 result = *this * fvec2{ static_cast<float>(point.x), static_cast<float>(point.y) };
+        return { static_cast<double>(result.x), static_cast<double>(result.y) };
+    }
+
+    void Affine2D::TransformPoints(std::span<const fvec2> in, std::span<fvec2> out) const noexcept
+    {
+        assert(out.size() >= in.size());
+        size_t i = 0;
+#if defined(AFFINE2D_SSE)
+        // (x0 y0 x1 y1) -> (m00 x0 + m01 y0 + m02, m10 x0 + m11 y0 + m12, ...) for two points at a time
+        const __m128 x_scale = _mm_setr_ps(rows[0][0], rows[1][0], rows[0][0], rows[1][0]);
+        const __m128 y_scale = _mm_setr_ps(rows[0][1], rows[1][1], rows[0][1], rows[1][1]);
+        const __m128 offset  = _mm_setr_ps(rows[0][2], rows[1][2], rows[0][2], rows[1][2]);
+        for (; i + 2 <= in.size(); i += 2)
+        {
+            const __m128 p  = _mm_loadu_ps(&in[i].x);
+            const __m128 xs = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m128 ys = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+            _mm_storeu_ps(&out[i].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, x_scale), _mm_mul_ps(ys, y_scale)), offset));
+        }
+#elif defined(AFFINE2D_NEON)
+        const float       x_values[4] = { rows[0][0], rows[1][0], rows[0][0], rows[1][0] };
+        const float       y_values[4] = { rows[0][1], rows[1][1], rows[0][1], rows[1][1] };
+        const float       t_values[4] = { rows[0][2], rows[1][2], rows[0][2], rows[1][2] };
+        const float32x4_t x_scale     = vld1q_f32(x_values);
+        const float32x4_t y_scale     = vld1q_f32(y_values);
+        const float32x4_t offset      = vld1q_f32(t_values);
+        for (; i + 2 <= in.size(); i += 2)
+        {
+            const float32x4_t   p  = vld1q_f32(&in[i].x);
+            const float32x4x2_t xy = vtrnq_f32(p, p); // (x0 x0 x1 x1), (y0 y0 y1 y1)
+            vst1q_f32(&out[i].x, vmlaq_f32(vmlaq_f32(offset, xy.val[0], x_scale), xy.val[1], y_scale));
+        }
+#endif
+        for (; i < in.size(); ++i)
+        {
+            out[i] = *this * in[i];
+        }
+    }
+
+    TransformationMatrix Affine2D::ToMatrix() const
+    {
+        TransformationMatrix matrix;
+        for (int r = 0; r < 2; ++r)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                matrix[r][c] = static_cast<double>(rows[r][c]);
+            }
+        }
+        return matrix;
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "Vec2.h"
+
+#include <span>
+
+namespace Math
+{
+    class TransformationMatrix;
+
+    // Float 2D affine transform. The bottom row of a 2D TransformationMatrix is always 0 0 1, so only
+    //     | m00 m01 m02 |
+    //     | m10 m11 m12 |
+    // is kept, and composing two of them is 12 multiplies instead of 27. Each row is padded with a zero to
+    // four floats so it loads as one SSE/NEON register; the padding is what keeps compose branch and shuffle free.
+    class alignas(16) Affine2D
+    {
+    public:
+        constexpr Affine2D() noexcept : rows{ { 1.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f, 0.0f } }
+        {
+        }
+
+        constexpr Affine2D(float m00, float m01, float m02, float m10, float m11, float m12) noexcept : rows{ { m00, m01, m02, 0.0f }, { m10, m11, m12, 0.0f } }
+        {
+        }
+
+        // drops the bottom row, which is 0 0 1 for every matrix built from translate, rotate and scale
+        explicit Affine2D(const TransformationMatrix& matrix) noexcept;
+
+        static Affine2D Translation(vec2 translate) noexcept;
+        static Affine2D Rotation(double theta) noexcept;
+        static Affine2D Scale(vec2 scale) noexcept;
+        // Translation(translate) * Rotation(theta) * Scale(scale), written out instead of multiplied
+        static Affine2D FromTRS(vec2 translate, double theta, vec2 scale) noexcept;
+
+        float* operator[](int row) noexcept
+        {
+            return rows[row];
+        }
+
+        const float* operator[](int row) const noexcept
+        {
+            return rows[row];
+        }
+
+        Affine2D  operator*(const Affine2D& rhs) const noexcept;
+        Affine2D& operator*=(const Affine2D& rhs) noexcept;
+        // identity when the transform can't be inverted, like TransformationMatrix::Inverse
+        Affine2D Inverse() const noexcept;
+
+        fvec2 operator*(fvec2 point) const noexcept;
+        vec2  operator*(vec2 point) const noexcept;
+        // out[i] = *this * in[i] for every point of in, two points per SIMD step; out may be the same span as in
+        void TransformPoints(std::span<const fvec2> in, std::span<fvec2> out) const noexcept;
+
+        TransformationMatrix ToMatrix() const;
+
+        bool operator==(const Affine2D&) const = default;
+
+    private:
+        float rows[2][4];
+    };
+
+    static_assert(sizeof(Affine2D) == 32);
+}
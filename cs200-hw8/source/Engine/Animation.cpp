@@ -8,10 +8,27 @@ Author:     Taekyung Ho
 Created:    April 16, 2025
 */
 #include "Animation.h"
+#include "Engine.h"
 #include "Logger.h"
 #include "Path.h"
 
-CS230::Animation::Animation(const std::filesystem::path& animation_file) : current_command(0)
+#include <bit>
+#include <sstream>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define ANIMATION_PLAYER_SSE
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define ANIMATION_PLAYER_NEON
+#endif
+
+namespace {
+    constexpr float never = std::numeric_limits<float>::infinity();
+}
+
+CS230::AnimationData::AnimationData(const std::filesystem::path& animation_file)
 {
     const std::filesystem::path anm_path = assets::locate_asset(animation_file);
 
@@ -20,143 +37,191 @@ CS230::Animation::Animation(const std::filesystem::path& animation_file) : curre
         throw std::runtime_error(animation_file.generic_string() + " is not a .anm file");
     }
 
-
-    std::ifstream in_file(anm_path);
-    if (in_file.is_open() == false)
-    {
-        throw std::runtime_error("Failed to load " + animation_file.generic_string());
-    }
-
-    std::string command;
-    while (in_file.eof() == false)
+    std::istringstream in_file{ std::string(assets::read_asset(anm_path).text()) };
+
+    // raw command list first, Loop indices in the file count every command
+    enum class CommandType { PlayFrame, Loop, End };
+    struct RawCommand {
+        CommandType type;
+        size_t      value; // frame for PlayFrame, command index for Loop
+        float       duration;
+    };
+    std::vector<RawCommand> raw;
+    std::string             command;
+    while (in_file >> command)
     {
-        in_file >> command;
         if (command == "PlayFrame")
         {
             size_t frame;
             float  target_time;
             in_file >> frame;
             in_file >> target_time;
-
-            commands.push_back(new PlayFrame(frame, static_cast<double>(target_time)));
+            raw.push_back({ CommandType::PlayFrame, frame, target_time });
         }
         else if (command == "Loop")
         {
             size_t loop_to_frame;
             in_file >> loop_to_frame;
-            commands.push_back(new Loop(loop_to_frame));
+            raw.push_back({ CommandType::Loop, loop_to_frame, 0.f });
         }
         else if (command == "End")
         {
-            commands.push_back(new End());
+            raw.push_back({ CommandType::End, 0, 0.f });
         }
         else
         {
-            Engine::GetLogger().LogError(command + " in " + animation_file.generic_string());
+            LOG_ERROR("{} in {}", command, animation_file.generic_string());
         }
     }
-    Reset();
-}
 
-CS230::Animation::Animation() : Animation("./Assets/animations/None.anm")
-{
-}
-
-CS230::Animation::~Animation()
-{
-    for (Command* command : commands)
+    // frame index of every PlayFrame command
+    std::vector<uint32_t> frame_of_command(raw.size(), AnimationFrame::EndOfAnimation);
+    for (size_t i = 0; i < raw.size(); ++i)
     {
-        delete command;
+        if (raw[i].type == CommandType::PlayFrame)
+        {
+            frame_of_command[i] = static_cast<uint32_t>(compiled.size());
+            compiled.push_back({ static_cast<uint32_t>(raw[i].value), raw[i].duration, AnimationFrame::EndOfAnimation });
+        }
+    }
+    if (compiled.empty() || raw.front().type != CommandType::PlayFrame)
+    {
+        throw std::runtime_error(animation_file.generic_string() + " does not start with a PlayFrame");
     }
-    commands.clear();
-}
 
-void CS230::Animation::Update(double dt)
-{
-    current_frame->Update(dt);
-    if (current_frame->Ended() == true)
+    // resolve what follows each frame, running off the end behaves like End
+    for (size_t i = 0; i < raw.size(); ++i)
     {
-        current_frame->ResetTime();
-        current_command++;
-        if (commands[current_command]->Type() == CommandType::PlayFrame)
+        if (raw[i].type != CommandType::PlayFrame || i + 1 >= raw.size())
+        {
+            continue;
+        }
+        const RawCommand& after = raw[i + 1];
+        uint32_t          next  = AnimationFrame::EndOfAnimation;
+        if (after.type == CommandType::PlayFrame)
         {
-            current_frame = static_cast<PlayFrame*>(commands[current_command]);
+            next = frame_of_command[i + 1];
         }
-        else if (commands[current_command]->Type() == CommandType::Loop)
+        else if (after.type == CommandType::Loop)
         {
-            Loop* loop_data = static_cast<Loop*>(commands[current_command]);
-            current_command = loop_data->LoopIndex();
-            if (commands[current_command]->Type() == CommandType::PlayFrame)
+            if (after.value >= raw.size() || raw[after.value].type != CommandType::PlayFrame)
             {
-                current_frame = static_cast<PlayFrame*>(commands[current_command]);
+                // logged and played as a restart from the first frame instead of failing the load
+                LOG_ERROR("Loop does not go to PlayFrame in {}", animation_file.generic_string());
+                next = 0;
             }
             else
             {
-                Engine::GetLogger().LogError("Loop does not go to PlayFrame");
-                Reset();
+                next = frame_of_command[after.value];
             }
         }
-        else if (commands[current_command]->Type() == CommandType::End)
-        {
-            ended = true;
-        }
+        compiled[frame_of_command[i]].next = next;
     }
+    frames = compiled;
 }
 
-size_t CS230::Animation::CurrentFrame()
+CS230::AnimationPlayer::Id CS230::AnimationPlayer::Create()
 {
-    return current_frame->Frame();
-}
-
-void CS230::Animation::Reset()
-{
-    current_command = 0;
-    ended           = false;
-    current_frame   = static_cast<PlayFrame*>(commands[current_command]);
-    current_frame->ResetTime();
+    if (free_ids.empty())
+    {
+        // grow a whole block at a time so the kernel never reads past the end
+        const size_t old_size = timer.size();
+        const size_t new_size = old_size + BlockSize;
+        frames.resize(new_size, nullptr);
+        command.resize(new_size, 0);
+        timer.resize(new_size, 0.f);
+        duration.resize(new_size, never);
+        ended.resize(new_size, 0);
+        for (size_t slot = new_size; slot > old_size; --slot)
+        {
+            free_ids.push_back(static_cast<Id>(slot - 1));
+        }
+    }
+    const Id id = free_ids.back();
+    free_ids.pop_back();
+    return id;
 }
 
-bool CS230::Animation::Ended()
+void CS230::AnimationPlayer::Release(Id id)
 {
-    return ended;
+    if (id == InvalidId)
+    {
+        return;
+    }
+    frames[id]   = nullptr;
+    duration[id] = never;
+    ended[id]    = 0;
+    free_ids.push_back(id);
 }
 
-CS230::Animation::PlayFrame::PlayFrame(size_t _frame, double duration) : frame(_frame), target_time(duration), timer(0.0)
+void CS230::AnimationPlayer::Play(Id id, const AnimationData& animation)
 {
+    frames[id]   = animation.Frames().data();
+    command[id]  = 0;
+    timer[id]    = 0.f;
+    duration[id] = frames[id][0].duration;
+    ended[id]    = 0;
 }
 
-void CS230::Animation::PlayFrame::Update(double dt)
+void CS230::AnimationPlayer::advance_slot(size_t slot)
 {
-    timer += dt;
+    // same as the old PlayFrame/Loop/End walk: the timer restarts, End keeps showing the last frame
+    timer[slot]                 = 0.f;
+    const AnimationFrame& frame = frames[slot][command[slot]];
+    if (frame.next == AnimationFrame::EndOfAnimation)
+    {
+        ended[slot]    = 1;
+        duration[slot] = never;
+        return;
+    }
+    command[slot]  = frame.next;
+    duration[slot] = frames[slot][frame.next].duration;
 }
 
-bool CS230::Animation::PlayFrame::Ended()
+void CS230::AnimationPlayer::AdvanceAll(double dt)
 {
-    if (timer >= target_time)
+    const float  step  = static_cast<float>(dt);
+    const size_t count = timer.size();
+#if defined(ANIMATION_PLAYER_SSE)
+    const __m128 step4 = _mm_set1_ps(step);
+    for (size_t i = 0; i < count; i += BlockSize)
     {
-        return true;
+        const __m128 time = _mm_add_ps(_mm_loadu_ps(&timer[i]), step4);
+        _mm_storeu_ps(&timer[i], time);
+        int done = _mm_movemask_ps(_mm_cmpge_ps(time, _mm_loadu_ps(&duration[i])));
+        while (done != 0)
+        {
+            const int lane = std::countr_zero(static_cast<unsigned>(done));
+            advance_slot(i + static_cast<size_t>(lane));
+            done &= done - 1;
+        }
     }
-    else
+#elif defined(ANIMATION_PLAYER_NEON)
+    const float32x4_t step4 = vdupq_n_f32(step);
+    for (size_t i = 0; i < count; i += BlockSize)
     {
-        return false;
+        const float32x4_t time = vaddq_f32(vld1q_f32(&timer[i]), step4);
+        vst1q_f32(&timer[i], time);
+        const uint32x4_t done = vcgeq_f32(time, vld1q_f32(&duration[i]));
+        if (vmaxvq_u32(done) != 0)
+        {
+            for (size_t lane = 0; lane < BlockSize; ++lane)
+            {
+                if (timer[i + lane] >= duration[i + lane])
+                {
+                    advance_slot(i + lane);
+                }
+            }
+        }
     }
-}
-
-void CS230::Animation::PlayFrame::ResetTime()
-{
-    timer = 0.0;
-}
-
-size_t CS230::Animation::PlayFrame::Frame()
-{
-    return frame;
-}
-
-CS230::Animation::Loop::Loop(size_t _loop_index) : loop_index(_loop_index)
-{
-}
-
-size_t CS230::Animation::Loop::LoopIndex()
-{
-    return loop_index;
+#else
+    for (size_t i = 0; i < count; ++i)
+    {
+        timer[i] += step;
+        if (timer[i] >= duration[i])
+        {
+            advance_slot(i);
+        }
+    }
+#endif
 }
@@ -9,68 +9,80 @@ Created:    April 16, 2025
 */
 
 #pragma once
-#include <vector>
+#include <cstdint>
 #include <filesystem>
-#include "Engine.h"
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CS230 {
-    class Animation {
+    // One compiled step of an animation. Loop and End commands are folded away at load time:
+    // every entry is a frame and next already points at the frame that follows it (through any Loop),
+    // or is EndOfAnimation.
+    struct AnimationFrame {
+        static constexpr uint32_t EndOfAnimation = std::numeric_limits<uint32_t>::max();
+
+        uint32_t frame;
+        float    duration;
+        uint32_t next;
+    };
+    static_assert(std::is_trivially_copyable_v<AnimationFrame>);
+
+    // The compiled .anm file. Immutable once loaded and shared by every Sprite that uses the same file,
+    // load it through SpriteDefinitionCache::LoadAnimation.
+    class AnimationData {
     public:
-        Animation();
-        Animation(const std::filesystem::path& animation_file);
-        ~Animation();
+        explicit AnimationData(const std::filesystem::path& animation_file);
+        // already compiled frames, next indices have to be valid
+        explicit AnimationData(std::vector<AnimationFrame> compiled_frames) : compiled(std::move(compiled_frames)), frames(compiled) {}
+        // frames that live in storage, e.g. a mapped .anmb file, used without a copy
+        AnimationData(std::span<const AnimationFrame> baked_frames, std::shared_ptr<const void> owner) : storage(std::move(owner)), frames(baked_frames) {}
+
+        AnimationData(const AnimationData&)            = delete;
+        AnimationData& operator=(const AnimationData&) = delete;
+
+        std::span<const AnimationFrame> Frames() const { return frames; }
 
-        void Update(double dt);
-        size_t CurrentFrame();
-        void Reset();
-        bool Ended();
     private:
-        enum class CommandType {
-            PlayFrame,
-            Loop,
-            End,
-        };
-        class Command {
-        public:
-            virtual ~Command() {}
-            virtual CommandType Type() = 0;
-        };
+        std::vector<AnimationFrame>     compiled;
+        std::shared_ptr<const void>     storage;
+        std::span<const AnimationFrame> frames; // into compiled or storage
+    };
+
+    // Playback state of every Sprite, structure-of-arrays: per slot only the playing frame index and its timer
+    // (plus the frame's duration, copied so the time compare never has to look at the AnimationData).
+    // AdvanceAll() moves every slot forward in one 4-wide pass; only slots whose frame ran out take the scalar path.
+    // Every GameState owns one (Engine::GetAnimationPlayer), so only the top state's sprites advance.
+    class AnimationPlayer {
+    public:
+        using Id = uint32_t;
+        static constexpr Id     InvalidId = std::numeric_limits<Id>::max();
+        static constexpr size_t BlockSize = 4;
 
+        Id   Create();
+        void Release(Id id);
 
-        class End : public Command {
-        public:
-            virtual CommandType Type() override { return CommandType::End; }
-        private:
-        };
+        // starts animation from its first frame, the data has to outlive the playback (Sprite keeps it alive)
+        void Play(Id id, const AnimationData& animation);
 
+        void AdvanceAll(double dt);
 
-        class Loop : public Command {
-        public:
-            Loop(size_t loop_index);
-            virtual CommandType Type() override { return CommandType::Loop; }
-            size_t LoopIndex();
-        private:
-            size_t loop_index;
-        };
+        size_t CurrentFrame(Id id) const { return frames[id] != nullptr ? frames[id][command[id]].frame : 0; }
+        bool   Ended(Id id) const { return ended[id] != 0; }
 
-        class PlayFrame : public Command {
-        public:
-            PlayFrame(size_t frame, double duration);
-            virtual CommandType Type() override { return CommandType::PlayFrame; }
-            void Update(double dt);
-            bool Ended();
-            void ResetTime();
-            size_t Frame();
-        private:
-            size_t frame;
-            double target_time;
-            double timer;
-        };
+        size_t Count() const { return timer.size() - free_ids.size(); }
 
-        size_t current_command;
-        std::vector<Command*> commands;
-        bool ended;
-        PlayFrame* current_frame;
+    private:
+        void advance_slot(size_t slot);
+
+        std::vector<const AnimationFrame*> frames; // playing animation of each slot, nullptr while idle
+        std::vector<uint32_t>              command;
+        std::vector<float>                 timer;
+        std::vector<float>                 duration; // +inf for idle, free and ended slots so they never advance
+        std::vector<uint8_t>               ended;
+        std::vector<Id>                    free_ids;
     };
 }
-
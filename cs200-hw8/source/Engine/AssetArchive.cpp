@@ -0,0 +1,235 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  AssetArchive.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "AssetArchive.h"
+#include "Lz4.h"
+#include "MappedFile.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    constexpr size_t align_up(size_t offset, size_t alignment)
+    {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+
+    template <typename T>
+    void write_at(std::vector<std::byte>& bytes, size_t offset, const T& value)
+    {
+        std::memcpy(bytes.data() + offset, &value, sizeof(T));
+    }
+}
+
+namespace CS230
+{
+    uint64_t AssetArchive::hash_key(std::string_view key)
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ull;
+        for (const char c : key)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::string AssetArchive::MakeKey(const std::filesystem::path& asset_path)
+    {
+        std::string key = asset_path.lexically_normal().generic_string();
+        while (key.starts_with("./"))
+        {
+            key.erase(0, 2);
+        }
+        return key;
+    }
+
+    std::vector<std::byte> AssetArchive::Build(std::span<const PackEntry> pack_entries)
+    {
+        if constexpr (std::endian::native != std::endian::little)
+        {
+            throw std::runtime_error("Asset archives are little-endian, pack them on a little-endian machine");
+        }
+
+        const auto entry_count  = static_cast<uint32_t>(pack_entries.size());
+        const auto bucket_count = std::bit_ceil(std::max<uint32_t>(entry_count * 2, 16)); // at most half full keeps probes short
+
+        std::vector<std::vector<std::byte>> compressed(entry_count);
+        for (uint32_t index = 0; index < entry_count; ++index)
+        {
+            const std::vector<std::byte>& contents = pack_entries[index].contents;
+            if (pack_entries[index].compress && !contents.empty())
+            {
+                std::vector<std::byte> block = lz4::Compress(contents);
+                if (block.size() <= contents.size() - contents.size() / 8)
+                {
+                    compressed[index] = std::move(block);
+                }
+            }
+        }
+
+        const size_t buckets_offset = sizeof(Header);
+        const size_t entries_offset = align_up(buckets_offset + bucket_count * sizeof(uint32_t), alignof(Entry));
+
+        std::vector<std::byte> bytes(entries_offset + entry_count * sizeof(Entry));
+        write_at(bytes, 0, Header{ { Magic[0], Magic[1], Magic[2], Magic[3] }, Version, 0, entry_count, bucket_count });
+
+        std::vector<Entry>    entries(entry_count);
+        std::vector<uint32_t> buckets(bucket_count, EmptyBucket);
+        for (uint32_t index = 0; index < entry_count; ++index)
+        {
+            const PackEntry& pack_entry = pack_entries[index];
+            Entry&           entry      = entries[index];
+            entry.hash                  = hash_key(pack_entry.key);
+            entry.size                  = static_cast<uint32_t>(pack_entry.contents.size());
+            entry.stored_size           = static_cast<uint32_t>(compressed[index].empty() ? pack_entry.contents.size() : compressed[index].size());
+            entry.compression           = compressed[index].empty() ? Compression::None : Compression::Lz4;
+            entry.key_offset            = static_cast<uint32_t>(bytes.size());
+            entry.key_length            = static_cast<uint16_t>(pack_entry.key.size());
+            bytes.insert(bytes.end(), reinterpret_cast<const std::byte*>(pack_entry.key.data()), reinterpret_cast<const std::byte*>(pack_entry.key.data() + pack_entry.key.size()));
+
+            uint32_t bucket = static_cast<uint32_t>(entry.hash) & (bucket_count - 1);
+            while (buckets[bucket] != EmptyBucket)
+            {
+                if (pack_entries[buckets[bucket]].key == pack_entry.key)
+                {
+                    throw std::runtime_error("Asset archive: " + pack_entry.key + " added twice");
+                }
+                bucket = (bucket + 1) & (bucket_count - 1);
+            }
+            buckets[bucket] = index;
+        }
+
+        for (uint32_t index = 0; index < entry_count; ++index)
+        {
+            const std::vector<std::byte>& stored = compressed[index].empty() ? pack_entries[index].contents : compressed[index];
+            const size_t                  offset = align_up(bytes.size(), EntryAlignment);
+            bytes.resize(offset);
+            bytes.insert(bytes.end(), stored.begin(), stored.end());
+            entries[index].offset = static_cast<uint32_t>(offset);
+        }
+        if (bytes.size() > std::numeric_limits<uint32_t>::max())
+        {
+            throw std::runtime_error("Asset archive: more than 4 GB of data");
+        }
+
+        std::memcpy(bytes.data() + buckets_offset, buckets.data(), buckets.size() * sizeof(uint32_t));
+        if (!entries.empty())
+        {
+            std::memcpy(bytes.data() + entries_offset, entries.data(), entries.size() * sizeof(Entry));
+        }
+        return bytes;
+    }
+
+    std::unique_ptr<AssetArchive> AssetArchive::Open(const std::filesystem::path& archive_path)
+    {
+        std::shared_ptr<const MappedFile> mapped = MappedFile::Open(archive_path);
+        if (mapped == nullptr || std::endian::native != std::endian::little)
+        {
+            return nullptr;
+        }
+        const std::span<const std::byte> bytes = mapped->Bytes();
+
+        Header header{};
+        if (bytes.size() < sizeof(Header))
+        {
+            return nullptr;
+        }
+        std::memcpy(&header, bytes.data(), sizeof(Header));
+        if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version || !std::has_single_bit(header.bucket_count) ||
+            header.entry_count > header.bucket_count)
+        {
+            return nullptr;
+        }
+
+        const size_t buckets_offset = sizeof(Header);
+        const size_t entries_offset = align_up(buckets_offset + header.bucket_count * sizeof(uint32_t), alignof(Entry));
+        if (entries_offset + header.entry_count * sizeof(Entry) > bytes.size())
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<AssetArchive> archive(new AssetArchive());
+        archive->buckets = { reinterpret_cast<const uint32_t*>(bytes.data() + buckets_offset), header.bucket_count };
+        archive->entries = { reinterpret_cast<const Entry*>(bytes.data() + entries_offset), header.entry_count };
+        // checked once here so Read never has to
+        for (const uint32_t bucket : archive->buckets)
+        {
+            if (bucket != EmptyBucket && bucket >= header.entry_count)
+            {
+                return nullptr;
+            }
+        }
+        for (const Entry& entry : archive->entries)
+        {
+            if (entry.offset > bytes.size() || entry.stored_size > bytes.size() - entry.offset || entry.key_offset > bytes.size() ||
+                entry.key_length > bytes.size() - entry.key_offset || entry.compression > Compression::Lz4 ||
+                (entry.compression == Compression::None && entry.stored_size != entry.size))
+            {
+                return nullptr;
+            }
+        }
+        archive->file = std::move(mapped);
+        return archive;
+    }
+
+    std::optional<assets::AssetData> AssetArchive::Read(std::string_view key) const
+    {
+        const Entry* entry = find(key);
+        if (entry == nullptr)
+        {
+            return std::nullopt;
+        }
+        const std::span<const std::byte> stored = file->Bytes().subspan(entry->offset, entry->stored_size);
+        if (entry->compression == Compression::None)
+        {
+            return assets::AssetData{ stored, file };
+        }
+
+        auto decoded = std::make_shared<std::vector<std::byte>>(entry->size);
+        if (!lz4::Decompress(stored, *decoded))
+        {
+            throw std::runtime_error("Asset archive: " + std::string(key) + " is corrupt");
+        }
+        const std::span<const std::byte> decoded_bytes(*decoded);
+        return assets::AssetData{ decoded_bytes, std::move(decoded) };
+    }
+
+    const AssetArchive::Entry* AssetArchive::find(std::string_view key) const
+    {
+        if (buckets.empty())
+        {
+            return nullptr;
+        }
+        const uint64_t hash   = hash_key(key);
+        const size_t   mask   = buckets.size() - 1;
+        size_t         bucket = static_cast<size_t>(hash) & mask;
+        // the table is at most half full, so an empty bucket always ends the probe
+        for (size_t probe = 0; probe < buckets.size() && buckets[bucket] != EmptyBucket; ++probe)
+        {
+            const Entry& entry = entries[buckets[bucket]];
+            if (entry.hash == hash && key_of(entry) == key)
+            {
+                return &entry;
+            }
+            bucket = (bucket + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    std::string_view AssetArchive::key_of(const Entry& entry) const
+    {
+        return { reinterpret_cast<const char*>(file->Bytes().data() + entry.key_offset), entry.key_length };
+    }
+}
@@ -0,0 +1,106 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  AssetArchive.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "Path.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CS230
+{
+    class MappedFile;
+
+    // Every asset packed into one file, written by asset_baker --pack and mounted with assets::mount_archive.
+    //
+    //     Header
+    //     uint32_t buckets[bucket_count]   open addressing table on the key hash, entry index or EmptyBucket
+    //     Entry    entries[entry_count]
+    //     char     keys[]                  "Assets/shaders/shape/shape.vert", ...
+    //     data                             every entry starts on an EntryAlignment boundary
+    //
+    // Little-endian like the baked assets. The table of contents is used straight out of the mapped file, a lookup
+    // is one hash, a short probe and a key compare. Entries are stored as is or LZ4 compressed; uncompressed entries
+    // are handed out as views into the mapping, compressed ones are decoded into their own buffer on every Read.
+    class AssetArchive
+    {
+    public:
+        static constexpr char     Magic[4]       = { 'C', 'S', 'P', 'K' };
+        static constexpr uint16_t Version        = 1;
+        static constexpr size_t   EntryAlignment = 16; // enough for any baked asset array to be used in place
+
+        enum class Compression : uint8_t
+        {
+            None = 0,
+            Lz4  = 1,
+        };
+
+        struct PackEntry
+        {
+            std::string            key; // MakeKey form
+            std::vector<std::byte> contents;
+            bool                   compress = false; // stored compressed only if that saves at least an eighth
+        };
+
+        static std::vector<std::byte> Build(std::span<const PackEntry> entries);
+
+        // nullptr when the file is missing or not a valid archive
+        static std::unique_ptr<AssetArchive> Open(const std::filesystem::path& archive_path);
+
+        // the form asset paths are stored and looked up in: "./Assets/a/../b.png" -> "Assets/b.png"
+        static std::string MakeKey(const std::filesystem::path& asset_path);
+
+        bool                             Contains(std::string_view key) const { return find(key) != nullptr; }
+        std::optional<assets::AssetData> Read(std::string_view key) const;
+        size_t                           Count() const { return entries.size(); }
+
+    private:
+        static constexpr uint32_t EmptyBucket = 0xFFFFFFFFu;
+
+        struct Header
+        {
+            char     magic[4];
+            uint16_t version;
+            uint16_t reserved;
+            uint32_t entry_count;
+            uint32_t bucket_count; // power of two
+        };
+
+        struct Entry
+        {
+            uint64_t    hash;
+            uint32_t    offset; // from the start of the archive, archives stay below 4 GB
+            uint32_t    stored_size;
+            uint32_t    size;
+            uint32_t    key_offset;
+            uint16_t    key_length;
+            Compression compression;
+            uint8_t     reserved0;
+            uint32_t    reserved1;
+        };
+        static_assert(sizeof(Header) == 16 && sizeof(Entry) == 32);
+
+        static uint64_t hash_key(std::string_view key);
+
+        const Entry*     find(std::string_view key) const;
+        std::string_view key_of(const Entry& entry) const;
+
+        std::shared_ptr<const MappedFile> file;
+        std::span<const uint32_t>         buckets;
+        std::span<const Entry>            entries;
+    };
+}
@@ -0,0 +1,397 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  BakedAsset.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "BakedAsset.h"
+#include "Path.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+    using namespace CS230::baked;
+
+    constexpr bool native_little_endian = std::endian::native == std::endian::little;
+
+    constexpr size_t align4(size_t offset)
+    {
+        return (offset + 3) & ~size_t{ 3 };
+    }
+
+    class Writer
+    {
+    public:
+        explicit Writer(Kind kind)
+        {
+            if constexpr (!native_little_endian)
+            {
+                throw std::runtime_error("Baked assets are little-endian, bake them on a little-endian machine");
+            }
+            Header header{};
+            std::memcpy(header.magic, Magic, sizeof(Magic));
+            header.version = Version;
+            header.kind    = kind;
+            Append(header);
+        }
+
+        template <typename T>
+        size_t Append(const T& value)
+        {
+            return AppendArray(std::span<const T>(&value, 1));
+        }
+
+        template <typename T>
+        size_t AppendArray(std::span<const T> values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const size_t offset = align4(bytes.size());
+            bytes.resize(offset + values.size_bytes());
+            if (!values.empty())
+            {
+                std::memcpy(bytes.data() + offset, values.data(), values.size_bytes());
+            }
+            return offset;
+        }
+
+        StringRef AppendString(const std::string& text)
+        {
+            const size_t offset = bytes.size();
+            bytes.resize(offset + text.size());
+            std::memcpy(bytes.data() + offset, text.data(), text.size());
+            return { static_cast<uint32_t>(offset), static_cast<uint32_t>(text.size()) };
+        }
+
+        template <typename T>
+        void Patch(size_t offset, const T& value)
+        {
+            std::memcpy(bytes.data() + offset, &value, sizeof(T));
+        }
+
+        std::vector<std::byte> Finish()
+        {
+            bytes.resize(align4(bytes.size()));
+            const auto file_size = static_cast<uint32_t>(bytes.size());
+            std::memcpy(bytes.data() + offsetof(Header, file_size), &file_size, sizeof(file_size));
+            return std::move(bytes);
+        }
+
+    private:
+        std::vector<std::byte> bytes;
+    };
+
+    // walks a baked file front to back with the same alignment rules as Writer, every read is bounds checked
+    class Reader
+    {
+    public:
+        Reader(std::span<const std::byte> file_bytes, Kind kind) : file(file_bytes)
+        {
+            Header header{};
+            if (!native_little_endian || !Read(header) || std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version || header.kind != kind ||
+                header.file_size != file.size())
+            {
+                valid = false;
+            }
+        }
+
+        bool Valid() const { return valid; }
+
+        template <typename T>
+        bool Read(T& value)
+        {
+            const size_t offset = align4(cursor);
+            if (!valid || offset + sizeof(T) > file.size())
+            {
+                return valid = false;
+            }
+            std::memcpy(&value, file.data() + offset, sizeof(T));
+            cursor = offset + sizeof(T);
+            return true;
+        }
+
+        // zero copy, the array has to be suitably aligned in memory which a mapped file always is
+        template <typename T>
+        std::span<const T> View(uint32_t count)
+        {
+            const size_t offset = align4(cursor);
+            if (!valid || count > (file.size() - std::min(offset, file.size())) / sizeof(T) ||
+                reinterpret_cast<std::uintptr_t>(file.data() + offset) % alignof(T) != 0)
+            {
+                valid = false;
+                return {};
+            }
+            cursor = offset + count * sizeof(T);
+            return { reinterpret_cast<const T*>(file.data() + offset), count };
+        }
+
+        std::optional<std::string> String(StringRef ref) const
+        {
+            if (!valid || ref.offset > file.size() || ref.length > file.size() - ref.offset)
+            {
+                return std::nullopt;
+            }
+            return std::string(reinterpret_cast<const char*>(file.data() + ref.offset), ref.length);
+        }
+
+    private:
+        std::span<const std::byte> file;
+        size_t                     cursor = 0;
+        bool                       valid  = true;
+    };
+
+    std::optional<std::filesystem::path> find_current([[maybe_unused]] const std::filesystem::path& source_file, const std::filesystem::path& baked_path)
+    {
+        // an archive is packed from one consistent tree, no dates to compare
+        if (assets::is_archived(baked_path))
+        {
+            return baked_path;
+        }
+        std::error_code error;
+#if defined(DEVELOPER_VERSION)
+        // while assets are being edited, an edited text file wins over a stale bake
+        const auto baked_time = std::filesystem::last_write_time(baked_path, error);
+        if (error)
+        {
+            return std::nullopt;
+        }
+        const auto source_time = std::filesystem::last_write_time(source_file, error);
+        if (!error && source_time > baked_time)
+        {
+            return std::nullopt;
+        }
+        return baked_path;
+#else
+        // release builds trust the bakes shipped with the assets, one existence check per load instead of two date reads
+        if (!std::filesystem::exists(baked_path, error))
+        {
+            return std::nullopt;
+        }
+        return baked_path;
+#endif
+    }
+
+    struct BakedTexel
+    {
+        int32_t x;
+        int32_t y;
+    };
+
+    std::vector<BakedTexel> to_baked(const std::vector<Math::ivec2>& texels)
+    {
+        std::vector<BakedTexel> baked_texels;
+        baked_texels.reserve(texels.size());
+        for (const Math::ivec2 texel : texels)
+        {
+            baked_texels.push_back({ texel.x, texel.y });
+        }
+        return baked_texels;
+    }
+
+    std::vector<Math::ivec2> from_baked(std::span<const BakedTexel> baked_texels)
+    {
+        std::vector<Math::ivec2> texels;
+        texels.reserve(baked_texels.size());
+        for (const BakedTexel texel : baked_texels)
+        {
+            texels.push_back({ texel.x, texel.y });
+        }
+        return texels;
+    }
+}
+
+namespace CS230::baked
+{
+    std::filesystem::path BakedPathFor(const std::filesystem::path& source_file)
+    {
+        std::filesystem::path baked_path = source_file;
+        if (source_file.extension() == ".spt")
+        {
+            return baked_path.replace_extension(".sptb");
+        }
+        if (source_file.extension() == ".anm")
+        {
+            return baked_path.replace_extension(".anmb");
+        }
+        return baked_path.replace_extension(".fntb");
+    }
+
+    std::optional<std::filesystem::path> FindBaked(const std::filesystem::path& source_file)
+    {
+        return find_current(source_file, BakedPathFor(source_file));
+    }
+
+    std::filesystem::path SDFFontPathFor(const std::filesystem::path& font_image)
+    {
+        std::filesystem::path sdf_path = font_image;
+        return sdf_path.replace_extension(".sdff");
+    }
+
+    std::optional<std::filesystem::path> FindBakedSDFFont(const std::filesystem::path& font_image)
+    {
+        return find_current(font_image, SDFFontPathFor(font_image));
+    }
+
+    std::vector<std::byte> WriteSprite(const SpriteSource& sprite)
+    {
+        Writer       writer(Kind::Sprite);
+        SpriteRecord record{};
+        record.collision_radius  = sprite.collision_radius;
+        record.frame_size[0]     = sprite.frame_size.x;
+        record.frame_size[1]     = sprite.frame_size.y;
+        record.frame_count       = static_cast<uint32_t>(sprite.frame_texels.size());
+        record.hotspot_count     = static_cast<uint32_t>(sprite.hotspots.size());
+        record.animation_count   = static_cast<uint32_t>(sprite.animation_files.size());
+        record.collision_shape   = static_cast<uint32_t>(sprite.collision_shape);
+        record.collision_rect[0] = sprite.collision_rect.point_1.x;
+        record.collision_rect[1] = sprite.collision_rect.point_1.y;
+        record.collision_rect[2] = sprite.collision_rect.point_2.x;
+        record.collision_rect[3] = sprite.collision_rect.point_2.y;
+        const size_t record_offset = writer.Append(record);
+
+        writer.AppendArray(std::span<const BakedTexel>(to_baked(sprite.frame_texels)));
+        writer.AppendArray(std::span<const BakedTexel>(to_baked(sprite.hotspots)));
+        const size_t animations_offset = writer.AppendArray(std::span<const StringRef>(std::vector<StringRef>(sprite.animation_files.size())));
+
+        // strings go last, their offsets are patched into the tables written above
+        record.texture_file = writer.AppendString(sprite.texture_file);
+        writer.Patch(record_offset, record);
+        for (size_t i = 0; i < sprite.animation_files.size(); ++i)
+        {
+            writer.Patch(animations_offset + i * sizeof(StringRef), writer.AppendString(sprite.animation_files[i]));
+        }
+        return writer.Finish();
+    }
+
+    std::vector<std::byte> WriteAnimation(std::span<const AnimationFrame> frames)
+    {
+        Writer writer(Kind::Animation);
+        writer.Append(AnimationRecord{ static_cast<uint32_t>(frames.size()), 0 });
+        writer.AppendArray(frames);
+        return writer.Finish();
+    }
+
+    std::vector<std::byte> WriteFontGlyphs(std::span<const Math::irect> glyphs)
+    {
+        std::vector<GlyphRect> baked_glyphs;
+        baked_glyphs.reserve(glyphs.size());
+        for (const Math::irect& glyph : glyphs)
+        {
+            baked_glyphs.push_back({ glyph.point_1.x, glyph.point_1.y, glyph.point_2.x, glyph.point_2.y });
+        }
+        Writer writer(Kind::FontGlyphs);
+        writer.Append(FontRecord{ static_cast<uint32_t>(baked_glyphs.size()), 0 });
+        writer.AppendArray(std::span<const GlyphRect>(baked_glyphs));
+        return writer.Finish();
+    }
+
+    std::vector<std::byte> WriteSDFFont(const SDFFontRecord& record, std::span<const SDFGlyph> glyphs, std::span<const uint8_t> distances)
+    {
+        if (distances.size() != size_t{ record.atlas_width } * record.atlas_height || glyphs.size() != record.glyph_count)
+        {
+            throw std::runtime_error("SDF font atlas does not match its record");
+        }
+        Writer writer(Kind::SDFFont);
+        writer.Append(record);
+        writer.AppendArray(glyphs);
+        writer.AppendArray(distances);
+        return writer.Finish();
+    }
+
+    std::optional<SpriteSource> ReadSprite(std::span<const std::byte> file)
+    {
+        Reader       reader(file, Kind::Sprite);
+        SpriteRecord record{};
+        if (!reader.Read(record) || record.collision_shape > static_cast<uint32_t>(SpriteDefinition::CollisionShape::Circle))
+        {
+            return std::nullopt;
+        }
+        SpriteSource sprite;
+        sprite.frame_size       = { record.frame_size[0], record.frame_size[1] };
+        sprite.frame_texels     = from_baked(reader.View<BakedTexel>(record.frame_count));
+        sprite.hotspots         = from_baked(reader.View<BakedTexel>(record.hotspot_count));
+        sprite.collision_shape  = static_cast<SpriteDefinition::CollisionShape>(record.collision_shape);
+        sprite.collision_rect   = { { record.collision_rect[0], record.collision_rect[1] }, { record.collision_rect[2], record.collision_rect[3] } };
+        sprite.collision_radius = record.collision_radius;
+        for (const StringRef ref : reader.View<StringRef>(record.animation_count))
+        {
+            std::optional<std::string> animation_file = reader.String(ref);
+            if (!animation_file)
+            {
+                return std::nullopt;
+            }
+            sprite.animation_files.push_back(std::move(*animation_file));
+        }
+        std::optional<std::string> texture_file = reader.String(record.texture_file);
+        if (!reader.Valid() || !texture_file)
+        {
+            return std::nullopt;
+        }
+        sprite.texture_file = std::move(*texture_file);
+        return sprite;
+    }
+
+    std::span<const AnimationFrame> ReadAnimation(std::span<const std::byte> file)
+    {
+        Reader          reader(file, Kind::Animation);
+        AnimationRecord record{};
+        if (!reader.Read(record) || record.frame_count == 0)
+        {
+            return {};
+        }
+        const std::span<const AnimationFrame> frames = reader.View<AnimationFrame>(record.frame_count);
+        for (const AnimationFrame& frame : frames)
+        {
+            // AnimationPlayer follows next without checking
+            if (frame.next != AnimationFrame::EndOfAnimation && frame.next >= frames.size())
+            {
+                return {};
+            }
+        }
+        return frames;
+    }
+
+    std::span<const GlyphRect> ReadFontGlyphs(std::span<const std::byte> file)
+    {
+        Reader     reader(file, Kind::FontGlyphs);
+        FontRecord record{};
+        if (!reader.Read(record))
+        {
+            return {};
+        }
+        return reader.View<GlyphRect>(record.glyph_count);
+    }
+
+    std::optional<SDFFontView> ReadSDFFont(std::span<const std::byte> file)
+    {
+        Reader        reader(file, Kind::SDFFont);
+        SDFFontRecord record{};
+        if (!reader.Read(record) || record.atlas_width > 16384 || record.atlas_height > 16384 || !(record.spread > 0.0f))
+        {
+            return std::nullopt;
+        }
+        const std::span<const SDFGlyph> glyphs    = reader.View<SDFGlyph>(record.glyph_count);
+        const std::span<const uint8_t>  distances = reader.View<uint8_t>(record.atlas_width * record.atlas_height);
+        if (!reader.Valid())
+        {
+            return std::nullopt;
+        }
+        const auto width  = static_cast<int32_t>(record.atlas_width);
+        const auto height = static_cast<int32_t>(record.atlas_height);
+        for (const SDFGlyph& glyph : glyphs)
+        {
+            if (glyph.left < 0 || glyph.bottom < 0 || glyph.width < 0 || glyph.height < 0 || glyph.left > width - glyph.width || glyph.bottom > height - glyph.height)
+            {
+                return std::nullopt;
+            }
+        }
+        return SDFFontView{ record, glyphs, distances };
+    }
+}
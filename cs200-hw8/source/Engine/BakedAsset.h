@@ -0,0 +1,148 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  BakedAsset.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "Animation.h"
+#include "Rect.h"
+#include "SpriteDefinition.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+// Binary form of the text assets, written offline by asset_baker and read at load time without parsing.
+//
+// Every file is a Header, the record of its kind, then the record's arrays in order, each one starting
+// on a 4 byte boundary. All values are little-endian, strings are (offset, length) pairs into a blob at
+// the end of the file. Arrays of AnimationFrame are stored exactly as the struct is laid out in memory, so
+// a mapped .anmb is used in place.
+//
+//     .sptb  SpriteRecord, ivec2 frame_texels[], ivec2 hotspots[], StringRef animation_files[], strings
+//     .anmb  AnimationRecord, AnimationFrame frames[]
+//     .fntb  FontRecord, GlyphRect glyphs[]
+//     .sdff  SDFFontRecord, SDFGlyph glyphs[], uint8_t distances[atlas_width * atlas_height]
+//
+// Readers check the magic, version, kind and every size against the file length, and refuse the file
+// (the caller falls back to the text asset) instead of throwing.
+namespace CS230::baked
+{
+    inline constexpr char     Magic[4] = { 'C', 'S', 'B', 'K' };
+    inline constexpr uint16_t Version  = 1;
+
+    enum class Kind : uint16_t
+    {
+        Sprite     = 1,
+        Animation  = 2,
+        FontGlyphs = 3,
+        SDFFont    = 4,
+    };
+
+    struct Header
+    {
+        char     magic[4];
+        uint16_t version;
+        Kind     kind;
+        uint32_t file_size;
+        uint32_t reserved;
+    };
+
+    struct StringRef
+    {
+        uint32_t offset; // from the start of the file
+        uint32_t length;
+    };
+
+    struct SpriteRecord
+    {
+        double    collision_radius;
+        int32_t   frame_size[2];
+        uint32_t  frame_count;
+        uint32_t  hotspot_count;
+        uint32_t  animation_count;
+        uint32_t  collision_shape;
+        int32_t   collision_rect[4];
+        StringRef texture_file;
+    };
+
+    struct AnimationRecord
+    {
+        uint32_t frame_count;
+        uint32_t reserved;
+    };
+
+    struct FontRecord
+    {
+        uint32_t glyph_count;
+        uint32_t reserved;
+    };
+
+    struct GlyphRect
+    {
+        int32_t left;
+        int32_t bottom;
+        int32_t right;
+        int32_t top;
+    };
+
+    struct SDFFontRecord
+    {
+        uint32_t atlas_width;
+        uint32_t atlas_height;
+        uint32_t glyph_count;
+        int32_t  line_height; // font pixels, one atlas texel per font pixel
+        int32_t  padding;     // empty texels around every glyph box, room for outlines and glows
+        float    spread;      // distance in texels that maps to the ends of the 0..255 range
+    };
+
+    // atlas rows run bottom to top so the texture is uploaded as is, boxes include the padding
+    struct SDFGlyph
+    {
+        int32_t left;
+        int32_t bottom;
+        int32_t width;
+        int32_t height;
+        int32_t advance;
+    };
+
+    // sampled distance d (in texels, positive inside) is stored as 128 + 127 * d / spread, clamped
+    struct SDFFontView
+    {
+        SDFFontRecord             record;
+        std::span<const SDFGlyph> glyphs;
+        std::span<const uint8_t>  distances;
+    };
+
+    static_assert(sizeof(Header) == 16 && sizeof(SpriteRecord) == 56 && sizeof(AnimationFrame) == 12 && sizeof(GlyphRect) == 16);
+    static_assert(sizeof(SDFFontRecord) == 24 && sizeof(SDFGlyph) == 20);
+
+    // Ship.spt -> Ship.sptb, Ship.anm -> Ship.anmb, anything else (font images) -> .fntb
+    std::filesystem::path BakedPathFor(const std::filesystem::path& source_file);
+    // the baked sibling of source_file when the mounted archive has it or it is on disk; developer builds also
+    // skip a bake older than its source, so edited text files show up without rebaking
+    std::optional<std::filesystem::path> FindBaked(const std::filesystem::path& source_file);
+    // Font1.png -> Font1.sdff, a font image has both a glyph table and a distance field atlas
+    std::filesystem::path                SDFFontPathFor(const std::filesystem::path& font_image);
+    std::optional<std::filesystem::path> FindBakedSDFFont(const std::filesystem::path& font_image);
+
+    std::vector<std::byte> WriteSprite(const SpriteSource& sprite);
+    std::vector<std::byte> WriteAnimation(std::span<const AnimationFrame> frames);
+    std::vector<std::byte> WriteFontGlyphs(std::span<const Math::irect> glyphs);
+    std::vector<std::byte> WriteSDFFont(const SDFFontRecord& record, std::span<const SDFGlyph> glyphs, std::span<const uint8_t> distances);
+
+    std::optional<SpriteSource> ReadSprite(std::span<const std::byte> file);
+    // views into file, empty when the file is not a valid baked asset of that kind
+    std::span<const AnimationFrame> ReadAnimation(std::span<const std::byte> file);
+    std::span<const GlyphRect>      ReadFontGlyphs(std::span<const std::byte> file);
+    // every glyph box is checked to lie inside the atlas
+    std::optional<SDFFontView> ReadSDFFont(std::span<const std::byte> file);
+}
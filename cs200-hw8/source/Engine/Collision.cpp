@@ -14,9 +14,24 @@ Created:    May 17, 2025
 #include "Engine.h"
 #include "Logger.h"
 #include "TextureManager.h"
+#include "TransformStore.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
 namespace CS230
 {
+    bool Collision::IsCollidingWith(GameObject* other_object)
+    {
+        Collision* other_collider = other_object->GetGOComponent<Collision>();
+        if (other_collider == nullptr)
+        {
+            return false;
+        }
+        return Narrowphase::Test(GetWorldShape(), other_collider->GetWorldShape()).IsTouching();
+    }
+
     RectCollision::RectCollision(Math::irect _boundary, CS230::GameObject* _object) : boundary(_boundary), object(_object)
     {
     }
@@ -52,35 +67,36 @@ namespace CS230
 
     Math::rect RectCollision::WorldBoundary()
     {
-        return { object->GetMatrix() * static_cast<Math::vec2>(boundary.point_1), object->GetMatrix() * static_cast<Math::vec2>(boundary.point_2) };
+        TransformStore& transforms = Engine::GetTransformStore();
+        return { transforms.TransformPoint(object->GetTransformId(), static_cast<Math::vec2>(boundary.point_1)),
+                 transforms.TransformPoint(object->GetTransformId(), static_cast<Math::vec2>(boundary.point_2)) };
     }
 
-    bool RectCollision::IsCollidingWith(GameObject* other_object)
+    WorldShape RectCollision::GetWorldShape()
     {
-        Collision* other_collider = other_object->GetGOComponent<Collision>();
-
-
-        if (other_collider == nullptr)
-        {
-            // Engine::GetLogger().LogError("No collision component found");
-            return false;
-        }
-
-
-        if (other_collider->Shape() != CollisionShape::Rect)
-        {
-            Engine::GetLogger().LogError("Rect vs unsupported type");
-            return false;
-        }
-
-        Math::rect rectangle_1 = WorldBoundary();
-        Math::rect rectangle_2 = dynamic_cast<RectCollision*>(other_collider)->WorldBoundary();
+        // one matrix read instead of transforming corners: center through the matrix, axes are its columns
+        const Math::TransformationMatrix matrix   = Engine::GetTransformStore().GetMatrix(object->GetTransformId());
+        const Math::vec2                 column_x{ matrix[0][0], matrix[1][0] };
+        const Math::vec2                 column_y{ matrix[0][1], matrix[1][1] };
+        const double                     length_x = std::sqrt(column_x.x * column_x.x + column_x.y * column_x.y);
+        const double                     length_y = std::sqrt(column_y.x * column_y.x + column_y.y * column_y.y);
+        const Math::vec2                 local_center{ (boundary.point_1.x + boundary.point_2.x) * 0.5, (boundary.point_1.y + boundary.point_2.y) * 0.5 };
+
+        WorldShape shape;
+        shape.type         = WorldShape::Type::Box;
+        shape.center       = { matrix[0][0] * local_center.x + matrix[0][1] * local_center.y + matrix[0][2], matrix[1][0] * local_center.x + matrix[1][1] * local_center.y + matrix[1][2] };
+        shape.axis         = length_x > 0.0 ? Math::vec2{ column_x.x / length_x, column_x.y / length_x } : Math::vec2{ 1.0, 0.0 };
+        shape.half_extents = { static_cast<double>(boundary.Size().x) * 0.5 * length_x, static_cast<double>(boundary.Size().y) * 0.5 * length_y };
+        return shape;
+    }
 
-        if (!((rectangle_1.Right() <= rectangle_2.Left()) || (rectangle_1.Left() >= rectangle_2.Right()) || (rectangle_1.Top() <= rectangle_2.Bottom()) || (rectangle_1.Bottom() >= rectangle_2.Top())))
-        {
-            return true;
-        }
-        return false;
+    Math::rect RectCollision::WorldBounds()
+    {
+        // box around the oriented box, so rotated colliders are not missed by the broadphase
+        const WorldShape shape = GetWorldShape();
+        const Math::vec2 reach{ std::abs(shape.axis.x) * shape.half_extents.x + std::abs(shape.axis.y) * shape.half_extents.y,
+                                std::abs(shape.axis.y) * shape.half_extents.x + std::abs(shape.axis.x) * shape.half_extents.y };
+        return { shape.center - reach, shape.center + reach };
     }
 
     bool RectCollision::IsCollidingWith(Math::vec2 point)
@@ -93,6 +109,48 @@ namespace CS230
         return false;
     }
 
+    bool RectCollision::RayCast(Math::vec2 from, Math::vec2 to, double& fraction)
+    {
+        // slab test in the oriented box's own frame, the tree only narrowed it down by the fat AABB;
+        // the box is symmetric, so which way the second axis points does not matter
+        const WorldShape shape     = GetWorldShape();
+        const Math::vec2 axis_y{ -shape.axis.y, shape.axis.x };
+        const auto       to_box    = [&](Math::vec2 v) { return Math::vec2{ v.x * shape.axis.x + v.y * shape.axis.y, v.x * axis_y.x + v.y * axis_y.y }; };
+        const Math::vec2 start     = to_box(from - shape.center);
+        const Math::vec2 direction = to_box(to - from);
+        double           enter     = 0.0;
+        double           exit      = 1.0;
+        const double     starts[2] = { start.x, start.y };
+        const double     steps[2]  = { direction.x, direction.y };
+        const double     lows[2]   = { -shape.half_extents.x, -shape.half_extents.y };
+        const double     highs[2]  = { shape.half_extents.x, shape.half_extents.y };
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            if (steps[axis] == 0.0)
+            {
+                if (starts[axis] < lows[axis] || starts[axis] > highs[axis])
+                {
+                    return false;
+                }
+                continue;
+            }
+            double near_t = (lows[axis] - starts[axis]) / steps[axis];
+            double far_t  = (highs[axis] - starts[axis]) / steps[axis];
+            if (near_t > far_t)
+            {
+                std::swap(near_t, far_t);
+            }
+            enter = std::max(enter, near_t);
+            exit  = std::min(exit, far_t);
+            if (enter > exit)
+            {
+                return false;
+            }
+        }
+        fraction = enter;
+        return true;
+    }
+
     CircleCollision::CircleCollision(double _radius, GameObject* _object) :  object(_object), radius(_radius)
     {
     }
@@ -127,34 +185,20 @@ namespace CS230
         return std::min(object->GetScale().x, object->GetScale().x) * radius;
     }
 
-    bool CircleCollision::IsCollidingWith(GameObject* other_object)
+    Math::rect CircleCollision::WorldBounds()
     {
-        Collision* other_collider = other_object->GetGOComponent<Collision>();
-
-
-        if (other_collider == nullptr)
-        {
-            // Engine::GetLogger().LogError("No collision component found");
-            return false;
-        }
-
-
-        if (other_collider->Shape() != CollisionShape::Circle)
-        {
-            Engine::GetLogger().LogError("Circle vs unsupported type");
-            return false;
-        }
-        double     _radius        = GetRadius();
-        Math::vec2 position       = object->GetPosition();
-        double     other_radius   = dynamic_cast<CircleCollision*>(other_collider)->GetRadius();
-        Math::vec2 other_position = other_object->GetPosition();
+        const double     _radius  = GetRadius();
+        const Math::vec2 position = object->GetPosition();
+        return { position - Math::vec2{ _radius, _radius }, position + Math::vec2{ _radius, _radius } };
+    }
 
-        if (((position.x - other_position.x) * (position.x - other_position.x) + (position.y - other_position.y) * (position.y - other_position.y)) <
-            ((_radius + other_radius) * (_radius + other_radius)))
-        {
-            return true;
-        }
-        return false;
+    WorldShape CircleCollision::GetWorldShape()
+    {
+        WorldShape shape;
+        shape.type   = WorldShape::Type::Circle;
+        shape.center = object->GetPosition();
+        shape.radius = GetRadius();
+        return shape;
     }
 
     bool CircleCollision::IsCollidingWith(Math::vec2 point)
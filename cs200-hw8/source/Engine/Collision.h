@@ -12,6 +12,7 @@ Created:    May 18, 2025
 #include "Rect.h"
 #include "GameObject.h"
 #include "Matrix.h"
+#include "Narrowphase.h"
 
 namespace Math {
     class TransformationMatrix;
@@ -28,20 +29,29 @@ namespace CS230 {
         };
         virtual CollisionShape Shape() = 0;
         virtual void Draw(Math::TransformationMatrix display_matrix,float depth = 0.f) = 0;
-        virtual bool IsCollidingWith(GameObject* other_object) = 0;
+        // any shape against any shape through the narrowphase
+        bool         IsCollidingWith(GameObject* other_object);
         virtual bool IsCollidingWith(Math::vec2 point) = 0;
+        virtual WorldShape GetWorldShape() = 0;
+        // axis aligned world box around the shape, what the broadphase sorts on
+        virtual Math::rect WorldBounds() = 0;
+        // segment from..to against the shape, fraction is where along the segment it enters (0 when from is inside)
+        virtual bool RayCast(Math::vec2 from, Math::vec2 to, double& fraction) = 0;
     };
 
     class RectCollision : public Collision {
     public:
+        using ComponentBase = Collision;
         RectCollision(Math::irect _boundary, GameObject* _object);
         CollisionShape Shape() override {
             return CollisionShape::Rect;
         }
         void Draw(Math::TransformationMatrix display_matrix, float depth) override;
         Math::rect WorldBoundary();
-        bool IsCollidingWith(GameObject* other_object) override;
+        Math::rect WorldBounds() override;
         bool IsCollidingWith(Math::vec2 point) override;
+        bool RayCast(Math::vec2 from, Math::vec2 to, double& fraction) override;
+        WorldShape GetWorldShape() override;
     private:
         Math::irect boundary;
         GameObject* object;
@@ -51,6 +61,7 @@ namespace CS230 {
 
     class CircleCollision : public Collision {
     public:
+        using ComponentBase = Collision;
         CircleCollision(double radius, GameObject* object);
         CollisionShape Shape() override {
             return CollisionShape::Circle;
@@ -58,8 +69,10 @@ namespace CS230 {
 
         void Draw(Math::TransformationMatrix display_matrix,float depth) override;
         double GetRadius();
-        bool IsCollidingWith(GameObject* other_object) override;
+        Math::rect WorldBounds() override;
         bool IsCollidingWith(Math::vec2 point) override;
+        bool RayCast(Math::vec2 from, Math::vec2 to, double& fraction) override;
+        WorldShape GetWorldShape() override;
     private:
         GameObject* object;
         double radius;
@@ -9,16 +9,44 @@ Created:    May 17, 2025
 */
 #pragma once
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
+#include <type_traits>
 
 #include "Component.h"
 
 namespace CS230
 {
+    using ComponentTypeId = uint32_t;
+
+    // Sequential id per component type, handed out the first time the type is looked at. No RTTI involved.
+    inline ComponentTypeId NextComponentTypeId()
+    {
+        static std::atomic<ComponentTypeId> next{ 0 };
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    ComponentTypeId ComponentTypeOf()
+    {
+        static const ComponentTypeId id = NextComponentTypeId();
+        return id;
+    }
+
+    // A component that should also be found through a parent type declares it:
+    //     class RectCollision : public Collision { public: using ComponentBase = Collision; ... };
+    // The chain is followed upwards, so every level that wants to be looked up has to declare its own parent.
+    template <typename T>
+    concept HasComponentBase = requires { typename T::ComponentBase; };
+
     class ComponentManager
     {
     public:
+        static constexpr ComponentTypeId MaxComponentTypes = 32;
+
         ~ComponentManager()
         {
             Clear();
@@ -26,49 +54,104 @@ namespace CS230
 
         void UpdateAll(double dt)
         {
-            for (Component* component : components)
+            for (const Entry& entry : components)
             {
-                component->Update(dt);
+                entry.component->Update(dt);
             }
         }
 
-        void AddComponent(Component* component)
+        template <typename T>
+        void AddComponent(T* component)
         {
-            components.push_back(component);
+            static_assert(std::is_base_of_v<Component, T> && !std::is_same_v<T, Component>, "AddComponent needs the concrete component type");
+            Entry entry{ component, type_mask<T>() };
+            components.push_back(entry);
+            register_entry(entry);
         }
 
+        // O(1): one table read, the stored pointer is the Component sub-object of an object that is (derived from) T
         template <typename T>
         T* GetComponent()
         {
-            for (Component* component : components)
-            {
-                T* ptr = dynamic_cast<T*>(component);
-                if (ptr != nullptr)
-                {
-                    return ptr;
-                }
-            }
-            return nullptr;
+            const ComponentTypeId id = checked_id<T>();
+            return static_cast<T*>(table[id]);
         }
 
         template <typename T>
         void RemoveComponent()
         {
-            auto it = std::find_if(components.begin(), components.end(), [](Component* element) { return (dynamic_cast<T*>(element) != nullptr); });
-            delete *it;
-            components.erase(it);
+            Component* component = table[checked_id<T>()];
+            if (component == nullptr)
+            {
+                return;
+            }
+            components.erase(std::find_if(components.begin(), components.end(), [component](const Entry& entry) { return entry.component == component; }));
+            delete component;
+
+            // another component may have been shadowed by the removed one (e.g. two Collision types), so refill the table
+            table.fill(nullptr);
+            for (const Entry& entry : components)
+            {
+                register_entry(entry);
+            }
         }
 
         void Clear()
         {
-            for (Component* component : components)
+            for (const Entry& entry : components)
             {
-                delete component;
+                delete entry.component;
             }
             components.clear();
+            table.fill(nullptr);
         }
 
     private:
-        std::vector<Component*> components;
+        struct Entry
+        {
+            Component* component;
+            uint32_t   types; // bit per ComponentTypeId this component answers to
+        };
+
+        template <typename T>
+        static ComponentTypeId checked_id()
+        {
+            const ComponentTypeId id = ComponentTypeOf<T>();
+            if (id >= MaxComponentTypes)
+            {
+                throw std::runtime_error("ComponentManager: too many component types, raise MaxComponentTypes");
+            }
+            return id;
+        }
+
+        template <typename T>
+        static uint32_t type_mask()
+        {
+            uint32_t mask = 1u << checked_id<T>();
+            if constexpr (HasComponentBase<T>)
+            {
+                if constexpr (!std::is_same_v<typename T::ComponentBase, T>)
+                {
+                    static_assert(std::is_base_of_v<typename T::ComponentBase, T>, "ComponentBase has to be a parent class");
+                    mask |= type_mask<typename T::ComponentBase>();
+                }
+            }
+            return mask;
+        }
+
+        void register_entry(const Entry& entry)
+        {
+            // first component added for a type wins, same as the old linear scan
+            for (ComponentTypeId id = 0; id < MaxComponentTypes; ++id)
+            {
+                if ((entry.types & (1u << id)) != 0 && table[id] == nullptr)
+                {
+                    table[id] = entry.component;
+                }
+            }
+        }
+
+        std::vector<Entry>                        components;
+        std::array<Component*, MaxComponentTypes> table{};
     };
 }
@@ -0,0 +1,37 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  ContactEvent.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "GameObjectHandle.h"
+#include "Narrowphase.h"
+
+namespace CS230
+{
+    // One entry of the buffer GameObjectManager::CollisionTest fills every frame.
+    // Begin is sent the first frame two colliders touch, Stay every following frame, End the first frame they no longer do
+    // (also when one of them was destroyed, its handle then no longer resolves).
+    // first always has the lower slot index so a pair keeps the same order for its whole lifetime.
+    struct ContactEvent
+    {
+        enum class Phase
+        {
+            Begin,
+            Stay,
+            End
+        };
+
+        Phase            phase = Phase::Begin;
+        GameObjectHandle first{};
+        GameObjectHandle second{};
+        Contact          contact{};               // normal points from first to second, last known contact for End
+        bool             first_handles  = false;  // first->CanCollideWith(second->Type())
+        bool             second_handles = false;
+    };
+}
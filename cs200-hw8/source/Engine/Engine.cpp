@@ -7,22 +7,33 @@
  * \copyright DigiPen Institute of Technology
  */
 #include "Engine.h"
+#include "CS200/DeferredRenderer2D.h"
 #include "CS200/ImGuiHelper.h"
 #include "CS200/ImmediateRenderer2D.h"
 #include "CS200/NDC.h"
 #include "CS200/RenderingAPI.h"
+#include "OpenGL/GL.h"
+#include "Animation.h"
 #include "FPS.h"
 #include "Font.h"
+#include "FramePacer.h"
 #include "GameState.h"
 #include "GameStateManager.h"
 #include "Input.h"
+#include "JobSystem.h"
 #include "Logger.h"
+#include "Path.h"
+#include "RenderThread.h"
+#include "SpriteDefinition.h"
 #include "TextManager.h"
 #include "TextureManager.h"
 #include "Timer.h"
+#include "TransformStore.h"
 #include "Window.h"
 
+#include <algorithm>
 #include <chrono>
+#include <stdexcept>
 
 // Pimpl implementation class
 class Engine::Impl
@@ -43,14 +54,25 @@ public:
 	CS230::Logger			logger;
 	CS230::Window			window{};
 	CS230::Input			input{};
+	CS230::RenderThread		renderThread{}; // declared before anything owning GL objects, stopped in Stop()
+	CS200::DeferredRenderer2D deferredRenderer{};
+	bool					useRenderThread = false;
+	CS230::FramePacer		framePacer{};
 	ImGuiHelper::Viewport	viewport{};
 	util::FPS				fps{};
 	util::Timer				timer{};
 	WindowEnvironment		environment{};
+	CS230::TransformStore	transformStore{}; // declared before the state manager so it is destroyed after every GameObject
+	CS230::AnimationPlayer	animationPlayer{}; // for Sprites loaded while no state is on the stack, same lifetime reason as transformStore
+	CS230::JobSystem		jobSystem{};
 	CS230::GameStateManager gameStateManager{};
 	// CS200::IRenderer2D*		renderer2D = nullptr;
 	CS230::TextureManager	textureManager{};
+	CS230::SpriteDefinitionCache spriteDefinitions{};
 	TextManager				textManager{};
+	double					tickRate		 = 60.0;
+	int						maxStepsPerFrame = 5;
+	double					tickAccumulator	 = 0.0;
 };
 
 Engine& Engine::Instance()
@@ -74,6 +96,35 @@ CS230::Input& Engine::GetInput()
 	return Instance().impl->input;
 }
 
+void Engine::SetTickRate(double ticks_per_second)
+{
+	if (ticks_per_second <= 0.0)
+	{
+		throw std::runtime_error("Tick rate must be positive");
+	}
+	Instance().impl->tickRate = ticks_per_second;
+}
+
+void Engine::SetMaxStepsPerFrame(int max_steps)
+{
+	Instance().impl->maxStepsPerFrame = std::max(max_steps, 1);
+}
+
+void Engine::SetRenderThreadEnabled(bool enabled)
+{
+	Instance().impl->useRenderThread = enabled;
+}
+
+CS230::RenderThread& Engine::GetRenderThread()
+{
+	return Instance().impl->renderThread;
+}
+
+CS230::FramePacer& Engine::GetFramePacer()
+{
+	return Instance().impl->framePacer;
+}
+
 const WindowEnvironment& Engine::GetWindowEnvironment()
 {
 	return Instance().impl->environment;
@@ -99,12 +150,38 @@ TextManager& Engine::GetTextManager()
 	return Instance().impl->textManager;
 }
 
+CS230::TransformStore& Engine::GetTransformStore()
+{
+	return Instance().impl->transformStore;
+}
+
+CS230::AnimationPlayer& Engine::GetAnimationPlayer()
+{
+	auto& state_manager = Instance().impl->gameStateManager;
+	return state_manager.HasGameEnded() ? Instance().impl->animationPlayer : state_manager.GetAnimationPlayer();
+}
+
+CS230::SpriteDefinitionCache& Engine::GetSpriteDefinitionCache()
+{
+	return Instance().impl->spriteDefinitions;
+}
+
+CS230::JobSystem& Engine::GetJobSystem()
+{
+	return Instance().impl->jobSystem;
+}
+
 void Engine::Start(std::string_view window_title)
 {
 	impl->logger.LogEvent("Engine Started");
 #if defined(DEVELOPER_VERSION)
 	impl->logger.LogEvent("Developer Build");
 #endif
+	// everything the archive has is read from it, anything else still comes from the Assets folder
+	if (assets::mount_archive("Assets.pak"))
+	{
+		impl->logger.LogEvent("Mounted Assets.pak");
+	}
 	impl->window.Start(window_title);
 	auto& window = impl->window;
 
@@ -112,41 +189,152 @@ void Engine::Start(std::string_view window_title)
 	impl->viewport		   = { 0, 0, window_size.x, window_size.y };
 	CS200::RenderingAPI::SetViewport(window_size);
 	impl->environment.DisplaySize = { static_cast<double>(window_size.x), static_cast<double>(window_size.y) };
+	impl->framePacer.SetPresentRate(window.GetVSync() == CS230::Window::VSync::Off ? 0.0 : static_cast<double>(window.GetRefreshRate()));
 	ImGuiHelper::Initialize(window.GetSDLWindow(), window.GetGLContext());
 	window.SetEventCallback(ImGuiHelper::FeedEvent);
     impl->textureManager.Init();
 	// impl->renderer2D.Init();
 	impl->timer.ResetTimeStamp();
 	impl->textManager.Init();
+	impl->jobSystem.Start(CS230::JobSystem::DefaultWorkerCount());
+	LOG_EVENT("Job workers: {}", impl->jobSystem.WorkerCount());
+#if !defined(__EMSCRIPTEN__)
+	if (impl->useRenderThread)
+	{
+		ImGuiHelper::SetPlatformWindowsEnabled(false);
+		impl->renderThread.Start(window.GetSDLWindow(), window.GetGLContext());
+		LOG_EVENT("Render thread started, {} frames in flight", CS230::RenderThread::FramesInFlight);
+	}
+#endif
 }
 
 void Engine::Stop()
 {
+	// everything below releases GL objects, the context comes back to this thread first
+	impl->renderThread.Stop();
     impl->textureManager.Shutdown();
 	// impl->renderer2D.Shutdown();
 	impl->gameStateManager.Clear();
+	impl->spriteDefinitions.Unload();
+	impl->jobSystem.Stop();
 	ImGuiHelper::Shutdown();
+	assets::unmount_archive();
 	impl->logger.LogEvent("Engine Stopped");
 }
 
 void Engine::Update()
 {
+	// waits for the frame cap, or in low latency mode for the last moment the frame can start, before input is read
+	impl->framePacer.WaitForNextFrame();
 	updateEnvironment();
 
 	// service update
 	auto& environment = impl->environment;
-	impl->window.Update();
-	impl->input.Update();
+	impl->window.PollEvents();
 
-	auto& state_manager = impl->gameStateManager;
-	state_manager.Update(environment.DeltaTime);
-	const auto		  viewport		= impl->viewport;
-	const Math::ivec2 viewport_size = { viewport.width, viewport.height };
+	// fixed step simulation: frame time is banked and spent in whole ticks, input is sampled per tick
+	// so a key press is seen as just pressed by exactly one tick
+	auto&		 state_manager = impl->gameStateManager;
+	const double tick		   = 1.0 / impl->tickRate;
+	environment.FixedDeltaTime = tick;
+	impl->tickAccumulator += environment.DeltaTime;
+	int steps = 0;
+	// a tick that pops the last state ends the game, the ticks left in this frame have nothing to update
+	while (impl->tickAccumulator >= tick && steps < impl->maxStepsPerFrame && !state_manager.HasGameEnded())
+	{
+		impl->input.Update();
+		impl->transformStore.SaveTick();
+		state_manager.Update(tick);
+		impl->tickAccumulator -= tick;
+		++steps;
+	}
+	if (impl->tickAccumulator >= tick)
+	{
+		// too far behind: the backlog is dropped on purpose instead of spiralling into ever longer frames.
+		// Starting over at zero puts interpolation back at the last tick, a leftover fraction would jump it
+		impl->tickAccumulator = 0.0;
+	}
+	environment.InterpolationAlpha = impl->tickAccumulator / tick;
+
+	if (impl->renderThread.IsRunning() && state_manager.CanDrawOnRenderThread())
+	{
+		drawRecorded();
+	}
+	else
+	{
+		drawImmediate();
+	}
+	impl->framePacer.EndFrameWork();
+}
+
+void Engine::present()
+{
+	impl->window.SwapBuffers();
+	if (impl->framePacer.IsLowLatency())
+	{
+		// the swap only queues the frame, wait until it is really out so the pacer times the next one from there
+		GL::Finish();
+	}
+	impl->framePacer.MarkPresented();
+}
+
+void Engine::drawImmediate()
+{
+	const CS230::GLContextScope gl_context(impl->renderThread);
+	auto&						state_manager = impl->gameStateManager;
+	const auto					viewport	  = impl->viewport;
+	const Math::ivec2			viewport_size = { viewport.width, viewport.height };
 	CS200::RenderingAPI::SetViewport(viewport_size, { viewport.x, viewport.y });
 	state_manager.Draw();
 	impl->viewport = ImGuiHelper::Begin();
 	state_manager.DrawImGui();
+	impl->framePacer.DrawImGui(impl->window);
 	ImGuiHelper::End();
+	// swapped as soon as it is drawn, so the last frame before the game ends is shown too
+	present();
+}
+
+void Engine::drawRecorded()
+{
+	auto& render_thread = impl->renderThread;
+	auto& state_manager = impl->gameStateManager;
+	auto& deferred		= impl->deferredRenderer;
+	{
+		// overlaps with the render thread still submitting the previous frame
+		CS200::RenderCommandList& list = render_thread.BeginFrame();
+		deferred.Record(&list);
+		CS230::TextureManager::SetRecordingRenderer(&deferred);
+		CS200::RenderingAPI::RecordInto(&list);
+		const auto stop_recording = gsl::finally(
+			[&deferred]
+			{
+				CS200::RenderingAPI::RecordInto(nullptr);
+				CS230::TextureManager::SetRecordingRenderer(nullptr);
+				deferred.Record(nullptr);
+			});
+
+		const auto		  viewport		= impl->viewport;
+		const Math::ivec2 viewport_size = { viewport.width, viewport.height };
+		CS200::RenderingAPI::SetViewport(viewport_size, { viewport.x, viewport.y });
+		state_manager.Draw();
+	}
+
+	// ImGui's draw data from the previous frame is read by the render thread until it has been presented
+	render_thread.WaitIdle();
+	impl->viewport = ImGuiHelper::Begin();
+	state_manager.DrawImGui();
+	impl->framePacer.DrawImGui(impl->window);
+	ImGuiHelper::Render();
+
+	CS200::IRenderer2D& renderer = *CS230::TextureManager::GetRenderer2D();
+	render_thread.SubmitFrame(
+		renderer,
+		[this, &renderer, &deferred]
+		{
+			ImGuiHelper::Present();
+			deferred.SetCounters(renderer.GetDrawCallCounter(), renderer.GetDrawTextureCounter(), renderer.GetUploadedBytesCounter());
+			present();
+		});
 }
 
 bool Engine::HasGameEnded()
@@ -22,6 +22,12 @@ namespace CS230
     class GameState;
     class GameStateManager;
     class TextureManager;
+    class TransformStore;
+    class AnimationPlayer;
+    class SpriteDefinitionCache;
+    class JobSystem;
+    class RenderThread;
+    class FramePacer;
     class Font;
 
 }
@@ -65,6 +71,8 @@ struct WindowEnvironment
     double     DeltaTime   = 0.0; ///< Time in seconds since last frame
     double     ElapsedTime = 0.0; ///< Total time in seconds since application start
     Math::vec2 DisplaySize{};     ///< Current viewport size in pixels
+    double     FixedDeltaTime     = 0.0; ///< Length of one simulation tick in seconds, the dt every Update receives
+    double     InterpolationAlpha = 0.0; ///< How far rendering is between the previous and the current tick, in [0, 1)
 };
 
 /**
@@ -245,6 +253,91 @@ public:
 
     static TextManager& GetTextManager();
 
+    /**
+     * \brief Access the shared GameObject transform storage
+     * \return Reference to the TransformStore every GameObject writes its position/rotation/scale into
+     *
+     * The store outlives the game states, so objects can release their transform slot from
+     * their destructor at any point during shutdown.
+     */
+    static CS230::TransformStore& GetTransformStore();
+
+    /**
+     * \brief Access the animation playback of the state on top of the stack
+     * \return The top GameState's AnimationPlayer, or the engine's own one while no state is loaded
+     *
+     * A Sprite registers its slot here when it is loaded and keeps using that player. The state
+     * advances its player from GameState::UpdateGSComponents, so sprites of the states below
+     * the top one stay paused the way their objects' updates do. A state's sprites belong in Load
+     * or Update, its constructor runs before it is on the stack.
+     */
+    static CS230::AnimationPlayer& GetAnimationPlayer();
+
+    /**
+     * \brief Access the cache of parsed .spt and .anm files
+     * \return Reference to the SpriteDefinitionCache every Sprite loads its definition through
+     *
+     * Each file is parsed once, later Sprites of the same file share the definition.
+     * Cleared in Stop() before the textures it references are released.
+     */
+    static CS230::SpriteDefinitionCache& GetSpriteDefinitionCache();
+
+    /**
+     * \brief Access the work-stealing job scheduler
+     * \return Reference to the JobSystem used for parallel GameObject updates
+     *
+     * Workers are started in Start() (one per hardware thread besides the main thread,
+     * none on the web build) and joined in Stop(). Until then every job runs inline.
+     */
+    static CS230::JobSystem& GetJobSystem();
+
+    /**
+     * \brief Set how many fixed simulation ticks run per second
+     * \param ticks_per_second Tick rate in Hz, 60 by default
+     *
+     * Update() advances the game states in steps of exactly 1 / ticks_per_second no matter the
+     * frame rate, and renders once per frame between the last two ticks (see InterpolationAlpha).
+     */
+    static void SetTickRate(double ticks_per_second);
+
+    /**
+     * \brief Limit how many ticks one frame may run to catch up
+     * \param max_steps Ticks per frame before the rest of the backlog is dropped, 5 by default
+     *
+     * After a stall (loading, a breakpoint, a dragged window) the simulation slows down instead of
+     * running ever more ticks per frame trying to catch up.
+     */
+    static void SetMaxStepsPerFrame(int max_steps);
+
+    /**
+     * \brief Issue GL from a dedicated render thread, takes effect in Start()
+     * \param enabled True to record each frame and let the render thread submit it
+     *
+     * Game states then draw into a command list (CS200/RenderCommandList.h) and the render thread, which owns
+     * the GL context, replays it, draws ImGui and swaps while the main thread updates the next frame.
+     * States that issue GL themselves opt out with GameState::CanDrawOnRenderThread(), their frames are
+     * drawn on the main thread. Platform (detached) ImGui windows are turned off. Ignored on the web build.
+     */
+    static void SetRenderThreadEnabled(bool enabled);
+
+    /**
+     * \brief Access the render thread
+     * \return Reference to the RenderThread, not running unless SetRenderThreadEnabled(true) was called before Start()
+     *
+     * GL work outside of a game state's Draw takes the context through CS230::GLContextScope, which does
+     * nothing while the render thread is not running.
+     */
+    static CS230::RenderThread& GetRenderThread();
+
+    /**
+     * \brief Access the frame pacer
+     * \return Reference to the FramePacer that caps the frame rate and times presents
+     *
+     * Frames are not capped by default, vsync (Window::SetVSync) paces them. The target FPS, low latency
+     * mode and vsync can also be changed from the Frame Pacing ImGui window, F3 shows it.
+     */
+    static CS230::FramePacer& GetFramePacer();
+
 
 public:
     /**
@@ -353,4 +446,10 @@ private:
     // Internal method for updating frame timing and window environment
     // Called each frame to maintain current runtime statistics
     void updateEnvironment();
+
+    // draw the game states and ImGui, either straight to GL or recorded for the render thread
+    void drawImmediate();
+    void drawRecorded();
+    // swap buffers and report the present to the frame pacer, on the thread holding the GL context
+    void present();
 };
@@ -10,13 +10,16 @@
 
 #include "Font.h"
 
+#include "BakedAsset.h"
 #include "CS200/Image.h"
 #include "Engine.h"
 #include "Error.h"
+#include "Logger.h"
 #include "Matrix.h"
 #include "Path.h"
 #include "TextureManager.h"
 #include <algorithm>
+#include <functional>
 #include <stb_image.h>
 
 /*
@@ -25,147 +28,162 @@
  * 3. Render text to texture or directly to screen using character sprites
  * 4. Support for colored text and transformation matrices
  */
+namespace
+{
+    CS200::RGBA get_pixel(const CS200::Image& image, Math::ivec2 texel) // tl is (0,0) !!
+    {
+        const CS200::RGBA* image_data = image.data();
+        const auto         image_size = image.GetSize();
+        const int          index      = texel.x + texel.y * image_size.x;
+        return CS200::rgba_to_abgr(image_data[index]); // endian!!!
+    }
+}
+
 namespace CS230
 {
-    Font::Font(const std::filesystem::path& file_name) : texture(file_name), image(file_name /*std::filesystem::path("Assets/Test.png")*/, is_image_flipped)
+    Font::Font(const std::filesystem::path& file_name) : texture(file_name)
     {
+        const std::filesystem::path font_path = assets::locate_asset(file_name);
+        if (const auto baked_path = baked::FindBaked(font_path))
+        {
+            const assets::AssetData file   = assets::read_asset(*baked_path);
+            const auto              glyphs = baked::ReadFontGlyphs(file.bytes);
+            if (glyphs.size() == char_rects.size())
+            {
+                for (size_t i = 0; i < char_rects.size(); ++i)
+                {
+                    char_rects[i] = { { glyphs[i].left, glyphs[i].bottom }, { glyphs[i].right, glyphs[i].top } };
+                }
+                return;
+            }
+            LOG_ERROR("Ignoring {}, not a valid baked glyph table", baked_path->generic_string());
+        }
+
         //  * Font Image Requirements:
         //  * - Characters arranged horizontally in a single row
         //  * - First pixel must be white (0xFFFFFFFF) as a format marker
-
-
-        /*[[maybe_unused]] const auto _00       = GetPixel({ 0, 0 });
-        [[maybe_unused]] const auto _00_array = CS200::ColorArray(_00);
-
-        [[maybe_unused]] const auto _10       = GetPixel({ 1, 0 });
-        [[maybe_unused]] const auto _10_array = CS200::ColorArray(_10);
-
-        [[maybe_unused]] const auto _20       = GetPixel({ 2, 0 });
-        [[maybe_unused]] const auto _20_array = CS200::ColorArray(_20);
-
-        [[maybe_unused]] const auto _30       = GetPixel({ 3, 0 });
-        [[maybe_unused]] const auto _30_array = CS200::ColorArray(_30);
-
-        [[maybe_unused]] const auto _01       = GetPixel({ 0, 1 });
-        [[maybe_unused]] const auto _01_array = CS200::ColorArray(_01);
-
-        [[maybe_unused]] const auto _11       = GetPixel({ 1, 1 });
-        [[maybe_unused]] const auto _11_array = CS200::ColorArray(_11);
-
-        [[maybe_unused]] const auto _21       = GetPixel({ 2, 1 });
-        [[maybe_unused]] const auto _21_array = CS200::ColorArray(_21);
-
-        [[maybe_unused]] const auto _31       = GetPixel({ 3, 1 });
-        [[maybe_unused]] const auto _31_array = CS200::ColorArray(_31);
-
-        [[maybe_unused]] const auto _02       = GetPixel({ 0, 2 });
-        [[maybe_unused]] const auto _02_array = CS200::ColorArray(_02);
-
-        [[maybe_unused]] const auto _12       = GetPixel({ 1, 2 });
-        [[maybe_unused]] const auto _12_array = CS200::ColorArray(_12);
-
-        [[maybe_unused]] const auto _22       = GetPixel({ 2, 2 });
-        [[maybe_unused]] const auto _22_array = CS200::ColorArray(_22);
-
-        [[maybe_unused]] const auto _32       = GetPixel({ 3, 2 });
-        [[maybe_unused]] const auto _32_array = CS200::ColorArray(_32);*/
-
-
-        if (GetPixel({ 0, 0 }) == CS200::WHITE)
-        {
-            FindCharRects();
-        }
-        else
-        {
-            Engine::GetLogger().LogError("Font " + file_name.string() + " texture has wrong format!");
-            throw std::runtime_error("Font fromat error");
-        }
         //  * - Color changes between characters indicate boundaries
         //  * - Characters cover ASCII range from space (' ') to 'z'
-        //  * - Image should contain exactly the expected number of characters
-        //  *
-        //  * Parsing Process:
-        //  * The constructor scans the top row of pixels to detect color changes,
-        //  * which indicate character boundaries. Each character's rectangular
-        //  * region is calculated and stored for later use during text rendering.
         //  *
         //  * Error Handling:
         //  * If the font file is malformed (wrong format, missing characters, or
         //  * incorrect structure), the constructor will throw an error to indicate
         //  * the problem. This ensures that only valid fonts are used for rendering.
+        const CS200::Image image(font_path, is_image_flipped);
+        if (get_pixel(image, { 0, 0 }) != CS200::WHITE)
+        {
+            LOG_ERROR("Font {} texture has wrong format!", file_name.string());
+        }
+        char_rects = ScanCharRects(image);
     }
 
-    std::shared_ptr<Texture> Font::PrintToTexture(const std::string& text, CS200::RGBA color)
+    std::shared_ptr<Texture> Font::PrintToTexture(std::string_view text, CS200::RGBA color)
     {
-        const auto&       window_environment = Engine::GetWindowEnvironment();
-        //  * Advanced Caching System:
-        //  * - Cache key: Combination of text string and color (format: "text_0xCOLOR")
-        const std::string cache_key{ text + std::string("_0x") + std::to_string(color) };
-
-        //  * - Frame tracking: Each cached texture records when it was last accessed
-        for (auto it = textures.begin(); it != textures.end();)
+        if (text.empty())
         {
-            // ++(it->second.time);
-            //  * - Reference counting: Uses shared_ptr for automatic memory management
+            return nullptr;
+        }
 
-            //  * - Intelligent cleanup: Removes old textures only when they have single reference and are older than 60 frames
-            if ((window_environment.FrameCount - it->second.timestamp) > 60 && it->second.texture.use_count() == 1)
-            {
-                it = textures.erase(it);
-            }
-            else
+        const TextKeyView key{ text, color, hash_text(text, color) };
+        if (const auto found = textures.find(key); found != textures.end())
+        {
+            CachedText& entry = found->second;
+            if (&entry != most_recent)
             {
-                ++it;
+                unlink(entry);
+                link_front(entry);
             }
+            ++cache_stats.hits;
+            return entry.texture;
         }
+        ++cache_stats.misses;
 
-        //  * - Performance optimization: Eliminates redundant text rendering operations
-
-        //          * Caching Strategy:
-        //  * 1. Check cache using generated key (text + color combination)
-        //  * 2. If found: Update last-used frame timestamp and return cached texture
-        //  * 3. If not found: Create new texture, cache it, and return
-        //  * 4. Periodic cleanup: Remove textures older than 60 frames with reference count of 1
-
-        if (textures.find(cache_key) == textures.end())
+        const Math::ivec2 text_size       = MeasureText(text);
+        auto&             texture_manager = Engine::GetTextureManager();
+        texture_manager.StartRenderTextureMode(text_size.x, text_size.y);
+        Math::TransformationMatrix matrix{};
+        for (const char c : text)
         {
-            //          * Rendering Process (for new textures):
-            //  * 1. Measure total text dimensions to determine optimal texture size
-            const Math::ivec2 text_size = MeasureText(text /*std::string("hello")*/);
-
-            //  * 2. Create render target texture using TextureManager
-            auto& texture_manager = Engine::GetTextureManager();
-            texture_manager.StartRenderTextureMode(text_size.x, text_size.y);
-            Math::TransformationMatrix matrix{};
-            for (const char c : text /*std::string("hello")*/)
-            {
-                DrawChar(matrix, c, color);
-            }
-            auto target_texture = texture_manager.EndRenderTextureMode();
-            //  * 3. Render each character from font atlas to the target texture
+            DrawChar(matrix, c, color);
+        }
+        std::shared_ptr<Texture> target_texture = texture_manager.EndRenderTextureMode();
+        LOG_DEBUG("Loading Texture: {}", text);
+
+        const auto  inserted = textures.try_emplace(TextKey{ std::string(text), color, key.hash }).first;
+        CachedText& entry    = inserted->second;
+        entry.texture        = target_texture;
+        entry.bytes          = static_cast<size_t>(text_size.x) * static_cast<size_t>(text_size.y) * num_channels;
+        entry.key            = &inserted->first;
+        link_front(entry);
+        cache_stats.bytes += entry.bytes;
+        cache_stats.entries = textures.size();
+        evict_to_budget();
+        return target_texture;
+    }
+
+    void Font::SetCacheBudget(size_t bytes)
+    {
+        cache_budget = bytes;
+        evict_to_budget();
+    }
 
-            //  * 4. Store in cache with current frame timestamp
-            //  * 5. Return shared_ptr for client use
+    size_t Font::hash_text(std::string_view text, CS200::RGBA color)
+    {
+        size_t hash = std::hash<std::string_view>{}(text);
+        hash ^= std::hash<CS200::RGBA>{}(color) + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+        return hash;
+    }
 
-            textures[cache_key] = { window_environment.FrameCount, target_texture };
+    void Font::unlink(CachedText& entry)
+    {
+        (entry.newer != nullptr ? entry.newer->older : most_recent)  = entry.older;
+        (entry.older != nullptr ? entry.older->newer : least_recent) = entry.newer;
+        entry.newer                                                  = nullptr;
+        entry.older                                                  = nullptr;
+    }
 
-            Engine::GetLogger().LogEvent("Loading Texture: " + text);
+    void Font::link_front(CachedText& entry)
+    {
+        entry.older = most_recent;
+        if (most_recent != nullptr)
+        {
+            most_recent->newer = &entry;
         }
         else
         {
-            textures[cache_key].timestamp = window_environment.FrameCount;
+            least_recent = &entry;
         }
-        return textures[cache_key].texture;
+        most_recent = &entry;
     }
 
-    void Font::FindCharRects()
+    void Font::evict_to_budget()
     {
-        CS200::RGBA check_color = GetPixel({ 0, 0 });
+        // the newest entry stays even if it alone is over budget, it is about to be drawn
+        while (cache_stats.bytes > cache_budget && least_recent != nullptr && least_recent != most_recent)
+        {
+            CachedText& victim = *least_recent;
+            unlink(victim);
+            cache_stats.bytes -= victim.bytes;
+            ++cache_stats.evictions;
+            textures.erase(textures.find(*victim.key));
+        }
+        cache_stats.entries = textures.size();
+    }
+
+    std::array<Math::irect, Font::num_chars> Font::ScanCharRects(const CS200::Image& image)
+    {
+        CS200::RGBA check_color = get_pixel(image, { 0, 0 });
         CS200::RGBA next_color;
+        if (check_color != CS200::WHITE)
+        {
+            throw std::runtime_error("Font fromat error");
+        }
 
-        int height = texture.GetSize().y;
+        const int height      = image.GetSize().y;
+        const int width_limit = image.GetSize().x;
 
-        int x = 0;
+        std::array<Math::irect, num_chars> rects{};
+        int                                x = 0;
         for (int index = 0; index < num_chars; index++)
         {
             int width = 0;
@@ -173,33 +191,41 @@ namespace CS230
             do
             {
                 width++;
-                next_color = GetPixel({ x + width, 0 });
+                if (x + width >= width_limit)
+                {
+                    // the last glyph has no color change after it, it runs to the edge of the image
+                    if (index != num_chars - 1)
+                    {
+                        throw std::runtime_error("Font fromat error");
+                    }
+                    break;
+                }
+                next_color = get_pixel(image, { x + width, 0 });
             } while (check_color == next_color);
 
             check_color = next_color;
 
-            char_rects[index].point_2 = { x + width , height };
-            char_rects[index].point_1 = { x, 1  }; // 1 mean ignore line above
+            rects[static_cast<size_t>(index)].point_2 = { x + width, height };
+            rects[static_cast<size_t>(index)].point_1 = { x, 1 }; // 1 mean ignore line above
             x += width;
         }
-        // stbi_image_free(image_data);
-        // image.~Image();
+        return rects;
     }
 
     Math::irect& Font::GetCharRect(char c)
     {
         if (c >= ' ' && c <= 'z')
         {
-            return char_rects[c - ' '];
+            return char_rects[static_cast<size_t>(c - ' ')];
         }
         else
         {
-            Engine::GetLogger().LogError("Char '" + std::to_string(c) + "' not found");
+            LOG_ERROR("Char '{}' not found", static_cast<int>(c));
             return char_rects[0];
         }
     }
 
-    Math::ivec2 Font::MeasureText(std::string text)
+    Math::ivec2 Font::MeasureText(std::string_view text)
     {
         Math::ivec2 text_size = GetCharRect(text[0]).Size();
         for (size_t i = 1; i < text.size(); ++i)
@@ -229,25 +255,4 @@ namespace CS230
 		}
 		matrix *= Math::TranslationMatrix(Math::ivec2{ display_rect.Size().x, 0 });
 	}
-
-    CS200::RGBA Font::GetPixel(Math::ivec2 texel) // tl is (0,0) !!
-    {
-        const CS200::RGBA* image_data = image.data();
-        const auto         image_size = image.GetSize();
-        // if (is_image_flipped)
-        //{
-        //     const int   index        = (image_size.x * image_size.y - 1) - (texel.x + texel.y * image_size.x);
-        //     CS200::RGBA return_color = CS200::rgba_to_abgr(CS200::argb_to_rgba(image_data[index])); // very weird..argb?
-
-        //    return return_color; // endian!!!
-        //}
-        // else
-        //{
-        const int   index        = texel.x + texel.y * image_size.x;
-        CS200::RGBA return_color = CS200::rgba_to_abgr(image_data[index]);
-
-        return return_color; // endian!!!
-        //}
-    }
-
-}    
+}
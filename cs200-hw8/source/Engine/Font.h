@@ -12,10 +12,13 @@
 #include "Rect.h"
 #include "Texture.h"
 #include "Vec2.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
-#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace CS230
@@ -59,6 +62,7 @@ namespace CS230
     class Font
     {
     public:
+        friend class TextLayout; // reads the glyph rectangles and the atlas
         /**
          * \brief Load and initialize a bitmap font from an image file
          * \param file_name Path to the font texture image file
@@ -87,9 +91,25 @@ namespace CS230
          *
          * The loaded font is immediately ready for text rendering operations
          * and will remain valid for the lifetime of the Font object.
+         *
+         * Baked Glyph Table:
+         * When asset_baker has written a .fntb next to the image (Font1.png -> Font1.fntb)
+         * the character rectangles are read from it and the image is never decoded on the CPU.
          */
         Font(const std::filesystem::path& file_name);
 
+        static constexpr int num_chars = 'z' - ' ' + 1;
+
+        /**
+         * \brief Find the character rectangles of a font image by scanning its top row
+         * \param image Font image loaded without a vertical flip
+         * \return One rectangle per character from ' ' to 'z'
+         *
+         * Shared by the constructor and the offline asset baker. Throws if the first
+         * pixel is not the white format marker.
+         */
+        static std::array<Math::irect, num_chars> ScanCharRects(const CS200::Image& image);
+
         /**
          * \brief Render text string to a cached texture for efficient reuse
          * \param text String of text to render using this font
@@ -101,31 +121,31 @@ namespace CS230
          * This approach enables text to be drawn with transformations, effects,
          * and blending modes just like sprite graphics.
          *
-         * Advanced Caching System:
-         * - Cache key: Combination of text string and color (format: "text_0xCOLOR")
-         * - Frame tracking: Each cached texture records when it was last accessed
-         * - Reference counting: Uses shared_ptr for automatic memory management
-         * - Intelligent cleanup: Removes old textures only when they have single reference and are older than 60 frames
-         * - Performance optimization: Eliminates redundant text rendering operations
+         * Caching System:
+         * - Cache key: the text and color, hashed once per call; the hash is kept with the
+         *   entry so lookups compare the hash first and the text only on a match
+         * - Recency: entries sit on an intrusive least recently used list, a hit moves its
+         *   entry to the front without allocating or walking the cache
+         * - Budget: texture memory of all cached entries (width * height * 4 bytes) is kept
+         *   under SetCacheBudget, a miss evicts from the back of the list until it fits
+         * - Reference counting: an evicted texture stays alive for as long as somebody still
+         *   holds the returned shared_ptr, the cache only drops its own reference
          *
          * Caching Strategy:
-         * 1. Check cache using generated key (text + color combination)
-         * 2. If found: Update last-used frame timestamp and return cached texture
-         * 3. If not found: Create new texture, cache it, and return
-         * 4. Periodic cleanup: Remove textures older than 60 frames with reference count of 1
+         * 1. Look the (text, color) hash up in the cache index
+         * 2. If found: move the entry to the front of the list and return its texture
+         * 3. If not found: render a new texture, put it at the front and return it
+         * 4. Evict least recently used entries while the cache is over budget; the newest
+         *    entry is always kept, even when it alone is larger than the budget
          *
          * Rendering Process (for new textures):
          * 1. Measure total text dimensions to determine optimal texture size
          * 2. Create render target texture using TextureManager
          * 3. Render each character from font atlas to the target texture
-         * 4. Store in cache with current frame timestamp
-         * 5. Return shared_ptr for client use
+         * 4. Return shared_ptr for client use
          *
-         * Memory Management Benefits:
-         * - Shared ownership: Multiple objects can reference the same text texture
-         * - Automatic cleanup: Textures are removed when no longer referenced elsewhere
-         * - Frame-based aging: Prevents immediate removal of frequently used text
-         * - Cache efficiency: Only removes textures that are truly unused
+         * Drawing cached text costs one hash of the string and one map lookup, no matter how
+         * many strings are cached. GetCacheStats reports hits, misses and evictions.
          *
          * Text-to-Texture Advantages:
          * - Caching eliminates redundant text rendering for repeated strings
@@ -134,35 +154,103 @@ namespace CS230
          * - Provides consistent rendering performance regardless of text complexity
          * - Allows text to be treated as standard texture assets
          *
+         * Static Text Only:
+         * Every string that is not cached yet costs a new framebuffer and texture and
+         * restarts the renderer scene twice. Use TextManager::DrawText for text that changes,
+         * it lays the string out once into glyph quads drawn straight from the atlas.
+         *
          * Color and Formatting:
          * The color parameter applies a tint to the entire text string while
          * preserving original font character shapes, anti-aliasing, and spacing.
          * Different colors of the same text are cached separately for maximum
          * flexibility without color bleeding between cache entries.
          */
-        std::shared_ptr<Texture> PrintToTexture(const std::string& text, CS200::RGBA color = 0xFFFFFFFF);
+        std::shared_ptr<Texture> PrintToTexture(std::string_view text, CS200::RGBA color = 0xFFFFFFFF);
+
+        struct CacheStats
+        {
+            uint64_t hits      = 0;
+            uint64_t misses    = 0;
+            uint64_t evictions = 0;
+            size_t   entries   = 0;
+            size_t   bytes     = 0; // texture memory held by the cache
+        };
+
+        static constexpr size_t DefaultCacheBudget = 16 * 1024 * 1024;
+
+        /**
+         * \brief Set how much texture memory PrintToTexture may keep cached
+         * \param bytes Budget in bytes, entries are evicted least recently used first
+         */
+        void       SetCacheBudget(size_t bytes);
+        CacheStats GetCacheStats() const { return cache_stats; }
 
     private:
-        void         FindCharRects();
         Math::irect& GetCharRect(char c);
-        Math::ivec2  MeasureText(std::string text);
+        Math::ivec2  MeasureText(std::string_view text);
         void         DrawChar(Math::TransformationMatrix& matrix, char c, CS200::RGBA color = CS200::WHITE);
-        CS200::RGBA  GetPixel(Math::ivec2 texel);
 
 
         Texture texture;
 
-        struct TimeTexture
+        struct TextKey
+        {
+            std::string text;
+            CS200::RGBA color;
+            size_t      hash;
+        };
+
+        struct TextKeyView
+        {
+            std::string_view text;
+            CS200::RGBA      color;
+            size_t           hash;
+        };
+
+        struct TextKeyHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(const TextKey& key) const { return key.hash; }
+
+            size_t operator()(const TextKeyView& key) const { return key.hash; }
+        };
+
+        struct TextKeyEqual
+        {
+            using is_transparent = void;
+
+            template <typename A, typename B>
+            bool operator()(const A& a, const B& b) const
+            {
+                return a.hash == b.hash && a.color == b.color && std::string_view(a.text) == std::string_view(b.text);
+            }
+        };
+
+        // map nodes never move, so the list links point straight at them
+        struct CachedText
         {
-            uint64_t                 timestamp{};
             std::shared_ptr<Texture> texture{};
+            size_t                   bytes = 0;
+            const TextKey*           key   = nullptr;
+            CachedText*              newer = nullptr;
+            CachedText*              older = nullptr;
         };
 
-        std::map<const std::string, TimeTexture> textures; // <key, <time stamp, texture shared_ptr>>
-        static constexpr int                     num_chars    = 'z' - ' ' + 1;
+        static size_t hash_text(std::string_view text, CS200::RGBA color);
+
+        void unlink(CachedText& entry);
+        void link_front(CachedText& entry);
+        void evict_to_budget();
+
+        std::unordered_map<TextKey, CachedText, TextKeyHash, TextKeyEqual> textures;
+        CachedText*                                                        most_recent  = nullptr;
+        CachedText*                                                        least_recent = nullptr;
+        size_t                                                             cache_budget = DefaultCacheBudget;
+        CacheStats                                                         cache_stats{};
+
         static constexpr int                     num_channels = 4; // rgba
-        Math::irect                              char_rects[num_chars];
-        CS200::Image                             image;
+        std::array<Math::irect, num_chars>       char_rects;
         Math::ivec2                              dimensions;
         static constexpr bool                    is_image_flipped = false;
     };
@@ -0,0 +1,209 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  FramePacer.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "FramePacer.h"
+
+#include "Engine.h"
+#include "RenderThread.h"
+#include "Window.h"
+
+#include <imgui.h>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    using clock = CS230::FramePacer::clock;
+
+    clock::duration to_duration(double seconds)
+    {
+        return std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(seconds));
+    }
+
+    double milliseconds_between(clock::time_point from, clock::time_point to)
+    {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    }
+
+    // sleeps while more than spin_threshold is left, then spins to the deadline
+    void wait_until(clock::time_point deadline, double spin_threshold)
+    {
+        const auto spin = to_duration(spin_threshold);
+        for (auto now = clock::now(); now < deadline; now = clock::now())
+        {
+            if (deadline - now > spin)
+            {
+                std::this_thread::sleep_for(deadline - now - spin);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+namespace CS230
+{
+    void FramePacer::SetTargetFPS(double frames_per_second)
+    {
+        if (frames_per_second < 0.0)
+        {
+            throw std::runtime_error("Target FPS can't be negative");
+        }
+        target_fps = frames_per_second;
+        std::lock_guard lock(present_mutex);
+        present_intervals.Clear();
+    }
+
+    void FramePacer::SetLowLatency(bool enabled) noexcept
+    {
+        low_latency = enabled;
+        std::lock_guard lock(present_mutex);
+        present_intervals.Clear();
+    }
+
+    void FramePacer::SetSpinThreshold(double seconds)
+    {
+        if (seconds < 0.0)
+        {
+            throw std::runtime_error("Spin threshold can't be negative");
+        }
+        spin_threshold = seconds;
+    }
+
+    void FramePacer::SetPresentRate(double hertz) noexcept
+    {
+        present_rate = hertz;
+        std::lock_guard lock(present_mutex);
+        present_intervals.Clear();
+    }
+
+    double FramePacer::frame_period() const noexcept
+    {
+        if (target_fps > 0.0)
+        {
+            return 1.0 / target_fps;
+        }
+        if (low_latency && present_rate > 0.0)
+        {
+            return 1.0 / present_rate;
+        }
+        return 0.0;
+    }
+
+    void FramePacer::WaitForNextFrame()
+    {
+        const double period = frame_period();
+#if !defined(__EMSCRIPTEN__) // the browser schedules the frames
+        if (period > 0.0)
+        {
+            clock::time_point deadline = next_frame_start;
+            if (low_latency)
+            {
+                // start so that a slow (95th percentile) frame still finishes just before the next present
+                clock::time_point presented;
+                {
+                    std::lock_guard lock(present_mutex);
+                    presented = last_present;
+                }
+                deadline = presented + to_duration(period - work_times.Get().p95 / 1000.0 - LowLatencyMargin);
+            }
+            wait_until(deadline, spin_threshold);
+        }
+#endif
+        // keep the schedule so oversleeping one frame does not push the rest back, unless a whole period was lost
+        const auto now  = clock::now();
+        const auto step = to_duration(period);
+        next_frame_start = next_frame_start + step > now ? next_frame_start + step : now + step;
+        frame_start      = now;
+    }
+
+    void FramePacer::EndFrameWork()
+    {
+        work_times.Add(milliseconds_between(frame_start, clock::now()));
+    }
+
+    void FramePacer::MarkPresented()
+    {
+        const auto      now = clock::now();
+        std::lock_guard lock(present_mutex);
+        if (last_present != clock::time_point{})
+        {
+            present_intervals.Add(milliseconds_between(last_present, now));
+        }
+        last_present = now;
+    }
+
+    FramePacer::PresentStats FramePacer::GetPresentStats() const
+    {
+        const double period_ms = (target_fps > 0.0 ? 1.0 / target_fps : (present_rate > 0.0 ? 1.0 / present_rate : 0.0)) * 1000.0;
+
+        PresentStats    stats;
+        std::lock_guard lock(present_mutex);
+        stats.mean_ms   = present_intervals.Mean();
+        stats.jitter_ms = present_intervals.StdDev();
+        stats.interval  = present_intervals.Get();
+        stats.work      = work_times.Get();
+        stats.samples   = present_intervals.Count();
+        stats.missed    = period_ms > 0.0 ? present_intervals.CountAbove(period_ms * 1.5) : 0;
+        return stats;
+    }
+
+    void FramePacer::DrawImGui(Window& window)
+    {
+        if (ImGui::IsKeyPressed(ImGuiKey_F3, false))
+        {
+            overlay_visible = !overlay_visible;
+        }
+        if (!overlay_visible)
+        {
+            return;
+        }
+        if (!ImGui::Begin("Frame Pacing", &overlay_visible))
+        {
+            ImGui::End();
+            return;
+        }
+
+        const PresentStats stats = GetPresentStats();
+        ImGui::Text("Present interval %.2f ms, jitter %.2f ms", stats.mean_ms, stats.jitter_ms);
+        ImGui::Text("p50 %.2f  p95 %.2f  p99 %.2f  max %.2f ms", stats.interval.p50, stats.interval.p95, stats.interval.p99, stats.interval.max);
+        ImGui::Text("Missed %d of %d frames", static_cast<int>(stats.missed), static_cast<int>(stats.samples));
+        ImGui::Text("Frame work p50 %.2f  p95 %.2f ms", stats.work.p50, stats.work.p95);
+
+        ImGui::SeparatorText("Controls");
+        int fps = static_cast<int>(target_fps);
+        if (ImGui::SliderInt("Target FPS", &fps, 0, 360, fps == 0 ? "Uncapped" : "%d"))
+        {
+            SetTargetFPS(static_cast<double>(fps));
+        }
+        bool low = low_latency;
+        if (ImGui::Checkbox("Low latency", &low))
+        {
+            SetLowLatency(low);
+        }
+        float spin_ms = static_cast<float>(spin_threshold * 1000.0);
+        if (ImGui::SliderFloat("Spin threshold (ms)", &spin_ms, 0.0f, 4.0f, "%.2f"))
+        {
+            SetSpinThreshold(static_cast<double>(spin_ms) / 1000.0);
+        }
+
+        constexpr const char* vsync_modes[] = { "Off", "On", "Adaptive" };
+        int                   vsync       = static_cast<int>(window.GetVSync());
+        if (ImGui::Combo("VSync", &vsync, vsync_modes, 3))
+        {
+            // the swap interval belongs to the context, which the render thread may be holding
+            const GLContextScope gl_context(Engine::GetRenderThread());
+            const Window::VSync  applied = window.SetVSync(static_cast<Window::VSync>(vsync));
+            SetPresentRate(applied == Window::VSync::Off ? 0.0 : static_cast<double>(window.GetRefreshRate()));
+        }
+        ImGui::End();
+    }
+}
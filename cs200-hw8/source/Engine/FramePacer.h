@@ -0,0 +1,98 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  FramePacer.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "FrameTimeHistory.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace CS230
+{
+    class Window;
+
+    // Paces the main loop. With a target FPS every frame starts one period after the previous one. In low
+    // latency mode a frame starts as late as it can and still be done by the next present, so input is
+    // sampled close to when the frame reaches the screen; without a target that is the vsync refresh.
+    // Waits sleep for most of the time and spin through the last SpinThreshold, because a sleep can
+    // overshoot by a whole scheduler tick. Present to present intervals are kept for jitter statistics.
+    class FramePacer
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+        static constexpr double DefaultSpinThreshold = 0.002; // seconds, above a 1 ms scheduler tick
+        static constexpr double LowLatencyMargin     = 0.001; // seconds left between the work and the present
+
+        // 0 leaves the frame rate to vsync
+        void   SetTargetFPS(double frames_per_second);
+        double GetTargetFPS() const noexcept
+        {
+            return target_fps;
+        }
+
+        void SetLowLatency(bool enabled) noexcept;
+        bool IsLowLatency() const noexcept
+        {
+            return low_latency;
+        }
+
+        void   SetSpinThreshold(double seconds);
+        double GetSpinThreshold() const noexcept
+        {
+            return spin_threshold;
+        }
+
+        // rate the buffer swap is locked to: the display refresh with vsync, 0 without
+        void SetPresentRate(double hertz) noexcept;
+
+        // top of the frame, before input is sampled
+        void WaitForNextFrame();
+        // once the frame has been drawn or handed to the render thread
+        void EndFrameWork();
+        // right after the buffer swap, on whichever thread swapped
+        void MarkPresented();
+
+        struct PresentStats
+        {
+            double                        mean_ms   = 0; // present to present
+            double                        jitter_ms = 0; // standard deviation of the intervals
+            FrameTimeHistory::Percentiles interval{};
+            FrameTimeHistory::Percentiles work{}; // main thread, frame start to EndFrameWork
+            size_t                        samples = 0;
+            size_t                        missed  = 0; // intervals longer than 1.5 frame periods
+        };
+
+        PresentStats GetPresentStats() const;
+
+        // stats and controls, F3 shows and hides the window
+        void DrawImGui(Window& window);
+        void SetOverlayVisible(bool visible) noexcept
+        {
+            overlay_visible = visible;
+        }
+
+    private:
+        double frame_period() const noexcept; // seconds, 0 when nothing paces the frame
+
+        double            target_fps      = 0;
+        double            present_rate    = 0;
+        double            spin_threshold  = DefaultSpinThreshold;
+        bool              low_latency     = false;
+        bool              overlay_visible = false;
+        clock::time_point next_frame_start{};
+        clock::time_point frame_start{};
+        FrameTimeHistory  work_times; // main thread only
+
+        mutable std::mutex present_mutex; // the render thread presents when it is running
+        clock::time_point  last_present{};
+        FrameTimeHistory   present_intervals;
+    };
+}
@@ -0,0 +1,72 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  FrameTimeHistory.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "FrameTimeHistory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace CS230
+{
+    void FrameTimeHistory::Add(double milliseconds)
+    {
+        samples[next] = milliseconds;
+        next          = (next + 1) % Capacity;
+        count         = std::min(count + 1, Capacity);
+    }
+
+    void FrameTimeHistory::Clear()
+    {
+        count = 0;
+        next  = 0;
+    }
+
+    FrameTimeHistory::Percentiles FrameTimeHistory::Get() const
+    {
+        if (count == 0)
+        {
+            return {};
+        }
+        std::vector<double> sorted(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(count));
+        std::sort(sorted.begin(), sorted.end());
+        const auto at = [&](double p) { return sorted[std::min(static_cast<size_t>(p * static_cast<double>(count - 1) + 0.5), count - 1)]; };
+        return { at(0.50), at(0.95), at(0.99), sorted.back() };
+    }
+
+    double FrameTimeHistory::Mean() const
+    {
+        if (count == 0)
+        {
+            return 0.0;
+        }
+        return std::accumulate(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(count), 0.0) / static_cast<double>(count);
+    }
+
+    double FrameTimeHistory::StdDev() const
+    {
+        if (count < 2)
+        {
+            return 0.0;
+        }
+        const double mean     = Mean();
+        double       variance = 0.0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            variance += (samples[i] - mean) * (samples[i] - mean);
+        }
+        return std::sqrt(variance / static_cast<double>(count - 1));
+    }
+
+    size_t FrameTimeHistory::CountAbove(double milliseconds) const
+    {
+        return static_cast<size_t>(std::count_if(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(count), [=](double sample) { return sample > milliseconds; }));
+    }
+}
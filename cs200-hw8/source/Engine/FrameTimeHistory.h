@@ -0,0 +1,42 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  FrameTimeHistory.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include <array>
+#include <cstddef>
+
+namespace CS230
+{
+    // Rolling window of frame durations in milliseconds with their percentiles.
+    class FrameTimeHistory
+    {
+    public:
+        static constexpr size_t Capacity = 240;
+
+        struct Percentiles
+        {
+            double p50 = 0, p95 = 0, p99 = 0, max = 0;
+        };
+
+        void        Add(double milliseconds);
+        void        Clear();
+        Percentiles Get() const;
+        double      Mean() const;
+        // standard deviation of the samples, the frame to frame jitter
+        double StdDev() const;
+        size_t CountAbove(double milliseconds) const;
+        size_t Count() const { return count; }
+
+    private:
+        std::array<double, Capacity> samples{};
+        size_t                       count = 0;
+        size_t                       next  = 0;
+    };
+}
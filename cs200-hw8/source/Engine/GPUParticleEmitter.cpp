@@ -0,0 +1,199 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  GPUParticleEmitter.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "GPUParticleEmitter.h"
+
+#include "../CS200/Renderer2DUtils.h"
+#include "../OpenGL/Buffer.h"
+#include "../OpenGL/GL.h"
+#include "Engine.h"
+#include "Path.h"
+#include "Random.h"
+#include "RenderThread.h"
+#include "Texture.h"
+#include "TextureManager.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CS230
+{
+    GPUParticleEmitter::GPUParticleEmitter(const std::filesystem::path& texture_file, size_t max_count, double max_life_time, double particle_size)
+        : texture(Engine::GetTextureManager().Load(texture_file)),
+          capacity(std::max<size_t>(max_count, 1)),
+          max_life(static_cast<float>(max_life_time)),
+          size(static_cast<float>(particle_size))
+    {
+        const GLContextScope gl_context(Engine::GetRenderThread());
+        const char* varyings[] = { "vCenterSize", "vTint", "vPosition", "vVelocity", "vLife", "vColor" };
+        update_shader          = OpenGL::CreateShader(
+            assets::locate_asset("Assets/shaders/GPUParticles/update.vert"), assets::locate_asset("Assets/shaders/GPUParticles/update.frag"), std::span<const char*>{ varyings });
+        draw_shader = OpenGL::CreateShader(assets::locate_asset("Assets/shaders/InstancedRenderer2D/particle.vert"), assets::locate_asset("Assets/shaders/InstancedRenderer2D/particle.frag"));
+
+        // every slot starts dead: life 0 and size 0
+        const std::vector<State> initial_state(capacity, State{});
+        for (OpenGL::BufferHandle& buffer : state_buffers)
+        {
+            buffer = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, static_cast<GLsizeiptr>(sizeof(State) * capacity));
+            OpenGL::UpdateBufferData(OpenGL::BufferType::Vertices, buffer, std::as_bytes(std::span{ initial_state }));
+        }
+
+        constexpr float quad_vertices[][4] = {
+            { -0.5f, -0.5f, 0.0f, 0.0f },
+            {  0.5f, -0.5f, 1.0f, 0.0f },
+            {  0.5f,  0.5f, 1.0f, 1.0f },
+            { -0.5f,  0.5f, 0.0f, 1.0f }
+        };
+        constexpr unsigned char quad_indices[] = { 0, 1, 2, 0, 2, 3 };
+        quad_vertex_buffer                     = OpenGL::CreateBuffer(OpenGL::BufferType::Vertices, std::as_bytes(std::span{ quad_vertices }));
+        quad_index_buffer                      = OpenGL::CreateBuffer(OpenGL::BufferType::Indices, std::as_bytes(std::span{ quad_indices }));
+
+        using namespace OpenGL::Attribute;
+        for (size_t i = 0; i < state_buffers.size(); ++i)
+        {
+            // update reads the whole record, locations 0..5
+            update_models[i] = OpenGL::CreateVertexArrayObject({ OpenGL::VertexBuffer{ state_buffers[i], { Float3, UInt, Float2, Float2, Float2, UByte4ToNormalized } } });
+            // draw reads the quad corners at 0..1 and the record as an instance at 2..7, particle.vert only uses 2 and 3
+            draw_models[i] = OpenGL::CreateVertexArrayObject(
+                { OpenGL::VertexBuffer{ quad_vertex_buffer, { Float2, Float2 } },
+                  OpenGL::VertexBuffer{ state_buffers[i],
+                                        { Float3.WithDivisor(1), UByte4ToNormalized.WithDivisor(1), Float2.WithDivisor(1), Float2.WithDivisor(1), Float2.WithDivisor(1),
+                                          UByte4ToNormalized.WithDivisor(1) } } },
+                quad_index_buffer);
+        }
+
+        GL::UseProgram(draw_shader.Shader);
+        GL::Uniform1i(GL::GetUniformLocation(draw_shader.Shader, "uTexture"), 0);
+        GL::Uniform4f(GL::GetUniformLocation(draw_shader.Shader, "uTexCoordRect"), 0.0f, 0.0f, 1.0f, 1.0f);
+        draw_depth_location = GL::GetUniformLocation(draw_shader.Shader, "uDepth");
+        GL::UseProgram(0);
+        // every renderer binds its camera block to binding 0, so the draw follows whichever one is active
+        GL::UniformBlockBinding(draw_shader.Shader, GL::GetUniformBlockIndex(draw_shader.Shader, "NDC"), 0);
+    }
+
+    GPUParticleEmitter::~GPUParticleEmitter()
+    {
+        const GLContextScope gl_context(Engine::GetRenderThread());
+        OpenGL::DestroyShader(update_shader);
+        OpenGL::DestroyShader(draw_shader);
+        GL::DeleteVertexArrays(static_cast<GLsizei>(update_models.size()), update_models.data());
+        GL::DeleteVertexArrays(static_cast<GLsizei>(draw_models.size()), draw_models.data());
+        GL::DeleteBuffers(static_cast<GLsizei>(state_buffers.size()), state_buffers.data());
+        GL::DeleteBuffers(1, &quad_vertex_buffer);
+        GL::DeleteBuffers(1, &quad_index_buffer);
+    }
+
+    void GPUParticleEmitter::Emit(size_t count, Math::vec2 emitter_position, Math::vec2 emitter_velocity, Math::vec2 direction, double spread, CS200::RGBA color)
+    {
+        count = std::min(count, capacity);
+        if (count == 0)
+        {
+            return;
+        }
+        pending_emits.push_back(PendingEmit{ static_cast<uint32_t>(next_slot), static_cast<uint32_t>(count), emitter_position, emitter_velocity, direction, spread, color });
+        next_slot = (next_slot + count) % capacity;
+    }
+
+    void GPUParticleEmitter::Update(double dt)
+    {
+        pending_dt += dt;
+    }
+
+    void GPUParticleEmitter::Draw(const Math::TransformationMatrix& camera_matrix, float depth)
+    {
+        // already held when the engine draws the frame on the main thread, this only guards a stray call
+        const GLContextScope gl_context(Engine::GetRenderThread());
+        const double scale          = std::sqrt(std::abs(camera_matrix[0][0] * camera_matrix[1][1] - camera_matrix[0][1] * camera_matrix[1][0]));
+        const float  size_on_screen = size * static_cast<float>(scale);
+        simulate(camera_matrix, size_on_screen);
+
+        GL::UseProgram(draw_shader.Shader);
+        GL::Uniform1f(draw_depth_location, depth);
+        GL::ActiveTexture(GL_TEXTURE0);
+        GL::BindTexture(GL_TEXTURE_2D, texture->GetHandle());
+        GL::BindVertexArray(draw_models[current]);
+        GL::DrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr, static_cast<GLsizei>(capacity));
+        GL::BindVertexArray(0);
+        GL::BindTexture(GL_TEXTURE_2D, 0);
+        GL::UseProgram(0);
+    }
+
+    void GPUParticleEmitter::simulate(const Math::TransformationMatrix& camera_matrix, float size_on_screen)
+    {
+        GL::UseProgram(update_shader.Shader);
+        GL::Uniform1i(uniform("uCapacity"), static_cast<GLint>(capacity));
+        GL::Uniform1f(uniform("uMaxLife"), max_life);
+        GL::Uniform2f(uniform("uGravity"), static_cast<float>(gravity.x), static_cast<float>(gravity.y));
+        GL::UniformMatrix3fv(uniform("uCamera"), 1, GL_FALSE, CS200::Renderer2DUtils::to_opengl_mat3(camera_matrix).data());
+        GL::Uniform1f(uniform("uSize"), size_on_screen);
+        GL::Enable(GL_RASTERIZER_DISCARD);
+
+        // one pass normally; more than MaxEmitsPerPass emits in a frame get extra passes with no time step
+        size_t emitted = 0;
+        do
+        {
+            const size_t                              batch = std::min<size_t>(pending_emits.size() - emitted, MaxEmitsPerPass);
+            std::array<GLint, MaxEmitsPerPass * 2>    ranges{};
+            std::array<float, MaxEmitsPerPass * 4>    motions{}, directions{}, colors{};
+            for (size_t i = 0; i < batch; ++i)
+            {
+                const PendingEmit& emit = pending_emits[emitted + i];
+                ranges[i * 2 + 0]       = static_cast<GLint>(emit.first_slot);
+                ranges[i * 2 + 1]       = static_cast<GLint>(emit.count);
+                motions[i * 4 + 0]      = static_cast<float>(emit.position.x);
+                motions[i * 4 + 1]      = static_cast<float>(emit.position.y);
+                motions[i * 4 + 2]      = static_cast<float>(emit.velocity.x);
+                motions[i * 4 + 3]      = static_cast<float>(emit.velocity.y);
+                directions[i * 4 + 0]   = static_cast<float>(emit.direction.x);
+                directions[i * 4 + 1]   = static_cast<float>(emit.direction.y);
+                directions[i * 4 + 2]   = static_cast<float>(emit.spread);
+                const auto rgba         = CS200::ColorArray(emit.color);
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    colors[i * 4 + c] = static_cast<float>(rgba[c]) / 255.0f;
+                }
+            }
+            emitted += batch;
+
+            GL::Uniform1i(uniform("uEmitCount"), static_cast<GLint>(batch));
+            if (batch > 0)
+            {
+                GL::Uniform2iv(uniform("uEmitRange[0]"), static_cast<GLsizei>(batch), ranges.data());
+                GL::Uniform4fv(uniform("uEmitMotion[0]"), static_cast<GLsizei>(batch), motions.data());
+                GL::Uniform4fv(uniform("uEmitDirection[0]"), static_cast<GLsizei>(batch), directions.data());
+                GL::Uniform4fv(uniform("uEmitColor[0]"), static_cast<GLsizei>(batch), colors.data());
+            }
+            GL::Uniform1f(uniform("uDeltaTime"), static_cast<float>(pending_dt));
+            GL::Uniform1ui(uniform("uSeed"), static_cast<GLuint>(util::random(0, 1 << 30)));
+            pending_dt = 0.0;
+
+            const size_t next = 1 - current;
+            GL::BindVertexArray(update_models[current]);
+            GL::BindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, state_buffers[next]);
+            GL::BeginTransformFeedback(GL_POINTS);
+            GL::DrawArrays(GL_POINTS, 0, static_cast<GLsizei>(capacity));
+            GL::EndTransformFeedback();
+            // WebGL2 refuses to read a buffer that is still bound for capture
+            GL::BindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+            current = next;
+        } while (emitted < pending_emits.size());
+
+        pending_emits.clear();
+        GL::Disable(GL_RASTERIZER_DISCARD);
+        GL::BindVertexArray(0);
+        GL::UseProgram(0);
+    }
+
+    GLint GPUParticleEmitter::uniform(const char* name) const
+    {
+        // optimized out uniforms are missing from the cache, GL ignores location -1
+        const auto found = update_shader.UniformLocations.find(name);
+        return found != update_shader.UniformLocations.end() ? found->second : -1;
+    }
+}
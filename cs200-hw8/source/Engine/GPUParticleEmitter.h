@@ -0,0 +1,105 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  GPUParticleEmitter.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#pragma once
+#include "../CS200/RGBA.h"
+#include "../OpenGL/Shader.h"
+#include "../OpenGL/VertexArray.h"
+#include "Component.h"
+#include "Matrix.h"
+#include "Vec2.h"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace CS230
+{
+    class Texture;
+
+    // Particle backend that never brings particle state back to the CPU.
+    // The state lives in two GPU buffers that are ping-ponged with transform feedback: one vertex shader pass
+    // (rasterizer off) spawns the queued emits, integrates and ages every slot and writes the next state.
+    // The same buffer is then drawn as instances with the InstancedRenderer2D particle shader.
+    // Dead slots stay in the buffer with size 0, so every draw covers Capacity() instances.
+    //
+    // Emit has ParticleManager's signature and the same ring buffer overwrite, so an emitter can switch
+    // between ParticleManager, ParticleEmitter and this by changing the component type.
+    class GPUParticleEmitter : public Component
+    {
+    public:
+        static constexpr int MaxEmitsPerPass = 8; // MAX_EMITS in GPUParticles/update.vert
+
+        GPUParticleEmitter(const std::filesystem::path& texture_file, size_t max_count, double max_life, double particle_size);
+        ~GPUParticleEmitter() override;
+
+        GPUParticleEmitter(const GPUParticleEmitter&)            = delete;
+        GPUParticleEmitter& operator=(const GPUParticleEmitter&) = delete;
+
+        void Emit(size_t count, Math::vec2 emitter_position, Math::vec2 emitter_velocity, Math::vec2 direction, double spread, CS200::RGBA color = CS200::WHITE);
+        // only accumulates time, the simulation pass runs in Draw right before the particles are rendered
+        void Update(double dt) override;
+        // Issued straight to GL rather than queued in the renderer's batch, so it sorts against sprites through the depth buffer.
+        // The GL calls never go into a RenderCommandList, so the owning state must return false from
+        // GameState::CanDrawOnRenderThread() or the particles land before the recorded frame is replayed.
+        void Draw(const Math::TransformationMatrix& camera_matrix, float depth = 0.5f);
+
+        void SetGravity(Math::vec2 acceleration) { gravity = acceleration; }
+
+        size_t Capacity() const { return capacity; }
+
+    private:
+        // one transform feedback record, the first 16 bytes are laid out like CS200::ParticleInstance
+        struct State
+        {
+            float    center_size[3]; // screen space center and size, what the draw reads
+            uint32_t tint;           // color with alpha faded by life
+            float    position[2];
+            float    velocity[2];
+            float    life[2]; // remaining, total
+            uint32_t color;
+        };
+        static_assert(sizeof(State) == 44, "must match the update shader's captured varyings");
+
+        struct PendingEmit
+        {
+            uint32_t    first_slot;
+            uint32_t    count;
+            Math::vec2  position;
+            Math::vec2  velocity;
+            Math::vec2  direction;
+            double      spread;
+            CS200::RGBA color;
+        };
+
+        void  simulate(const Math::TransformationMatrix& camera_matrix, float size_on_screen);
+        GLint uniform(const char* name) const;
+
+        std::shared_ptr<Texture> texture;
+        size_t                   capacity;
+        size_t                   next_slot = 0;
+        float                    max_life;
+        float                    size;
+        double                   pending_dt = 0.0;
+        Math::vec2               gravity{};
+        std::vector<PendingEmit> pending_emits;
+
+        OpenGL::CompiledShader                   update_shader{};
+        OpenGL::CompiledShader                   draw_shader{};
+        GLint                                    draw_depth_location = -1;
+        std::array<OpenGL::BufferHandle, 2>      state_buffers{};
+        std::array<OpenGL::VertexArrayHandle, 2> update_models{}; // [i] reads state_buffers[i]
+        std::array<OpenGL::VertexArrayHandle, 2> draw_models{};
+        OpenGL::BufferHandle                     quad_vertex_buffer{};
+        OpenGL::BufferHandle                     quad_index_buffer{};
+        size_t                                   current = 0; // which state buffer holds the latest state
+    };
+}
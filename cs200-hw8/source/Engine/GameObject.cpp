@@ -11,6 +11,7 @@ Created:    April 25, 2025
 #include "GameState.h"
 #include "GameStateManager.h"
 #include "ShowCollision.h"
+#include "TransformStore.h"
 
 #include <numbers>
 
@@ -27,9 +28,15 @@ CS230::GameObject::GameObject(Math::vec2 _position, double _rotation, Math::vec2
     position(_position),
     velocity(Math::vec2{ 0.0,0.0 }),
     scale(_scale),
-    rotation(_rotation)    
+    rotation(_rotation),
+    transform_id(Engine::GetTransformStore().Create(_position, _rotation, _scale))
 {}
 
+CS230::GameObject::~GameObject()
+{
+    Engine::GetTransformStore().Release(transform_id);
+}
+
 bool CS230::GameObject::IsCollidingWith(GameObject* other_object)
 {
     Collision* collider = GetGOComponent<Collision>();
@@ -84,7 +91,9 @@ void CS230::GameObject::Draw(Math::TransformationMatrix camera_matrix, unsigned
 		{
 			real_depth = depth;
 		}
-		sprite->Draw(camera_matrix * GetMatrix(), color, real_depth);
+		// drawn between the last two simulation ticks, GetMatrix() stays the current tick for game logic
+		const Math::Affine2D object_to_world = Engine::GetTransformStore().GetInterpolatedAffine(transform_id, Engine::GetWindowEnvironment().InterpolationAlpha);
+		sprite->Draw(Math::Affine2D(camera_matrix) * object_to_world, color, real_depth);
     }
     Collision* collision = GetGOComponent<Collision>();
     ShowCollision* showcollision = Engine::GetGameStateManager().GetGSComponent<ShowCollision>();
@@ -98,9 +107,10 @@ void CS230::GameObject::Draw(Math::TransformationMatrix camera_matrix, unsigned
 
 const Math::TransformationMatrix& CS230::GameObject::GetMatrix() {
     if (matrix_outdated == true) {
-        object_matrix = Math::TranslationMatrix(position) * Math::RotationMatrix(rotation) * Math::ScaleMatrix(scale);
+        // affine comes straight from the transform store, usually already built by the per-frame batch pass
+        object_matrix = Engine::GetTransformStore().GetMatrix(transform_id);
         matrix_outdated = false;
-    }    
+    }
     return object_matrix;
 }
 
@@ -126,46 +136,50 @@ double CS230::GameObject::GetRotation() const
 
 void CS230::GameObject::SetPosition(Math::vec2 new_position) {
     position = new_position;
+    Engine::GetTransformStore().SetPosition(transform_id, position);
     matrix_outdated = true;
 }
 
 void CS230::GameObject::UpdatePosition(Math::vec2 delta) {
     position += delta;
+    Engine::GetTransformStore().SetPosition(transform_id, position);
     matrix_outdated = true;
 }
 
 void CS230::GameObject::SetVelocity(Math::vec2 new_velocity){
     velocity = new_velocity;
-    matrix_outdated = true;
 }
 
 void CS230::GameObject::UpdateVelocity(Math::vec2 delta)
 {
     velocity += delta;
-    matrix_outdated = true;
 }
 
 void CS230::GameObject::SetScale(Math::vec2 new_scale)
 {
     scale = new_scale;
+    Engine::GetTransformStore().SetScale(transform_id, scale);
     matrix_outdated = true;
 }
 
 void CS230::GameObject::UpdateScale(Math::vec2 delta)
 {
     scale += delta;
+    Engine::GetTransformStore().SetScale(transform_id, scale);
     matrix_outdated = true;
 }
 
 void CS230::GameObject::SetRotation(double new_rotation)
 {
     rotation = new_rotation;
+    Engine::GetTransformStore().SetRotation(transform_id, rotation);
     matrix_outdated = true;
 }
 
 void CS230::GameObject::UpdateRotation(double delta)
 {
     rotation += delta;
+    Engine::GetTransformStore().SetRotation(transform_id, rotation);
     matrix_outdated = true;
 }
 
@@ -11,8 +11,10 @@ Created:    April 25, 2025
 #pragma once
 #include "../Game/GameObjectTypes.h"
 #include "ComponentManager.h"
+#include "GameObjectHandle.h"
 #include "ShowCollision.h"
 #include "Sprite.h"
+#include "TransformStore.h"
 
 namespace Math
 {
@@ -22,17 +24,20 @@ namespace Math
 namespace CS230
 {
     class Component;
+    struct Contact;
 
     class GameObject
     {
     public:
         friend class Sprite;
+        friend class GameObjectManager;
         GameObject(Math::vec2 position);
         GameObject(Math::vec2 position, double rotation, Math::vec2 scale);
 
-        virtual ~GameObject()
-        {
-        }
+        virtual ~GameObject();
+
+        GameObject(const GameObject&)            = delete;
+        GameObject& operator=(const GameObject&) = delete;
 
         virtual GameObjectTypes Type()     = 0;
         virtual std::string     TypeName() = 0;
@@ -42,6 +47,14 @@ namespace CS230
 			return UPDATEPRIORITY;
 		}
 
+        // objects returning true are updated on job threads before the serial update phase.
+        // Their Update may only touch the object itself and its components (no Add/Destroy of other objects, no logging);
+        // reading its own transform is fine, reading another object's is not since that object may be writing it
+        virtual bool IsThreadSafeUpdate() const
+        {
+            return false;
+        }
+
         virtual int DrawPriority() const
         {
 			return DRAWPRIORITY; // higher for later, upper means low depth, 30 - 70 fix
@@ -51,6 +64,12 @@ namespace CS230
         bool         IsCollidingWith(Math::vec2 point);
         virtual bool CanCollideWith(GameObjectTypes other_object_type);
         virtual void ResolveCollision([[maybe_unused]] GameObject* other_object) { };
+        // called by CollisionTest with the contact normal (pointing from this object to the other) and penetration depth,
+        // objects that only care that they were hit can keep overriding ResolveCollision
+        virtual void ResolveContact(GameObject* other_object, [[maybe_unused]] const Contact& contact)
+        {
+            ResolveCollision(other_object);
+        }
 
         virtual void Update(double dt);
 		virtual void Draw(Math::TransformationMatrix camera_matrix, unsigned int color = 0xFFFFFFFF, float depth = 0.5f);
@@ -60,6 +79,7 @@ namespace CS230
         const Math::vec2&                 GetVelocity() const;
         const Math::vec2&                 GetScale() const;
         double                            GetRotation() const;
+        TransformStore::Id                GetTransformId() const { return transform_id; }
 
         template <typename T>
         T* GetGOComponent()
@@ -81,6 +101,12 @@ namespace CS230
             destroy = true;
         }
 
+        // invalid until the object is added to a GameObjectManager
+        GameObjectHandle GetHandle() const
+        {
+            return handle;
+        }
+
 		static constexpr int DRAWPRIORITY = 50;
 		static constexpr int UPDATEPRIORITY = 10;
 
@@ -112,7 +138,8 @@ namespace CS230
 
         bool matrix_outdated;
 
-        void AddGOComponent(Component* component)
+        template <typename T>
+        void AddGOComponent(T* component)
         {
             componentmanager.AddComponent(component);
         }
@@ -135,7 +162,8 @@ namespace CS230
 
 
     private:
-        bool destroy;
+        bool             destroy;
+        GameObjectHandle handle{};
 
         class State_None : public State
         {
@@ -172,6 +200,8 @@ namespace CS230
         Math::vec2 scale;
         double     rotation;
 
+        TransformStore::Id transform_id;
+
         ComponentManager componentmanager;
     };
 }
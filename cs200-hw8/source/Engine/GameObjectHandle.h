@@ -0,0 +1,33 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  GameObjectHandle.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace CS230
+{
+    // Generational index into the GameObjectManager slot map.
+    // A handle stays valid until its object is destroyed, after that the slot generation moves on and the old handle resolves to nullptr.
+    struct GameObjectHandle
+    {
+        static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index      = InvalidIndex;
+        uint32_t generation = 0;
+
+        bool IsValid() const
+        {
+            return index != InvalidIndex;
+        }
+
+        bool operator==(const GameObjectHandle&) const = default;
+    };
+}
@@ -8,10 +8,35 @@ Author:     Taekyung Ho
 Created:    April 25, 2025
 */
 #include "GameObjectManager.h"
+#include "Collision.h"
+#include "JobSystem.h"
 #include "Logger.h"
+#include "TransformStore.h"
 
-void CS230::GameObjectManager::Add(GameObject* object){
+#include <algorithm>
+
+CS230::GameObjectManager::~GameObjectManager(){
+	Unload();
+}
+
+CS230::GameObjectHandle CS230::GameObjectManager::Add(GameObject* object){
+	uint32_t slot_index;
+	if (free_head != GameObjectHandle::InvalidIndex) {
+		slot_index = free_head;
+		free_head  = slots[slot_index].dense_index;
+	}
+	else {
+		slot_index = static_cast<uint32_t>(slots.size());
+		slots.push_back(Slot{});
+	}
+
+	Slot& slot		 = slots[slot_index];
+	slot.dense_index = static_cast<uint32_t>(objects.size());
 	objects.push_back(object);
+	dense_to_slot.push_back(slot_index);
+
+	object->handle = GameObjectHandle{ slot_index, slot.generation };
+	return object->handle;
 }
 
 void CS230::GameObjectManager::Unload(){
@@ -19,43 +44,311 @@ void CS230::GameObjectManager::Unload(){
 		delete object;
 	}
 	objects.clear();
+	dense_to_slot.clear();
+	destroy_queue.clear();
+	// bump every generation so handles from before the unload never resolve again
+	free_head = GameObjectHandle::InvalidIndex;
+	collision_tree.Clear();
+	previous_touching_pairs.clear();
+	contact_events.clear();
+	for (uint32_t i = static_cast<uint32_t>(slots.size()); i-- > 0;) {
+		slots[i].proxy = AABBTree::NullProxy;
+		++slots[i].generation;
+		slots[i].dense_index = free_head;
+		free_head			 = i;
+	}
+}
+
+CS230::GameObject* CS230::GameObjectManager::Get(GameObjectHandle handle) const{
+	if (handle.index >= slots.size()) {
+		return nullptr;
+	}
+	const Slot& slot = slots[handle.index];
+	if (slot.generation != handle.generation || slot.dense_index >= objects.size() || dense_to_slot[slot.dense_index] != handle.index) {
+		return nullptr;
+	}
+	return objects[slot.dense_index];
+}
+
+void CS230::GameObjectManager::Destroy(GameObjectHandle handle){
+	if (GameObject* object = Get(handle); object != nullptr) {
+		object->Destroy(); // picked up by the next UpdateAll
+	}
 }
 
 void CS230::GameObjectManager::UpdateAll(double dt){
-	std::vector<GameObject*> destroy_objects;
-	for (GameObject* object : objects) {
-		object->Update(dt);
+	// parallel phase: objects that declare a self contained update run in chunks on the job threads.
+	// Transforms written since the last flush (spawns, state setup) are rebuilt first, so the workers only
+	// ever read the store and the one entry their object writes
+	TransformStore& transforms	   = Engine::GetTransformStore();
+	const size_t	parallel_count = objects.size();
+	transforms.Flush();
+	transforms.BeginParallelPhase();
+	Engine::GetJobSystem().ParallelFor(parallel_count, ParallelChunk, [this, dt](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			if (objects[i]->IsThreadSafeUpdate()) {
+				objects[i]->Update(dt);
+			}
+		}
+	});
+	transforms.EndParallelPhase();
+
+	// serial phase, index loop on purpose: objects added during an update land at the back and still get updated this frame
+	for (size_t i = 0; i < objects.size(); ++i) {
+		GameObject* object = objects[i];
+		if (i >= parallel_count || object->IsThreadSafeUpdate() == false) {
+			object->Update(dt);
+		}
 		if (object->Destroyed() == true) {
-			destroy_objects.push_back(object);
+			destroy_queue.push_back(object);
+		}
+	}
+	flush_destroyed();
+	// one batched pass over every transform touched this frame
+	transforms.Flush();
+	sync_collision_tree();
+}
+
+void CS230::GameObjectManager::sync_collision_tree(){
+	for (size_t i = 0; i < objects.size(); ++i) {
+		Slot&	   slot		= slots[dense_to_slot[i]];
+		Collision* collider = objects[i]->GetGOComponent<Collision>();
+		if (collider == nullptr) {
+			if (slot.proxy != AABBTree::NullProxy) {
+				collision_tree.DestroyProxy(slot.proxy);
+				slot.proxy = AABBTree::NullProxy;
+			}
+			continue;
+		}
+		const Math::rect bounds = collider->WorldBounds();
+		const Math::vec2 center = bounds.Center();
+		if (slot.proxy == AABBTree::NullProxy) {
+			slot.proxy = collision_tree.CreateProxy(bounds, dense_to_slot[i]);
+		}
+		else {
+			// static colliders stay inside their fat box and cost nothing here
+			collision_tree.MoveProxy(slot.proxy, bounds, center - slot.last_center);
+		}
+		slot.last_center = center;
+	}
+}
+
+void CS230::GameObjectManager::QueryPoint(Math::vec2 point, std::vector<GameObject*>& hits){
+	collision_tree.QueryPoint(point, [this, point, &hits](AABBTree::ProxyId proxy) {
+		GameObject* object = object_of_proxy(proxy);
+		if (object->IsCollidingWith(point)) {
+			hits.push_back(object);
+		}
+		return true;
+	});
+}
+
+void CS230::GameObjectManager::QueryRegion(Math::rect region, std::vector<GameObject*>& hits){
+	collision_tree.QueryRegion(region, [this, region, &hits](AABBTree::ProxyId proxy) {
+		GameObject*		 object = object_of_proxy(proxy);
+		const Math::rect bounds = object->GetGOComponent<Collision>()->WorldBounds();
+		if (bounds.Left() <= region.Right() && region.Left() <= bounds.Right() && bounds.Bottom() <= region.Top() && region.Bottom() <= bounds.Top()) {
+			hits.push_back(object);
+		}
+		return true;
+	});
+}
+
+CS230::GameObject* CS230::GameObjectManager::RayCast(Math::vec2 from, Math::vec2 to, double* hit_fraction){
+	GameObject* closest = nullptr;
+	double		closest_fraction = 1.0;
+	collision_tree.RayCast(from, to, [this, from, to, &closest, &closest_fraction](AABBTree::ProxyId proxy, double max_fraction) {
+		GameObject* object	 = object_of_proxy(proxy);
+		double		fraction = 0.0;
+		if (!object->GetGOComponent<Collision>()->RayCast(from, to, fraction) || fraction > max_fraction) {
+			return max_fraction;
 		}
+		closest			 = object;
+		closest_fraction = fraction;
+		// a hit at the very start cannot be beaten
+		return fraction > 0.0 ? fraction : 0.0;
+	});
+	if (closest != nullptr && hit_fraction != nullptr) {
+		*hit_fraction = closest_fraction;
 	}
-	for (GameObject* destroy_object : destroy_objects) {
-		objects.remove(destroy_object);
-		delete destroy_object;
+	return closest;
+}
+
+void CS230::GameObjectManager::release_slot(uint32_t slot_index){
+	Slot& slot		 = slots[slot_index];
+	if (slot.proxy != AABBTree::NullProxy) {
+		collision_tree.DestroyProxy(slot.proxy);
+		slot.proxy = AABBTree::NullProxy;
 	}
+	++slot.generation;
+	slot.dense_index = free_head;
+	free_head		 = slot_index;
+}
+
+void CS230::GameObjectManager::flush_destroyed(){
+	if (destroy_queue.empty()) {
+		return;
+	}
+
+	if (keep_update_order) {
+		// single stable compaction pass, still O(n) per frame rather than per destroyed object
+		size_t write = 0;
+		for (size_t read = 0; read < objects.size(); ++read) {
+			GameObject*	   object	  = objects[read];
+			const uint32_t slot_index = dense_to_slot[read];
+			if (object->Destroyed() == true) {
+				release_slot(slot_index);
+				delete object;
+				continue;
+			}
+			objects[write]				  = object;
+			dense_to_slot[write]		  = slot_index;
+			slots[slot_index].dense_index = static_cast<uint32_t>(write);
+			++write;
+		}
+		objects.resize(write);
+		dense_to_slot.resize(write);
+	}
+	else {
+		for (GameObject* object : destroy_queue) {
+			const uint32_t slot_index = object->handle.index;
+			const uint32_t dense	  = slots[slot_index].dense_index;
+			const uint32_t last		  = static_cast<uint32_t>(objects.size() - 1);
+
+			objects[dense]		 = objects[last];
+			dense_to_slot[dense] = dense_to_slot[last];
+			slots[dense_to_slot[dense]].dense_index = dense;
+			objects.pop_back();
+			dense_to_slot.pop_back();
+
+			release_slot(slot_index);
+			delete object;
+		}
+	}
+	destroy_queue.clear();
 }
 
 void CS230::GameObjectManager::SortForUpdate()
 {
-	objects.sort([](GameObject* a, GameObject* b) { return a->UpdatePriority() < b->UpdatePriority(); });
+	std::vector<size_t> order(objects.size());
+	for (size_t i = 0; i < order.size(); ++i) {
+		order[i] = i;
+	}
+	std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) { return objects[a]->UpdatePriority() < objects[b]->UpdatePriority(); });
+
+	std::vector<GameObject*> sorted_objects(objects.size());
+	std::vector<uint32_t>	 sorted_slots(objects.size());
+	for (size_t i = 0; i < order.size(); ++i) {
+		sorted_objects[i]				   = objects[order[i]];
+		sorted_slots[i]					   = dense_to_slot[order[i]];
+		slots[sorted_slots[i]].dense_index = static_cast<uint32_t>(i);
+	}
+	objects.swap(sorted_objects);
+	dense_to_slot.swap(sorted_slots);
+	keep_update_order = true;
 }
 
 void CS230::GameObjectManager::DrawAll(Math::TransformationMatrix camera_matrix){
 	for (GameObject* object : objects) {
-		object->Draw(camera_matrix);		
+		object->Draw(camera_matrix);
 	}
 }
 
 void CS230::GameObjectManager::CollisionTest()
 {
-	for (GameObject* object1 : objects) {
-		for (GameObject* object2 : objects) {
-			if (object1 != object2 && object1->CanCollideWith(object2->Type())) {
-				if (object1->IsCollidingWith(object2)) {
-					Engine::GetLogger().LogEvent("Collision Detected: " + object1->TypeName() + " and " + object2->TypeName());
-					object1->ResolveCollision(object2);
-				}
+	collider_objects.clear();
+	collider_bounds.clear();
+	collider_shapes.clear();
+	for (GameObject* object : objects) {
+		if (Collision* collider = object->GetGOComponent<Collision>(); collider != nullptr) {
+			collider_objects.push_back(object);
+			collider_bounds.push_back(collider->WorldBounds());
+			collider_shapes.push_back(collider->GetWorldShape());
+		}
+	}
+	broadphase.Build(collider_bounds);
+
+	// queue every pair at least one side cares about, then run the narrowphase over all of them at once
+	narrowphase.Clear();
+	candidate_pairs.clear();
+	for (const auto& [first, second] : broadphase.Pairs()) {
+		const bool first_handles  = collider_objects[first]->CanCollideWith(collider_objects[second]->Type());
+		const bool second_handles = collider_objects[second]->CanCollideWith(collider_objects[first]->Type());
+		if (first_handles || second_handles) {
+			candidate_pairs.push_back(CandidatePair{ first, second, first_handles, second_handles });
+			narrowphase.Add(collider_shapes[first], collider_shapes[second]);
+		}
+	}
+	narrowphase.Run();
+
+	touching_pairs.clear();
+	const std::span<const Contact> contacts = narrowphase.Contacts();
+	for (size_t i = 0; i < candidate_pairs.size(); ++i) {
+		if (!contacts[i].IsTouching()) {
+			continue;
+		}
+		const CandidatePair& pair = candidate_pairs[i];
+		ContactEvent		 event{ ContactEvent::Phase::Stay, collider_objects[pair.first]->GetHandle(), collider_objects[pair.second]->GetHandle(),
+								contacts[i], pair.first_handles, pair.second_handles };
+		if (event.first.index > event.second.index) {
+			std::swap(event.first, event.second);
+			std::swap(event.first_handles, event.second_handles);
+			event.contact = event.contact.Flipped();
+		}
+		touching_pairs.push_back(CachedPair{ (static_cast<uint64_t>(event.first.index) << 32) | event.second.index, event });
+	}
+	update_pair_cache();
+
+	// batch dispatch after the whole physics step, nothing above ran game code
+	for (const ContactEvent& event : contact_events) {
+		if (event.phase == ContactEvent::Phase::End) {
+			continue;
+		}
+		GameObject* object1 = Get(event.first);
+		GameObject* object2 = Get(event.second);
+		if (event.phase == ContactEvent::Phase::Begin) {
+			LOG_EVENT("Collision Detected: {} and {}", object1->TypeName(), object2->TypeName());
+		}
+		if (event.first_handles) {
+			object1->ResolveContact(object2, event.contact);
+		}
+		if (event.second_handles) {
+			object2->ResolveContact(object1, event.contact.Flipped());
+		}
+	}
+}
+
+void CS230::GameObjectManager::update_pair_cache()
+{
+	std::sort(touching_pairs.begin(), touching_pairs.end(), [](const CachedPair& a, const CachedPair& b) { return a.key < b.key; });
+
+	// merge walk over two sorted lists: only in the old one = End, only in the new one = Begin, in both = Stay
+	contact_events.clear();
+	size_t previous = 0;
+	size_t current	= 0;
+	while (previous < previous_touching_pairs.size() || current < touching_pairs.size()) {
+		const bool has_previous = previous < previous_touching_pairs.size();
+		const bool has_current	= current < touching_pairs.size();
+		if (has_previous && (!has_current || previous_touching_pairs[previous].key < touching_pairs[current].key)) {
+			ContactEvent event = previous_touching_pairs[previous++].event;
+			event.phase		   = ContactEvent::Phase::End;
+			contact_events.push_back(event);
+			continue;
+		}
+		CachedPair& pair = touching_pairs[current++];
+		if (has_previous && previous_touching_pairs[previous].key == pair.key) {
+			ContactEvent old = previous_touching_pairs[previous++].event;
+			if (old.first == pair.event.first && old.second == pair.event.second) {
+				pair.event.phase = ContactEvent::Phase::Stay;
+				contact_events.push_back(pair.event);
+				continue;
 			}
+			// a slot was reused by a new object, the old pair ended
+			old.phase = ContactEvent::Phase::End;
+			contact_events.push_back(old);
 		}
+		pair.event.phase = ContactEvent::Phase::Begin;
+		contact_events.push_back(pair.event);
 	}
+	touching_pairs.swap(previous_touching_pairs);
 }
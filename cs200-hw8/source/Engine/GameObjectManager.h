@@ -9,27 +9,110 @@ Created:    April 25, 2025
 */
 
 #pragma once
-#include <list>
+#include <span>
+#include <vector>
 #include "GameObject.h"
+#include "GameObjectHandle.h"
 #include "Matrix.h"
 #include "Component.h"
+#include "AABBTree.h"
+#include "ContactEvent.h"
+#include "Narrowphase.h"
+#include "Rect.h"
+#include "SpatialGrid.h"
 
 namespace Math { class TransformationMatrix; }
 
 namespace CS230 {
+    // Objects live in a dense array so update/draw walk contiguous memory.
+    // A sparse slot table maps generational handles to dense positions; destroyed objects are queued during UpdateAll
+    // and removed once at the end of the frame with swap-and-pop (or an order preserving compaction once SortForUpdate was used).
     class GameObjectManager : public CS230::Component{
     public:
-        void Add(GameObject* object);
+        ~GameObjectManager() override;
+
+        GameObjectHandle Add(GameObject* object);
         void Unload();
 
         void UpdateAll(double dt);
         void SortForUpdate();
         void DrawAll(Math::TransformationMatrix camera_matrix);
 
+        // Finds every touching pair, turns the difference to last frame into Begin/Stay/End events,
+        // then calls ResolveContact for the Begin and Stay ones in one pass over the buffer.
         void CollisionTest();
+        // this frame's events, valid until the next CollisionTest
+        std::span<const ContactEvent> GetContactEvents() const { return contact_events; }
+
+        GameObject* Get(GameObjectHandle handle) const;
+        bool        IsAlive(GameObjectHandle handle) const { return Get(handle) != nullptr; }
+        void        Destroy(GameObjectHandle handle);
 
-        const std::list<GameObject*>& GetAll() const { return objects; }
+        std::span<GameObject* const> GetAll() const { return objects; }
+        size_t                       Count() const { return objects.size(); }
+
+        // Spatial queries against the colliders as of the last UpdateAll, O(log n) through the AABB tree.
+        // Hits are appended to the output vector.
+        void        QueryPoint(Math::vec2 point, std::vector<GameObject*>& hits);
+        void        QueryRegion(Math::rect region, std::vector<GameObject*>& hits);
+        // closest collider along from..to, nullptr when nothing is hit
+        GameObject* RayCast(Math::vec2 from, Math::vec2 to, double* hit_fraction = nullptr);
     private:
-        std::list<GameObject*> objects;
+        struct Slot
+        {
+            uint32_t          dense_index = GameObjectHandle::InvalidIndex; // doubles as next free slot while the slot is unused
+            uint32_t          generation  = 0;
+            AABBTree::ProxyId proxy       = AABBTree::NullProxy;
+            Math::vec2        last_center{};
+        };
+
+        void flush_destroyed();
+        void release_slot(uint32_t slot_index);
+        // Proxies are created, moved and destroyed here rather than when a Collision component is added or removed:
+        // components are added before the object has a slot (or while it belongs to no manager) and can be swapped
+        // at any time, so UpdateAll reconciles the tree with the components once per frame instead
+        void sync_collision_tree();
+        GameObject* object_of_proxy(AABBTree::ProxyId proxy) const { return objects[slots[collision_tree.GetUserData(proxy)].dense_index]; }
+
+        std::vector<GameObject*> objects;        // dense, iteration order
+        std::vector<uint32_t>    dense_to_slot;  // parallel to objects
+        std::vector<Slot>        slots;
+        uint32_t                 free_head = GameObjectHandle::InvalidIndex;
+
+        static constexpr size_t ParallelChunk = 256; // smallest slice of objects worth handing to a job thread
+
+        std::vector<GameObject*> destroy_queue;
+        bool                     keep_update_order = false;
+
+        AABBTree collision_tree; // user data is the slot index
+
+        struct CandidatePair
+        {
+            uint32_t first;
+            uint32_t second;
+            bool     first_handles;  // first->CanCollideWith(second)
+            bool     second_handles;
+        };
+
+        // touching pair remembered across frames, sorted by key = lower slot index << 32 | higher slot index
+        struct CachedPair
+        {
+            uint64_t     key;
+            ContactEvent event;
+        };
+
+        void update_pair_cache();
+
+        // rebuilt by CollisionTest every call, kept as members so the buffers are reused
+        SpatialGrid                broadphase;
+        Narrowphase                narrowphase;
+        std::vector<GameObject*>   collider_objects;
+        std::vector<Math::rect>    collider_bounds;
+        std::vector<WorldShape>    collider_shapes;
+        std::vector<CandidatePair> candidate_pairs;
+
+        std::vector<CachedPair>   touching_pairs;          // this frame
+        std::vector<CachedPair>   previous_touching_pairs; // last frame
+        std::vector<ContactEvent> contact_events;
     };
 }
@@ -8,6 +8,7 @@
  */
 #pragma once
 
+#include "Animation.h"
 #include "ComponentManager.h"
 #include <gsl/gsl>
 
@@ -22,6 +23,9 @@ namespace CS230
         virtual void          Draw()            = 0;
         virtual void          DrawImGui()       = 0;
         virtual gsl::czstring GetName() const   = 0;
+        // false when Draw or DrawImGui issue GL themselves instead of going through IRenderer2D and RenderingAPI,
+        // the engine then draws the frame on the main thread with the GL context (Engine/RenderThread.h)
+        virtual bool CanDrawOnRenderThread() const { return true; }
         virtual ~GameState()                    = default;
 
         template <typename T>
@@ -30,14 +34,20 @@ namespace CS230
             return componentmanager.GetComponent<T>();
         }
 
+        // playback of the Sprites created while this state is on top, advanced only while it updates
+        AnimationPlayer& GetAnimationPlayer() { return animation_player; }
+
     protected:
-        void AddGSComponent(Component* component)
+        template <typename T>
+        void AddGSComponent(T* component)
         {
             componentmanager.AddComponent(component);
         }
 
+        // animations first, so the objects updated after them see the frame their sprite shows this tick
         void UpdateGSComponents(double dt)
         {
+            animation_player.AdvanceAll(dt);
             componentmanager.UpdateAll(dt);
         }
 
@@ -53,6 +63,7 @@ namespace CS230
         }
 
     private:
+        AnimationPlayer  animation_player; // before the components, the Sprites they own release their slots when destroyed
         ComponentManager componentmanager;
     };
 
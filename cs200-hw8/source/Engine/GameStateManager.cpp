@@ -13,17 +13,26 @@ namespace CS230
 {
     void GameStateManager::PopState()
     {
-        using namespace std::literals;
+        const GLContextScope gl_context(Engine::GetRenderThread());
         auto* const state = mGameStateStack.back().get();
         mToClear.push_back(std::move(mGameStateStack.back()));
         mGameStateStack.erase(mGameStateStack.end() - 1);
-        Engine::GetLogger().LogEvent("Exiting state "s + state->GetName());
+        LOG_EVENT("Exiting state {}", state->GetName());
         state->Unload();
     }
 
     void GameStateManager::Update(double dt)
     {
-        mToClear.clear();
+        if (!mToClear.empty())
+        {
+            // popped states release their GL resources here
+            const GLContextScope gl_context(Engine::GetRenderThread());
+            mToClear.clear();
+        }
+        if (mGameStateStack.empty())
+        {
+            return;
+        }
         mGameStateStack.back()->Update(dt);
         if (!mGameStateStack.empty())
         {
@@ -43,6 +52,18 @@ namespace CS230
         }
     }
 
+    bool GameStateManager::CanDrawOnRenderThread() const
+    {
+        for (const auto& game_state : mGameStateStack)
+        {
+            if (!game_state->CanDrawOnRenderThread())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void GameStateManager::DrawImGui()
     {
         if (!mGameStateStack.empty())
@@ -53,6 +74,7 @@ namespace CS230
 
     void GameStateManager::Clear()
     {
+        const GLContextScope gl_context(Engine::GetRenderThread());
         while (!mGameStateStack.empty())
             PopState();
         mToClear.clear();
@@ -10,6 +10,7 @@
 
 #include "Engine/Engine.h"
 #include "Engine/Logger.h"
+#include "Engine/RenderThread.h"
 #include "GameState.h"
 #include <memory>
 #include <vector>
@@ -25,6 +26,7 @@ namespace CS230
         void Update(double);
         void Draw();
         void DrawImGui();
+        bool CanDrawOnRenderThread() const;
 
         [[nodiscard]] bool HasGameEnded() const
         {
@@ -39,6 +41,11 @@ namespace CS230
             return mGameStateStack.back()->GetGSComponent<T>();
         }
 
+        AnimationPlayer& GetAnimationPlayer()
+        {
+            return mGameStateStack.back()->GetAnimationPlayer();
+        }
+
     private:
         std::vector<std::unique_ptr<GameState>> mGameStateStack;
         std::vector<std::unique_ptr<GameState>> mToClear;
@@ -47,10 +54,11 @@ namespace CS230
     template <typename STATE>
     void GameStateManager::PushState()
     {
-        using namespace std::literals;
+        // loading creates textures, shaders and buffers
+        const GLContextScope gl_context(Engine::GetRenderThread());
         mGameStateStack.push_back(std::make_unique<STATE>());
         const auto& state = mGameStateStack.back();
-        Engine::GetLogger().LogEvent("Entering state "s + state->GetName());
+        LOG_EVENT("Entering state {}", state->GetName());
         state->Load();
     }
 }
@@ -0,0 +1,206 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  JobSystem.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "JobSystem.h"
+
+#include <algorithm>
+
+namespace
+{
+    // which deque the current thread owns, threads that are not workers share the main thread's deque
+    thread_local size_t tls_queue_index = 0;
+}
+
+namespace CS230
+{
+    JobSystem::~JobSystem()
+    {
+        Stop();
+    }
+
+    unsigned JobSystem::DefaultWorkerCount()
+    {
+#if defined(__EMSCRIPTEN__)
+        return 0;
+#else
+        const unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+#endif
+    }
+
+    void JobSystem::Start(unsigned worker_count)
+    {
+        Stop();
+        queues.clear();
+        for (unsigned i = 0; i <= worker_count; ++i)
+        {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        running = true;
+        tls_queue_index = 0;
+        for (unsigned i = 1; i <= worker_count; ++i)
+        {
+            threads.emplace_back(&JobSystem::worker_main, this, static_cast<size_t>(i));
+        }
+    }
+
+    void JobSystem::Stop()
+    {
+        if (!running)
+        {
+            return;
+        }
+        {
+            std::lock_guard lock(sleep_mutex);
+            running = false;
+        }
+        sleep_cv.notify_all();
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        threads.clear();
+        // whatever is left runs here so no counter is left waiting forever
+        while (!queues.empty() && try_run_one(0))
+        {
+        }
+    }
+
+    void JobSystem::Schedule(Job job, JobCounter& counter)
+    {
+        counter.pending.fetch_add(1, std::memory_order_relaxed);
+        Job wrapped = [task = std::move(job), &counter]()
+        {
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                std::lock_guard lock(counter.error_mutex);
+                if (!counter.error)
+                {
+                    counter.error = std::current_exception();
+                }
+            }
+            counter.pending.fetch_sub(1, std::memory_order_release);
+        };
+
+        if (threads.empty())
+        {
+            wrapped(); // no workers: run inline
+            return;
+        }
+
+        Queue& queue = *queues[std::min(tls_queue_index, queues.size() - 1)];
+        {
+            std::lock_guard lock(queue.mutex);
+            queue.jobs.push_back(std::move(wrapped));
+        }
+        queued.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard lock(sleep_mutex); // pairs with the predicate check in worker_main, avoids a lost wake up
+        }
+        sleep_cv.notify_one();
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        while (!counter.Done())
+        {
+            if (threads.empty() || !try_run_one(std::min(tls_queue_index, queues.size() - 1)))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        std::exception_ptr error;
+        {
+            std::lock_guard lock(counter.error_mutex);
+            std::swap(error, counter.error);
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void JobSystem::ParallelFor(size_t count, size_t min_chunk, const RangeJob& job)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        const size_t thread_count = threads.size() + 1;
+        // a few chunks per thread so stealing can even out uneven work
+        const size_t chunk = std::max<size_t>(std::max<size_t>(min_chunk, 1), (count + thread_count * 4 - 1) / (thread_count * 4));
+        if (threads.empty() || chunk >= count)
+        {
+            job(0, count);
+            return;
+        }
+
+        JobCounter counter;
+        for (size_t begin = 0; begin < count; begin += chunk)
+        {
+            const size_t end = std::min(begin + chunk, count);
+            Schedule([&job, begin, end]() { job(begin, end); }, counter);
+        }
+        {
+            std::lock_guard lock(sleep_mutex);
+        }
+        sleep_cv.notify_all();
+        Wait(counter);
+    }
+
+    bool JobSystem::try_run_one(size_t self)
+    {
+        Job job;
+        {
+            Queue&          own = *queues[self];
+            std::lock_guard lock(own.mutex);
+            if (!own.jobs.empty())
+            {
+                job = std::move(own.jobs.back());
+                own.jobs.pop_back();
+            }
+        }
+        for (size_t i = 1; !job && i < queues.size(); ++i)
+        {
+            Queue&          victim = *queues[(self + i) % queues.size()];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.jobs.empty())
+            {
+                job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+            }
+        }
+        if (!job)
+        {
+            return false;
+        }
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        job();
+        return true;
+    }
+
+    void JobSystem::worker_main(size_t self)
+    {
+        tls_queue_index = self;
+        while (running)
+        {
+            if (try_run_one(self))
+            {
+                continue;
+            }
+            std::unique_lock lock(sleep_mutex);
+            sleep_cv.wait(lock, [this]() { return !running || queued.load(std::memory_order_acquire) > 0; });
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  JobSystem.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CS230
+{
+    // Counts outstanding jobs. Schedule() increments it, the job decrements it when it finishes,
+    // and JobSystem::Wait() returns once it reaches zero. The first exception thrown by a job is
+    // kept here and rethrown from Wait() on the waiting thread.
+    class JobCounter
+    {
+    public:
+        bool Done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+        std::atomic<int>   pending{ 0 };
+        std::mutex         error_mutex;
+        std::exception_ptr error{};
+    };
+
+    // Work-stealing scheduler.
+    // Every thread (the main thread included) owns a deque: the owner pushes/pops at the back,
+    // idle threads steal from the front of the others. Threads waiting on a counter keep running
+    // jobs instead of blocking, so nested ParallelFor calls cannot deadlock.
+    class JobSystem
+    {
+    public:
+        using Job      = std::function<void()>;
+        using RangeJob = std::function<void(size_t begin, size_t end)>;
+
+        JobSystem() = default;
+        ~JobSystem();
+
+        JobSystem(const JobSystem&)            = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // hardware threads minus the main thread, 0 where threads are not available (web build)
+        static unsigned DefaultWorkerCount();
+
+        void     Start(unsigned worker_count);
+        void     Stop();
+        unsigned WorkerCount() const { return static_cast<unsigned>(threads.size()); }
+
+        void Schedule(Job job, JobCounter& counter);
+        void Wait(JobCounter& counter);
+
+        // splits [0, count) into chunks of at least min_chunk items and blocks until all of them ran
+        void ParallelFor(size_t count, size_t min_chunk, const RangeJob& job);
+
+    private:
+        struct Queue
+        {
+            std::mutex      mutex;
+            std::deque<Job> jobs;
+        };
+
+        bool try_run_one(size_t self);
+        void worker_main(size_t self);
+
+        std::vector<std::unique_ptr<Queue>> queues; // [0] belongs to the thread that called Start
+        std::vector<std::thread>            threads;
+
+        std::atomic<bool>       running{ false };
+        std::atomic<int>        queued{ 0 };
+        std::mutex              sleep_mutex;
+        std::condition_variable sleep_cv;
+    };
+}
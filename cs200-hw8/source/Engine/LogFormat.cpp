@@ -0,0 +1,129 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "LogFormat.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace
+{
+    class Writer
+    {
+    public:
+        explicit Writer(std::span<char> the_out) : out(the_out)
+        {
+        }
+
+        void Append(std::string_view text)
+        {
+            const size_t count = std::min(text.size(), out.size() - length);
+            std::memcpy(out.data() + length, text.data(), count);
+            length += count;
+        }
+
+        size_t Length() const { return length; }
+
+    private:
+        std::span<char> out;
+        size_t          length = 0;
+    };
+
+    struct Spec
+    {
+        int  precision = -1;
+        char type      = '\0';
+    };
+
+    // the format string was checked at compile time, so this only has to read it
+    Spec parse_spec(std::string_view spec)
+    {
+        Spec result;
+        if (spec.empty())
+        {
+            return result;
+        }
+        spec.remove_prefix(1); // ':'
+        if (!spec.empty() && spec[0] == '.')
+        {
+            spec.remove_prefix(1);
+            result.precision = 0;
+            while (!spec.empty() && spec[0] >= '0' && spec[0] <= '9')
+            {
+                result.precision = std::min(result.precision * 10 + (spec[0] - '0'), 17);
+                spec.remove_prefix(1);
+            }
+        }
+        if (!spec.empty())
+        {
+            result.type = spec[0];
+        }
+        return result;
+    }
+
+    void write_arg(Writer& writer, const CS230::log_format::Arg& arg, Spec spec)
+    {
+        using Kind = CS230::log_format::Arg::Kind;
+        char        digits[64];
+        char* const last = digits + sizeof(digits);
+        const int   base = spec.type == 'x' ? 16 : 10;
+        switch (arg.kind)
+        {
+            case Kind::Signed: writer.Append({ digits, static_cast<size_t>(std::to_chars(digits, last, arg.i, base).ptr - digits) }); break;
+            case Kind::Unsigned: writer.Append({ digits, static_cast<size_t>(std::to_chars(digits, last, arg.u, base).ptr - digits) }); break;
+            case Kind::Float:
+            {
+                const std::to_chars_result result =
+                    spec.precision >= 0 || spec.type == 'f' ? std::to_chars(digits, last, arg.f, std::chars_format::fixed, spec.precision >= 0 ? spec.precision : 6) : std::to_chars(digits, last, arg.f);
+                writer.Append({ digits, result.ec == std::errc{} ? static_cast<size_t>(result.ptr - digits) : 0 });
+                break;
+            }
+            case Kind::String:
+            case Kind::Char: writer.Append(arg.s); break;
+            case Kind::Bool: writer.Append(arg.u != 0 ? "true" : "false"); break;
+            case Kind::Pointer:
+                writer.Append("0x");
+                writer.Append({ digits, static_cast<size_t>(std::to_chars(digits, last, reinterpret_cast<uintptr_t>(arg.p), 16).ptr - digits) });
+                break;
+        }
+    }
+}
+
+namespace CS230::log_format
+{
+    size_t FormatTo(std::span<char> out, std::string_view format, std::span<const Arg> args)
+    {
+        Writer writer(out);
+        size_t next_arg = 0;
+        size_t i        = 0;
+        while (i < format.size())
+        {
+            const size_t brace = format.find_first_of("{}", i);
+            writer.Append(format.substr(i, brace - i));
+            if (brace == std::string_view::npos)
+            {
+                break;
+            }
+            if (format[brace] == '}' || format[brace + 1] == '{')
+            {
+                writer.Append(format.substr(brace, 1)); // "}}" or "{{"
+                i = brace + 2;
+                continue;
+            }
+            const size_t close = format.find('}', brace);
+            if (next_arg < args.size())
+            {
+                write_arg(writer, args[next_arg], parse_spec(format.substr(brace + 1, close - brace - 1)));
+            }
+            ++next_arg;
+            i = close + 1;
+        }
+        return writer.Length();
+    }
+}
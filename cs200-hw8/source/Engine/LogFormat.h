@@ -0,0 +1,229 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+// The formatting behind the LOG_* macros (Logger.h). Format strings use std::format's placeholders; the count
+// and every placeholder's spec are checked against the argument types at compile time, and the result is
+// written into a caller's fixed buffer:
+//
+//     {}      any argument
+//     {:.3f}  fixed point with 3 decimals, floating point arguments
+//     {:x}    hexadecimal, integer arguments
+//     {{ }}   literal braces
+//
+// Arguments are integers, enums, floating point, bool, char, anything convertible to std::string_view and
+// pointers. Nothing allocates; output that does not fit the buffer is cut.
+namespace CS230::log_format
+{
+    // one argument of a log call, type erased so the formatter itself is not a template
+    struct Arg
+    {
+        enum class Kind : uint8_t
+        {
+            Signed,
+            Unsigned,
+            Float,
+            String,
+            Char,
+            Bool,
+            Pointer
+        };
+
+        Kind             kind = Kind::Signed;
+        int64_t          i    = 0;
+        uint64_t         u    = 0;
+        double           f    = 0.0;
+        std::string_view s{};
+        const void*      p = nullptr;
+    };
+
+    // the Kind MakeArg gives an argument of type T, what the format string checks its placeholders against
+    template <typename T>
+    consteval Arg::Kind KindOf()
+    {
+        using U = std::remove_cvref_t<T>;
+        if constexpr (std::is_same_v<U, bool>)
+        {
+            return Arg::Kind::Bool;
+        }
+        else if constexpr (std::is_same_v<U, char>)
+        {
+            return Arg::Kind::Char;
+        }
+        else if constexpr (std::is_enum_v<U> || (std::is_integral_v<U> && std::is_signed_v<U>))
+        {
+            return Arg::Kind::Signed;
+        }
+        else if constexpr (std::is_integral_v<U>)
+        {
+            return Arg::Kind::Unsigned;
+        }
+        else if constexpr (std::is_floating_point_v<U>)
+        {
+            return Arg::Kind::Float;
+        }
+        else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+        {
+            return Arg::Kind::String;
+        }
+        else
+        {
+            static_assert(std::is_pointer_v<U>, "log argument type cannot be formatted, pass a string or number");
+            return Arg::Kind::Pointer;
+        }
+    }
+
+    template <typename T>
+    Arg MakeArg(const T& value)
+    {
+        using U = std::remove_cvref_t<T>;
+        Arg arg;
+        arg.kind = KindOf<T>();
+        if constexpr (std::is_same_v<U, bool>)
+        {
+            arg.u = value ? 1 : 0;
+        }
+        else if constexpr (std::is_same_v<U, char>)
+        {
+            arg.s = std::string_view(&value, 1);
+        }
+        else if constexpr (std::is_enum_v<U>)
+        {
+            arg.i = static_cast<int64_t>(value);
+        }
+        else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+        {
+            arg.i = value;
+        }
+        else if constexpr (std::is_integral_v<U>)
+        {
+            arg.u = value;
+        }
+        else if constexpr (std::is_floating_point_v<U>)
+        {
+            arg.f = static_cast<double>(value);
+        }
+        else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+        {
+            arg.s = value;
+        }
+        else
+        {
+            arg.p = static_cast<const void*>(value);
+        }
+        return arg;
+    }
+
+    // true when the format string is well formed, has one placeholder per argument and every
+    // placeholder's spec suits its argument: precision and 'f' need a floating point, 'x' an integer
+    constexpr bool CheckFormat(std::string_view format, std::span<const Arg::Kind> kinds)
+    {
+        size_t next_arg = 0;
+        for (size_t i = 0; i < format.size(); ++i)
+        {
+            if (format[i] == '}')
+            {
+                if (i + 1 >= format.size() || format[i + 1] != '}')
+                {
+                    return false;
+                }
+                ++i;
+                continue;
+            }
+            if (format[i] != '{')
+            {
+                continue;
+            }
+            if (i + 1 < format.size() && format[i + 1] == '{')
+            {
+                ++i;
+                continue;
+            }
+            const size_t close = format.find('}', i);
+            if (close == std::string_view::npos || next_arg >= kinds.size())
+            {
+                return false;
+            }
+            const Arg::Kind  kind = kinds[next_arg++];
+            std::string_view spec = format.substr(i + 1, close - i - 1);
+            if (!spec.empty())
+            {
+                if (spec[0] != ':')
+                {
+                    return false; // no explicit argument indices
+                }
+                spec.remove_prefix(1);
+                bool has_precision = false;
+                if (!spec.empty() && spec[0] == '.')
+                {
+                    spec.remove_prefix(1);
+                    if (spec.empty() || spec[0] < '0' || spec[0] > '9')
+                    {
+                        return false;
+                    }
+                    while (!spec.empty() && spec[0] >= '0' && spec[0] <= '9')
+                    {
+                        spec.remove_prefix(1);
+                    }
+                    has_precision = true;
+                }
+                if (spec.size() > 1)
+                {
+                    return false;
+                }
+                const char type = spec.empty() ? '\0' : spec[0];
+                if ((has_precision || type == 'f') && kind != Arg::Kind::Float)
+                {
+                    return false;
+                }
+                if (type == 'x' && (has_precision || (kind != Arg::Kind::Signed && kind != Arg::Kind::Unsigned)))
+                {
+                    return false;
+                }
+                if (type != '\0' && type != 'f' && type != 'x')
+                {
+                    return false;
+                }
+            }
+            i = close;
+        }
+        return next_arg == kinds.size();
+    }
+
+    template <typename... Args>
+    class BasicFormatString
+    {
+    public:
+        template <typename S>
+            requires std::convertible_to<const S&, std::string_view>
+        consteval BasicFormatString(const S& format) : text(format)
+        {
+            constexpr Arg::Kind kinds[sizeof...(Args) + 1]{ KindOf<Args>()... }; // + 1, no zero sized array without arguments
+            if (!CheckFormat(text, std::span{ kinds, sizeof...(Args) }))
+            {
+                throw "log format string is malformed, does not match the number of arguments or has a spec the argument cannot take";
+            }
+        }
+
+        std::string_view text;
+    };
+
+    // keeps the format string out of template argument deduction, the arguments decide Args
+    template <typename... Args>
+    using FormatString = BasicFormatString<std::type_identity_t<Args>...>;
+
+    // writes at most out.size() characters and returns how many were written
+    size_t FormatTo(std::span<char> out, std::string_view format, std::span<const Arg> args);
+}
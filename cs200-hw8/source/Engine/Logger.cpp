@@ -9,65 +9,233 @@
  */
 
 #include "Logger.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <iostream>
 
+namespace
+{
+    constexpr std::array<std::string_view, 4> severity_names = { "Verbose", "Debug", "Event", "Error" };
+    constexpr size_t                          ring_mask      = CS230::Logger::RingCapacity - 1;
+
+    static_assert((CS230::Logger::RingCapacity & ring_mask) == 0, "RingCapacity must be a power of two");
+}
+
 namespace CS230
 {
-    Logger::Logger(Severity severity, bool use_console, std::chrono::system_clock::time_point _start_time) : min_level(severity), out_stream("Trace.log"), start_time(_start_time)
+    Logger::Logger(Severity severity, bool use_console, std::chrono::system_clock::time_point _start_time, OverflowPolicy overflow_policy)
+        : min_level(severity), overflow(overflow_policy), out_stream("Trace.log"), start_time(_start_time), cells(new Cell[RingCapacity])
     {
         if (use_console == true)
         {
             out_stream.basic_ios<char>::rdbuf(std::cout.rdbuf());
-            ;
         }
+        out_stream.precision(4);
+        out_stream << std::fixed;
+        for (size_t i = 0; i < RingCapacity; ++i)
+        {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+#if !defined(__EMSCRIPTEN__)
+        threaded = true;
+        running  = true;
+        writer   = std::thread(&Logger::writer_main, this);
+#endif
     }
 
-    void Logger::LogError(std::string text)
+    Logger::~Logger()
+    {
+        if (writer.joinable())
+        {
+            running = false;
+            wake_writer();
+            writer.join();
+        }
+    }
+
+    void Logger::LogError(std::string_view text)
     {
         log(Severity::Error, text);
     }
 
-    void Logger::LogEvent(std::string text)
+    void Logger::LogEvent(std::string_view text)
     {
         log(Severity::Event, text);
     }
 
-    void Logger::LogDebug(std::string text)
+    void Logger::LogDebug(std::string_view text)
     {
         log(Severity::Debug, text);
     }
 
-    void Logger::LogVerbose(std::string text)
+    void Logger::LogVerbose(std::string_view text)
     {
         log(Severity::Verbose, text);
     }
 
-    void Logger::log(Severity severity, std::string message)
+    void Logger::Flush()
     {
-        std::map<CS230::Logger::Severity, std::string> get_error_level = {
-            { CS230::Logger::Severity::Verbose, "Verbose" },
-            {   CS230::Logger::Severity::Debug,   "Debug" },
-            {   CS230::Logger::Severity::Event,   "Event" },
-            {   CS230::Logger::Severity::Error,   "Error" }
-        };
-        std::string answer = get_error_level[severity] + "\t" + message;
-        //===========map_version
+        const size_t target = enqueue_pos.load(std::memory_order_acquire);
+        while (running.load(std::memory_order_relaxed) && written.load(std::memory_order_acquire) < target)
+        {
+            std::this_thread::yield();
+        }
+    }
 
+    void Logger::log(Severity severity, std::string_view message)
+    {
+        if (!IsEnabled(severity))
+        {
+            return;
+        }
+        const double seconds = seconds_since_start();
+        if (!threaded)
+        {
+            // no writer thread, this is the only thread writing to the stream
+            Record record{ seconds, severity, 0, {} };
+            record.length = static_cast<uint32_t>(std::min(message.size(), MaxMessageSize));
+            std::memcpy(record.text, message.data(), record.length);
+            write(record);
+            return;
+        }
+        while (!try_push(severity, seconds, message))
+        {
+            if (overflow == OverflowPolicy::Drop)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            std::this_thread::yield();
+        }
+        // pairs with the fence in writer_main: either the writer sees this record when it rechecks the ring,
+        // or this sees it waiting
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (writer_waiting.load(std::memory_order_relaxed))
+        {
+            wake_writer();
+        }
+    }
 
-        if (int(CS230::Logger::min_level) <= int(severity))
+    void Logger::wake_writer()
+    {
+        writer_waiting.store(false, std::memory_order_seq_cst);
+        writer_waiting.notify_one();
+    }
+
+    bool Logger::try_push(Severity severity, double seconds, std::string_view message)
+    {
+        size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Cell*  cell;
+        while (true)
+        {
+            cell                        = &cells[pos & ring_mask];
+            const size_t         seq    = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t behind = static_cast<std::ptrdiff_t>(seq - pos);
+            if (behind == 0)
+            {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (behind < 0)
+            {
+                return false; // the writer has not consumed this cell from the previous lap yet
+            }
+            else
+            {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        Record& record  = cell->record;
+        record.seconds  = seconds;
+        record.severity = severity;
+        if (message.size() <= MaxMessageSize)
+        {
+            record.length = static_cast<uint32_t>(message.size());
+            std::memcpy(record.text, message.data(), message.size());
+        }
+        else
         {
-            out_stream.precision(4);
-            out_stream << '[' << std::fixed << seconds_since_start() << "]\t";
-            out_stream << answer << "\n";
+            record.length = MaxMessageSize;
+            std::memcpy(record.text, message.data(), MaxMessageSize - 3);
+            std::memcpy(record.text + MaxMessageSize - 3, "...", 3);
+        }
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t Logger::drain()
+    {
+        size_t count = 0;
+        while (true)
+        {
+            Cell&        cell = cells[dequeue_pos & ring_mask];
+            const size_t seq  = cell.sequence.load(std::memory_order_acquire);
+            if (seq != dequeue_pos + 1)
+            {
+                break;
+            }
+            write(cell.record);
+            cell.sequence.store(dequeue_pos + RingCapacity, std::memory_order_release);
+            ++dequeue_pos;
+            ++count;
+        }
+        written.fetch_add(count, std::memory_order_release);
+        return count;
+    }
+
+    void Logger::write(const Record& record)
+    {
+        out_stream << '[' << record.seconds << "]\t" << severity_names[static_cast<size_t>(record.severity)] << '\t';
+        out_stream.write(record.text, static_cast<std::streamsize>(record.length));
+        out_stream << '\n';
+    }
+
+    void Logger::writer_main()
+    {
+        while (true)
+        {
+            // read before draining, so everything logged before the destructor ran is written
+            const bool   stopping = !running.load(std::memory_order_acquire);
+            const size_t count    = drain();
+
+            const uint64_t lost = dropped.load(std::memory_order_relaxed);
+            if (lost != reported_dropped)
+            {
+                out_stream << '[' << seconds_since_start() << "]\tError\t" << (lost - reported_dropped) << " log messages dropped, the ring was full\n";
+                reported_dropped = lost;
+            }
+            if (count > 0)
+            {
+                out_stream.flush();
+            }
+            if (stopping)
+            {
+                break;
+            }
+            if (count == 0)
+            {
+                // sleep until a log call finds the flag set, instead of polling an idle ring
+                writer_waiting.store(true, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const Cell& next = cells[dequeue_pos & ring_mask];
+                if (next.sequence.load(std::memory_order_acquire) != dequeue_pos + 1 && running.load() && dropped.load(std::memory_order_relaxed) == reported_dropped)
+                {
+                    writer_waiting.wait(true, std::memory_order_acquire);
+                }
+                writer_waiting.store(false, std::memory_order_relaxed);
+            }
         }
-        return;
+        out_stream.flush();
     }
 
     double Logger::seconds_since_start()
     {
-        return std::chrono::duration<double>(std::chrono::system_clock::now() -start_time).count();
+        return std::chrono::duration<double>(std::chrono::system_clock::now() - start_time).count();
     }
 
     // note the proper way to redirect the rdbuf is `stream.basic_ios<char>::rdbuf(other_stream.rdbuf());`
-    // note that we don't need a destructor ~Logger() if all we are doing is closing the streams. The std stream classes impl Rule of 5 and will auto flush & close themselves
 }
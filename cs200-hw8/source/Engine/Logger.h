@@ -9,13 +9,23 @@
  */
 
 #pragma once
+#include "LogFormat.h"
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
-#include <map>
-#include <string>
+#include <memory>
+#include <string_view>
+#include <thread>
 
 namespace CS230
 {
+    // Log calls copy the message into a fixed size record on a lock-free ring and return; a writer thread
+    // formats the records and writes them out, and sleeps while the ring is empty. Any thread may log.
+    // Messages below the minimum severity are dropped before anything is copied. The web build has no
+    // writer thread and writes on the calling thread.
     class Logger
     {
     public:
@@ -26,21 +36,125 @@ namespace CS230
             Event,   // General event, like key press or state change
             Error    // Errors, such as file load errors
         };
-        Logger(Severity severity, bool use_console, std::chrono::system_clock::time_point start_time);
 
-        void LogError(std::string text);
+        // what a log call does when the writer has fallen a whole ring behind
+        enum class OverflowPolicy
+        {
+            Drop, // count the message and return, the writer reports how many were lost
+            Block // wait for the writer to free a record
+        };
+
+        static constexpr size_t RingCapacity   = 1024; // records, power of two
+        static constexpr size_t MaxMessageSize = 232;  // longer messages are cut, a ring cell is 256 bytes
+
+        Logger(Severity severity, bool use_console, std::chrono::system_clock::time_point start_time, OverflowPolicy overflow = OverflowPolicy::Drop);
+        ~Logger();
+
+        Logger(const Logger&)            = delete;
+        Logger& operator=(const Logger&) = delete;
+
+        void LogError(std::string_view text);
 
-        void LogEvent(std::string text);
+        void LogEvent(std::string_view text);
 
-        void LogDebug(std::string text);
+        void LogDebug(std::string_view text);
+
+        void LogVerbose(std::string_view text);
+
+        // formats into a stack buffer and logs it, see LogFormat.h for the placeholders; prefer the LOG_* macros,
+        // they skip evaluating the arguments when the severity is filtered out
+        template <typename... Args>
+        void Log(Severity severity, log_format::FormatString<Args...> format, const Args&... args)
+        {
+            if (!IsEnabled(severity))
+            {
+                return;
+            }
+            const std::array<log_format::Arg, sizeof...(Args)> erased{ log_format::MakeArg(args)... };
+            char                                               buffer[MaxMessageSize];
+            log(severity, std::string_view(buffer, log_format::FormatTo(buffer, format.text, erased)));
+        }
+
+        // lets callers skip building a message that would be filtered out anyway
+        bool IsEnabled(Severity severity) const
+        {
+            return static_cast<int>(min_level) <= static_cast<int>(severity);
+        }
 
-        void LogVerbose(std::string text);
+        // blocks until everything logged before the call is written
+        void     Flush();
+        uint64_t DroppedCount() const { return dropped.load(std::memory_order_relaxed); }
 
     private:
+        struct Record
+        {
+            double   seconds;
+            Severity severity;
+            uint32_t length;
+            char     text[MaxMessageSize];
+        };
+
+        // Vyukov's bounded queue: a cell is free for the producer claiming position p when its sequence is p,
+        // and holds a record for the consumer at position p when its sequence is p + 1
+        struct alignas(64) Cell
+        {
+            std::atomic<size_t> sequence;
+            Record              record;
+        };
+        static_assert(sizeof(Cell) == 256);
+
+        void   log(Severity severity, std::string_view message);
+        void   wake_writer();
+        bool   try_push(Severity severity, double seconds, std::string_view message);
+        size_t drain(); // writer thread only
+        void   write(const Record& record);
+        void   writer_main();
+        double seconds_since_start();
+
         Severity                              min_level;
+        OverflowPolicy                        overflow;
         std::ofstream                         out_stream;
         std::chrono::system_clock::time_point start_time;
-        void                                  log(Severity severity, std::string message);
-        double                                seconds_since_start();
+
+        std::unique_ptr<Cell[]>            cells;
+        alignas(64) std::atomic<size_t>    enqueue_pos{ 0 };
+        alignas(64) size_t                 dequeue_pos = 0; // writer thread only
+        std::atomic<size_t>                written{ 0 };
+        std::atomic<uint64_t>              dropped{ 0 };
+        uint64_t                           reported_dropped = 0; // writer thread only
+        bool                               threaded = false; // set once in the constructor
+        std::atomic<bool>                  running{ false };
+        std::atomic<bool>                  writer_waiting{ false }; // the writer found the ring empty and sleeps on it
+        std::thread                        writer;
     };
 }
+
+// Severities below CS230_LOG_LEVEL (0 Verbose, 1 Debug, 2 Event, 3 Error) are compiled out of the LOG_* macros.
+// Developer builds keep everything, other builds drop Verbose and Debug; define it on the command line to override.
+#if !defined(CS230_LOG_LEVEL)
+#    if defined(DEVELOPER_VERSION)
+#        define CS230_LOG_LEVEL 0
+#    else
+#        define CS230_LOG_LEVEL 2
+#    endif
+#endif
+
+// LOG_EVENT("Collision Detected: {} and {}", a->TypeName(), b->TypeName());
+// The arguments are only evaluated when the severity is compiled in and enabled on Engine::GetLogger(),
+// so the expansion site needs Engine.h.
+#define CS230_LOG(severity, ...)                                                                     \
+    do                                                                                               \
+    {                                                                                                \
+        if constexpr (static_cast<int>(severity) >= CS230_LOG_LEVEL)                                 \
+        {                                                                                            \
+            if (CS230::Logger& cs230_logger = Engine::GetLogger(); cs230_logger.IsEnabled(severity)) \
+            {                                                                                        \
+                cs230_logger.Log(severity, __VA_ARGS__);                                             \
+            }                                                                                        \
+        }                                                                                            \
+    } while (false)
+
+#define LOG_ERROR(...)   CS230_LOG(CS230::Logger::Severity::Error, __VA_ARGS__)
+#define LOG_EVENT(...)   CS230_LOG(CS230::Logger::Severity::Event, __VA_ARGS__)
+#define LOG_DEBUG(...)   CS230_LOG(CS230::Logger::Severity::Debug, __VA_ARGS__)
+#define LOG_VERBOSE(...) CS230_LOG(CS230::Logger::Severity::Verbose, __VA_ARGS__)
@@ -0,0 +1,172 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  Lz4.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "Lz4.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    constexpr size_t MinMatch       = 4;
+    constexpr size_t LastLiterals   = 5;  // the block always ends with at least this many literals
+    constexpr size_t MatchSafeLimit = 12; // no match may start closer than this to the end
+    constexpr size_t MaxOffset      = 65535;
+    constexpr int    HashBits       = 12;
+
+    uint32_t read32(const std::byte* bytes)
+    {
+        uint32_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    uint32_t hash(uint32_t sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - HashBits);
+    }
+
+    void write_length(std::vector<std::byte>& out, size_t length)
+    {
+        for (; length >= 255; length -= 255)
+        {
+            out.push_back(std::byte{ 255 });
+        }
+        out.push_back(static_cast<std::byte>(length));
+    }
+
+    void write_sequence(std::vector<std::byte>& out, std::span<const std::byte> literals, size_t offset, size_t match_length)
+    {
+        const size_t literal_code = literals.size() < 15 ? literals.size() : 15;
+        const size_t match_code   = match_length == 0 ? 0 : (match_length - MinMatch < 15 ? match_length - MinMatch : 15);
+        out.push_back(static_cast<std::byte>(literal_code << 4 | match_code));
+        if (literal_code == 15)
+        {
+            write_length(out, literals.size() - 15);
+        }
+        out.insert(out.end(), literals.begin(), literals.end());
+        if (match_length == 0)
+        {
+            return; // last sequence, literals only
+        }
+        out.push_back(static_cast<std::byte>(offset & 0xFF));
+        out.push_back(static_cast<std::byte>(offset >> 8));
+        if (match_code == 15)
+        {
+            write_length(out, match_length - MinMatch - 15);
+        }
+    }
+
+    // reads a 15 + 255 + 255 + ... length continuation, false if it runs off the block
+    bool read_length(std::span<const std::byte> block, size_t& cursor, size_t& length)
+    {
+        uint8_t extra;
+        do
+        {
+            if (cursor >= block.size())
+            {
+                return false;
+            }
+            extra = static_cast<uint8_t>(block[cursor++]);
+            length += extra;
+        } while (extra == 255);
+        return true;
+    }
+}
+
+namespace CS230::lz4
+{
+    std::vector<std::byte> Compress(std::span<const std::byte> source)
+    {
+        std::vector<std::byte> out;
+        out.reserve(source.size() + source.size() / 255 + 16);
+
+        size_t anchor = 0;
+        if (source.size() > MatchSafeLimit)
+        {
+            std::vector<uint32_t> table(size_t{ 1 } << HashBits, 0); // position + 1, 0 = empty
+            const size_t          match_limit = source.size() - LastLiterals;
+            const size_t          start_limit = source.size() - MatchSafeLimit;
+            size_t                position    = 0;
+            while (position < start_limit)
+            {
+                const uint32_t sequence  = read32(source.data() + position);
+                uint32_t&      slot      = table[hash(sequence)];
+                const size_t   candidate = slot;
+                slot                     = static_cast<uint32_t>(position + 1);
+                if (candidate == 0 || position - (candidate - 1) > MaxOffset || read32(source.data() + candidate - 1) != sequence)
+                {
+                    ++position;
+                    continue;
+                }
+
+                const size_t reference = candidate - 1;
+                size_t       length    = MinMatch;
+                while (position + length < match_limit && source[reference + length] == source[position + length])
+                {
+                    ++length;
+                }
+                write_sequence(out, source.subspan(anchor, position - anchor), position - reference, length);
+                position += length;
+                anchor = position;
+            }
+        }
+        write_sequence(out, source.subspan(anchor), 0, 0);
+        return out;
+    }
+
+    bool Decompress(std::span<const std::byte> block, std::span<std::byte> decoded)
+    {
+        size_t in  = 0;
+        size_t out = 0;
+        while (in < block.size())
+        {
+            const auto token   = static_cast<uint8_t>(block[in++]);
+            size_t     literal = token >> 4;
+            if (literal == 15 && !read_length(block, in, literal))
+            {
+                return false;
+            }
+            if (literal > block.size() - in || literal > decoded.size() - out)
+            {
+                return false;
+            }
+            std::memcpy(decoded.data() + out, block.data() + in, literal);
+            in += literal;
+            out += literal;
+            if (in == block.size())
+            {
+                break; // the last sequence has no match
+            }
+
+            if (block.size() - in < 2)
+            {
+                return false;
+            }
+            const size_t offset = static_cast<size_t>(block[in]) | static_cast<size_t>(block[in + 1]) << 8;
+            in += 2;
+            size_t match = token & 15u;
+            if (match == 15 && !read_length(block, in, match))
+            {
+                return false;
+            }
+            match += MinMatch;
+            if (offset == 0 || offset > out || match > decoded.size() - out)
+            {
+                return false;
+            }
+            // byte by byte: the match may overlap what it is writing (offset < length repeats a pattern)
+            for (size_t i = 0; i < match; ++i, ++out)
+            {
+                decoded[out] = decoded[out - offset];
+            }
+        }
+        return out == decoded.size();
+    }
+}
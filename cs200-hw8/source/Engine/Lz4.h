@@ -0,0 +1,24 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  Lz4.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include <cstddef>
+#include <span>
+#include <vector>
+
+// LZ4 block format (no frame header, no checksum), enough for the per-entry compression of AssetArchive.
+// The compressor is the simple greedy single-hash variant, its ratio is a bit worse than the reference
+// encoder's but the output is standard LZ4 and decodes just as fast.
+namespace CS230::lz4
+{
+    std::vector<std::byte> Compress(std::span<const std::byte> source);
+    // decoded has to be exactly the size of the original data, false when the block is malformed
+    bool Decompress(std::span<const std::byte> block, std::span<std::byte> decoded);
+}
@@ -0,0 +1,112 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  MappedFile.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "MappedFile.h"
+
+#include <fstream>
+
+#if defined(_WIN32)
+#    define WIN32_LEAN_AND_MEAN
+#    define NOMINMAX
+#    include <windows.h>
+#    define MAPPED_FILE_WIN32
+#elif !defined(__EMSCRIPTEN__) && (defined(__unix__) || defined(__APPLE__))
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#    define MAPPED_FILE_POSIX
+#endif
+
+namespace
+{
+    bool read_whole_file(const std::filesystem::path& file_path, std::vector<std::byte>& contents)
+    {
+        std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+        {
+            return false;
+        }
+        contents.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(contents.data()), static_cast<std::streamsize>(contents.size())));
+    }
+}
+
+namespace CS230
+{
+    std::shared_ptr<const MappedFile> MappedFile::Open(const std::filesystem::path& file_path)
+    {
+        std::shared_ptr<MappedFile> file(new MappedFile());
+
+#if defined(MAPPED_FILE_WIN32)
+        const HANDLE handle = CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER file_size{};
+            GetFileSizeEx(handle, &file_size);
+            const HANDLE section = file_size.QuadPart > 0 ? CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+            CloseHandle(handle); // the view keeps the file open
+            if (section != nullptr)
+            {
+                void* view = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(section);
+                if (view != nullptr)
+                {
+                    file->mapping = view;
+                    file->data    = static_cast<const std::byte*>(view);
+                    file->size    = static_cast<size_t>(file_size.QuadPart);
+                    return file;
+                }
+            }
+        }
+#elif defined(MAPPED_FILE_POSIX)
+        const int descriptor = ::open(file_path.c_str(), O_RDONLY);
+        if (descriptor >= 0)
+        {
+            struct stat info{};
+            void*       address = MAP_FAILED;
+            if (::fstat(descriptor, &info) == 0 && info.st_size > 0)
+            {
+                address = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            }
+            ::close(descriptor); // the mapping stays valid after close
+            if (address != MAP_FAILED)
+            {
+                file->mapping = address;
+                file->data    = static_cast<const std::byte*>(address);
+                file->size    = static_cast<size_t>(info.st_size);
+                return file;
+            }
+        }
+#endif
+
+        // web build, empty files and anything the platform refused to map
+        if (!read_whole_file(file_path, file->contents))
+        {
+            return nullptr;
+        }
+        file->data = file->contents.data();
+        file->size = file->contents.size();
+        return file;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (mapping == nullptr)
+        {
+            return;
+        }
+#if defined(MAPPED_FILE_WIN32)
+        UnmapViewOfFile(mapping);
+#elif defined(MAPPED_FILE_POSIX)
+        ::munmap(mapping, size);
+#endif
+    }
+}
@@ -0,0 +1,43 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  MappedFile.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace CS230
+{
+    // Read-only view of a whole file. Memory-mapped on desktop, so Bytes() costs nothing until a page is touched;
+    // the web build has no mmap and reads the file into memory instead. The start of Bytes() is at least 16 byte aligned.
+    class MappedFile
+    {
+    public:
+        // nullptr when the file cannot be opened
+        static std::shared_ptr<const MappedFile> Open(const std::filesystem::path& file_path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        std::span<const std::byte> Bytes() const { return { data, size }; }
+
+    private:
+        MappedFile() = default;
+
+        const std::byte*       data    = nullptr;
+        size_t                 size    = 0;
+        void*                  mapping = nullptr; // address to unmap, nullptr when the file was read instead
+        std::vector<std::byte> contents;          // used when the file could not be mapped
+    };
+}
@@ -0,0 +1,371 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  Narrowphase.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "Narrowphase.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define NARROWPHASE_SSE
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#    include <arm_neon.h>
+#    define NARROWPHASE_NEON
+#endif
+
+namespace
+{
+    // The kernels below are written once against a lane type V: either f4 (four pairs per instruction)
+    // or plain float (scalar fallback and the single pair Test). Both provide + - * / and the v* helpers.
+    inline float vabs(float a) { return std::abs(a); }
+    inline float vmin(float a, float b) { return std::min(a, b); }
+    inline float vmax(float a, float b) { return std::max(a, b); }
+    inline float vsqrt(float a) { return std::sqrt(a); }
+    inline bool  vless(float a, float b) { return a < b; }
+    inline float vselect(bool mask, float a, float b) { return mask ? a : b; }
+
+#if defined(NARROWPHASE_SSE)
+    struct f4
+    {
+        __m128 v;
+    };
+    struct mask4
+    {
+        __m128 v;
+    };
+    inline f4    operator+(f4 a, f4 b) { return { _mm_add_ps(a.v, b.v) }; }
+    inline f4    operator-(f4 a, f4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+    inline f4    operator*(f4 a, f4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+    inline f4    operator/(f4 a, f4 b) { return { _mm_div_ps(a.v, b.v) }; }
+    inline f4    operator-(f4 a) { return { _mm_sub_ps(_mm_setzero_ps(), a.v) }; }
+    inline f4    vabs(f4 a) { return { _mm_andnot_ps(_mm_set1_ps(-0.f), a.v) }; }
+    inline f4    vmin(f4 a, f4 b) { return { _mm_min_ps(a.v, b.v) }; }
+    inline f4    vmax(f4 a, f4 b) { return { _mm_max_ps(a.v, b.v) }; }
+    inline f4    vsqrt(f4 a) { return { _mm_sqrt_ps(a.v) }; }
+    inline mask4 vless(f4 a, f4 b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+    inline f4    vselect(mask4 mask, f4 a, f4 b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+    inline f4    load4(const float* p) { return { _mm_loadu_ps(p) }; }
+    inline void  store4(float* p, f4 a) { _mm_storeu_ps(p, a.v); }
+    inline f4    splat4(float a) { return { _mm_set1_ps(a) }; }
+#elif defined(NARROWPHASE_NEON)
+    struct f4
+    {
+        float32x4_t v;
+    };
+    struct mask4
+    {
+        uint32x4_t v;
+    };
+    inline f4    operator+(f4 a, f4 b) { return { vaddq_f32(a.v, b.v) }; }
+    inline f4    operator-(f4 a, f4 b) { return { vsubq_f32(a.v, b.v) }; }
+    inline f4    operator*(f4 a, f4 b) { return { vmulq_f32(a.v, b.v) }; }
+    inline f4    operator/(f4 a, f4 b) { return { vdivq_f32(a.v, b.v) }; }
+    inline f4    operator-(f4 a) { return { vnegq_f32(a.v) }; }
+    inline f4    vabs(f4 a) { return { vabsq_f32(a.v) }; }
+    inline f4    vmin(f4 a, f4 b) { return { vminq_f32(a.v, b.v) }; }
+    inline f4    vmax(f4 a, f4 b) { return { vmaxq_f32(a.v, b.v) }; }
+    inline f4    vsqrt(f4 a) { return { vsqrtq_f32(a.v) }; }
+    inline mask4 vless(f4 a, f4 b) { return { vcltq_f32(a.v, b.v) }; }
+    inline f4    vselect(mask4 mask, f4 a, f4 b) { return { vbslq_f32(mask.v, a.v, b.v) }; }
+    inline f4    load4(const float* p) { return { vld1q_f32(p) }; }
+    inline void  store4(float* p, f4 a) { vst1q_f32(p, a.v); }
+    inline f4    splat4(float a) { return { vdupq_n_f32(a) }; }
+#endif
+
+#if defined(NARROWPHASE_SSE) || defined(NARROWPHASE_NEON)
+    using Lane                 = f4;
+    constexpr size_t LaneWidth = 4;
+#else
+    using Lane                 = float;
+    constexpr size_t LaneWidth = 1;
+#endif
+
+    template <typename V>
+    V constant(float value)
+    {
+        if constexpr (std::is_same_v<V, float>)
+            return value;
+        else
+            return splat4(value);
+    }
+
+    template <typename V>
+    V load(const float* p)
+    {
+        if constexpr (std::is_same_v<V, float>)
+            return *p;
+        else
+            return load4(p);
+    }
+
+    template <typename V>
+    void store(float* p, V value)
+    {
+        if constexpr (std::is_same_v<V, float>)
+            *p = value;
+        else
+            store4(p, value);
+    }
+
+    constexpr float Epsilon = 1e-6f;
+
+    template <typename V>
+    struct ContactLanes
+    {
+        V nx, ny, depth;
+    };
+
+    template <typename V>
+    V sign_of(V value)
+    {
+        return vselect(vless(value, constant<V>(0.f)), constant<V>(-1.f), constant<V>(1.f));
+    }
+
+    // columns: a.x a.y a.r b.x b.y b.r
+    template <typename V>
+    ContactLanes<V> circle_circle(const V* in)
+    {
+        const V    dx    = in[3] - in[0];
+        const V    dy    = in[4] - in[1];
+        const V    dist  = vsqrt(dx * dx + dy * dy);
+        const auto apart = vless(constant<V>(Epsilon), dist);
+        const V    inv   = constant<V>(1.f) / vmax(dist, constant<V>(Epsilon));
+        // concentric circles push along +x
+        return { vselect(apart, dx * inv, constant<V>(1.f)), vselect(apart, dy * inv, constant<V>(0.f)), in[2] + in[5] - dist };
+    }
+
+    // columns: a.x a.y a.axis.x a.axis.y a.half.x a.half.y, then the same for b
+    template <typename V>
+    ContactLanes<V> box_box(const V* in)
+    {
+        const V dx  = in[6] - in[0];
+        const V dy  = in[7] - in[1];
+        const V aux = in[2], auy = in[3], ahx = in[4], ahy = in[5];
+        const V bux = in[8], buy = in[9], bhx = in[10], bhy = in[11];
+        const V avx = -auy, avy = aux;
+        const V bvx = -buy, bvy = bux;
+
+        // |cosines| between the four axes, shared by every projection
+        const V uu = vabs(aux * bux + auy * buy);
+        const V uv = vabs(aux * bvx + auy * bvy);
+        const V vu = vabs(avx * bux + avy * buy);
+        const V vv = vabs(avx * bvx + avy * bvy);
+
+        // overlap along an axis = both projected radii minus the projected center distance
+        const V along_au = dx * aux + dy * auy;
+        const V along_av = dx * avx + dy * avy;
+        const V along_bu = dx * bux + dy * buy;
+        const V along_bv = dx * bvx + dy * bvy;
+        const V overlap_au = ahx + bhx * uu + bhy * uv - vabs(along_au);
+        const V overlap_av = ahy + bhx * vu + bhy * vv - vabs(along_av);
+        const V overlap_bu = ahx * uu + ahy * vu + bhx - vabs(along_bu);
+        const V overlap_bv = ahx * uv + ahy * vv + bhy - vabs(along_bv);
+
+        // smallest overlap wins, normal faces from a to b
+        V depth = overlap_au;
+        V nx    = aux * sign_of(along_au);
+        V ny    = auy * sign_of(along_au);
+        const auto take = [&](V overlap, V axis_x, V axis_y, V along)
+        {
+            const auto smaller = vless(overlap, depth);
+            depth              = vselect(smaller, overlap, depth);
+            nx                 = vselect(smaller, axis_x * sign_of(along), nx);
+            ny                 = vselect(smaller, axis_y * sign_of(along), ny);
+        };
+        take(overlap_av, avx, avy, along_av);
+        take(overlap_bu, bux, buy, along_bu);
+        take(overlap_bv, bvx, bvy, along_bv);
+        return { nx, ny, depth };
+    }
+
+    // columns: box.x box.y box.axis.x box.axis.y box.half.x box.half.y circle.x circle.y circle.r
+    template <typename V>
+    ContactLanes<V> box_circle(const V* in)
+    {
+        const V ux = in[2], uy = in[3], hx = in[4], hy = in[5], radius = in[8];
+        const V vx = -uy, vy = ux;
+        const V px = in[6] - in[0];
+        const V py = in[7] - in[1];
+
+        // circle center in box space, and the closest point of the box to it
+        const V lx = px * ux + py * uy;
+        const V ly = px * vx + py * vy;
+        const V ox = lx - vmin(vmax(lx, -hx), hx);
+        const V oy = ly - vmin(vmax(ly, -hy), hy);
+
+        const V    dist    = vsqrt(ox * ox + oy * oy);
+        const auto outside = vless(constant<V>(Epsilon), dist);
+        const V    inv     = constant<V>(1.f) / vmax(dist, constant<V>(Epsilon));
+
+        // center inside the box: leave through the nearest face
+        const V    exit_x = hx - vabs(lx);
+        const V    exit_y = hy - vabs(ly);
+        const auto use_x  = vless(exit_x, exit_y);
+        const V    in_nx  = vselect(use_x, sign_of(lx), constant<V>(0.f));
+        const V    in_ny  = vselect(use_x, constant<V>(0.f), sign_of(ly));
+
+        const V local_nx = vselect(outside, ox * inv, in_nx);
+        const V local_ny = vselect(outside, oy * inv, in_ny);
+        const V depth    = vselect(outside, radius - dist, radius + vselect(use_x, exit_x, exit_y));
+        return { local_nx * ux + local_ny * vx, local_nx * uy + local_ny * vy, depth };
+    }
+
+    enum class PairKind
+    {
+        BoxBox,
+        CircleCircle,
+        BoxCircle
+    };
+
+    // flattens a pair into kernel columns, (circle, box) is swapped to (box, circle)
+    PairKind classify(const CS230::WorldShape& a, const CS230::WorldShape& b, float* values, bool& flipped)
+    {
+        using Type      = CS230::WorldShape::Type;
+        size_t count    = 0;
+        const auto put  = [&](double value) { values[count++] = static_cast<float>(value); };
+        const auto box  = [&](const CS230::WorldShape& shape)
+        {
+            put(shape.center.x);
+            put(shape.center.y);
+            put(shape.axis.x);
+            put(shape.axis.y);
+            put(shape.half_extents.x);
+            put(shape.half_extents.y);
+        };
+        const auto circle = [&](const CS230::WorldShape& shape)
+        {
+            put(shape.center.x);
+            put(shape.center.y);
+            put(shape.radius);
+        };
+
+        flipped = false;
+        if (a.type == Type::Box && b.type == Type::Box)
+        {
+            box(a);
+            box(b);
+            return PairKind::BoxBox;
+        }
+        if (a.type == Type::Circle && b.type == Type::Circle)
+        {
+            circle(a);
+            circle(b);
+            return PairKind::CircleCircle;
+        }
+        flipped = a.type == Type::Circle;
+        box(flipped ? b : a);
+        circle(flipped ? a : b);
+        return PairKind::BoxCircle;
+    }
+
+    constexpr size_t column_count(PairKind kind)
+    {
+        return kind == PairKind::BoxBox ? 12 : (kind == PairKind::CircleCircle ? 6 : 9);
+    }
+
+    template <typename V>
+    ContactLanes<V> run_kernel(PairKind kind, const V* in)
+    {
+        switch (kind)
+        {
+            case PairKind::BoxBox: return box_box(in);
+            case PairKind::CircleCircle: return circle_circle(in);
+            case PairKind::BoxCircle: return box_circle(in);
+        }
+        return box_box(in);
+    }
+
+    CS230::Contact to_contact(float nx, float ny, float depth, bool flipped)
+    {
+        CS230::Contact contact{ Math::vec2{ static_cast<double>(nx), static_cast<double>(ny) }, static_cast<double>(depth) };
+        return flipped ? contact.Flipped() : contact;
+    }
+}
+
+namespace CS230
+{
+    Contact Narrowphase::Test(const WorldShape& a, const WorldShape& b)
+    {
+        float          values[MaxColumns]{};
+        bool           flipped = false;
+        const PairKind kind    = classify(a, b, values, flipped);
+        const auto     lanes   = run_kernel<float>(kind, values);
+        return to_contact(lanes.nx, lanes.ny, lanes.depth, flipped);
+    }
+
+    void Narrowphase::Clear()
+    {
+        for (Batch* batch : { &box_box, &circle_circle, &box_circle })
+        {
+            for (std::vector<float>& column : batch->columns)
+            {
+                column.clear();
+            }
+            batch->pair_index.clear();
+            batch->flipped.clear();
+        }
+        contacts.clear();
+    }
+
+    void Narrowphase::Add(const WorldShape& a, const WorldShape& b)
+    {
+        float          values[MaxColumns]{};
+        bool           flipped = false;
+        const PairKind kind    = classify(a, b, values, flipped);
+        Batch&         batch   = kind == PairKind::BoxBox ? box_box : (kind == PairKind::CircleCircle ? circle_circle : box_circle);
+        for (size_t column = 0; column < column_count(kind); ++column)
+        {
+            batch.columns[column].push_back(values[column]);
+        }
+        batch.pair_index.push_back(static_cast<uint32_t>(contacts.size()));
+        batch.flipped.push_back(flipped ? 1 : 0);
+        contacts.push_back(Contact{});
+    }
+
+    void Narrowphase::Run()
+    {
+        const std::pair<Batch*, PairKind> batches[] = { { &box_box, PairKind::BoxBox }, { &circle_circle, PairKind::CircleCircle }, { &box_circle, PairKind::BoxCircle } };
+        for (const auto& [batch, kind] : batches)
+        {
+            const size_t count   = batch->Size();
+            const size_t columns = column_count(kind);
+            if (count == 0)
+            {
+                continue;
+            }
+            // pad to whole lanes with copies of the last pair, their results are dropped
+            const size_t padded = (count + LaneWidth - 1) / LaneWidth * LaneWidth;
+            for (size_t column = 0; column < columns; ++column)
+            {
+                batch->columns[column].resize(padded, batch->columns[column].back());
+            }
+
+            for (size_t first = 0; first < count; first += LaneWidth)
+            {
+                Lane in[MaxColumns];
+                for (size_t column = 0; column < columns; ++column)
+                {
+                    in[column] = load<Lane>(&batch->columns[column][first]);
+                }
+                const ContactLanes<Lane> lanes = run_kernel<Lane>(kind, in);
+
+                float nx[LaneWidth], ny[LaneWidth], depth[LaneWidth];
+                store(nx, lanes.nx);
+                store(ny, lanes.ny);
+                store(depth, lanes.depth);
+                for (size_t lane = 0; lane < LaneWidth && first + lane < count; ++lane)
+                {
+                    contacts[batch->pair_index[first + lane]] = to_contact(nx[lane], ny[lane], depth[lane], batch->flipped[first + lane] != 0);
+                }
+            }
+        }
+    }
+}
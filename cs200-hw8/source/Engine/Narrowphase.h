@@ -0,0 +1,76 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  Narrowphase.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "Vec2.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace CS230
+{
+    // A collider in world space. Boxes are oriented: axis is the unit x axis of the box, y is its perpendicular.
+    struct WorldShape
+    {
+        enum class Type
+        {
+            Box,
+            Circle
+        };
+        Type       type = Type::Box;
+        Math::vec2 center{};
+        Math::vec2 axis{ 1.0, 0.0 };
+        Math::vec2 half_extents{}; // boxes
+        double     radius = 0.0;   // circles
+    };
+
+    // What the narrowphase reports for a pair (a, b): normal is the unit direction from a towards b
+    // to push b out along, depth how far the shapes overlap along it. Touching shapes do not count.
+    struct Contact
+    {
+        Math::vec2 normal{};
+        double     depth = 0.0;
+
+        bool    IsTouching() const { return depth > 0.0; }
+        Contact Flipped() const { return { Math::vec2{ -normal.x, -normal.y }, depth }; }
+    };
+
+    // Box-box (separating axis test on both boxes' axes), circle-circle and box-circle.
+    // Pairs are queued with Add, bucketed by shape combination into structure-of-arrays lanes,
+    // and Run pushes each bucket through a 4-wide SIMD kernel.
+    class Narrowphase
+    {
+    public:
+        // one pair right away, same math as the batched path
+        static Contact Test(const WorldShape& a, const WorldShape& b);
+
+        void Clear();
+        void Add(const WorldShape& a, const WorldShape& b);
+        void Run();
+
+        // one entry per Add, in the same order
+        std::span<const Contact> Contacts() const { return contacts; }
+
+    private:
+        static constexpr size_t MaxColumns = 12;
+
+        struct Batch
+        {
+            std::vector<float>    columns[MaxColumns];
+            std::vector<uint32_t> pair_index;
+            std::vector<uint8_t>  flipped; // pair was added as (circle, box) and went in as (box, circle)
+            size_t                Size() const { return pair_index.size(); }
+        };
+
+        Batch                box_box, circle_circle, box_circle;
+        std::vector<Contact> contacts;
+    };
+}
@@ -27,6 +27,11 @@ namespace CS230
 		{
 			return 70;
 		}
+
+        bool IsThreadSafeUpdate() const override
+        {
+            return true;
+        }
         bool Alive()
         {
             return life > 0;
@@ -87,7 +92,7 @@ namespace CS230
         {
             if ((particles[i])&&(particles[i]->Alive()))
             {
-                Engine::GetLogger().LogEvent("Particle overwritten");
+                LOG_EVENT("Particle overwritten");
             }
             double angle_variation = 0.0;
             if (spread != 0)
@@ -0,0 +1,191 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  ParticleEmitter.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "ParticleEmitter.h"
+#include "Engine.h"
+#include "JobSystem.h"
+#include "Random.h"
+#include "Texture.h"
+#include "TextureManager.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define PARTICLE_EMITTER_SSE
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define PARTICLE_EMITTER_NEON
+#endif
+
+namespace CS230
+{
+    ParticleEmitter::ParticleEmitter(const std::filesystem::path& texture_file, size_t max_count, double max_life_time, double particle_size)
+        : ParticleEmitter(Engine::GetTextureManager().Load(texture_file), max_count, max_life_time, particle_size)
+    {
+    }
+
+    ParticleEmitter::ParticleEmitter(std::shared_ptr<Texture> particle_texture, size_t max_count, double max_life_time, double particle_size)
+        : texture(std::move(particle_texture)),
+          capacity(max_count),
+          inv_max_life(static_cast<float>(1.0 / std::max(max_life_time, 1e-6))),
+          max_life(static_cast<float>(max_life_time)),
+          size(static_cast<float>(particle_size))
+    {
+        // padded to whole blocks so the kernel never needs a scalar tail
+        const size_t padded = (capacity + BlockSize - 1) / BlockSize * BlockSize;
+        for (auto* array : { &px, &py, &vx, &vy, &life })
+        {
+            array->resize(padded, 0.f);
+        }
+        tint.resize(padded);
+    }
+
+    void ParticleEmitter::Emit(size_t emit_count, Math::vec2 emitter_position, Math::vec2 emitter_velocity, Math::vec2 direction, double spread, CS200::RGBA color)
+    {
+        emit_count                                  = std::min(emit_count, capacity - count);
+        const std::array<unsigned char, 4> rgba = CS200::ColorArray(color);
+        for (size_t n = 0; n < emit_count; ++n, ++count)
+        {
+            const double     angle     = spread != 0.0 ? util::random(-spread / 2.0, spread / 2.0) : 0.0;
+            const Math::vec2 magnitude = direction * util::random(0.5, 1.0);
+            const Math::vec2 velocity  = Math::RotationMatrix(angle) * magnitude + emitter_velocity;
+            px[count]                  = static_cast<float>(emitter_position.x);
+            py[count]                  = static_cast<float>(emitter_position.y);
+            vx[count]                  = static_cast<float>(velocity.x);
+            vy[count]                  = static_cast<float>(velocity.y);
+            life[count]                = max_life;
+            tint[count]                = rgba;
+        }
+    }
+
+    void ParticleEmitter::Update(double dt)
+    {
+        const size_t end = (count + BlockSize - 1) / BlockSize * BlockSize;
+        const float  step = static_cast<float>(dt);
+        if (count >= ParallelThreshold)
+        {
+            const size_t block_count = end / BlockSize;
+            Engine::GetJobSystem().ParallelFor(block_count, ParallelThreshold / (BlockSize * 4), [this, step](size_t first, size_t last) {
+                simulate(first * BlockSize, last * BlockSize, step);
+            });
+        }
+        else
+        {
+            simulate(0, end, step);
+        }
+        remove_dead();
+    }
+
+    void ParticleEmitter::simulate(size_t begin, size_t end, float dt)
+    {
+        const float gx = static_cast<float>(gravity.x) * dt;
+        const float gy = static_cast<float>(gravity.y) * dt;
+#if defined(PARTICLE_EMITTER_SSE)
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 dvx  = _mm_set1_ps(gx);
+        const __m128 dvy  = _mm_set1_ps(gy);
+        for (size_t i = begin; i < end; i += BlockSize)
+        {
+            const __m128 velocity_x = _mm_add_ps(_mm_loadu_ps(&vx[i]), dvx);
+            const __m128 velocity_y = _mm_add_ps(_mm_loadu_ps(&vy[i]), dvy);
+            _mm_storeu_ps(&vx[i], velocity_x);
+            _mm_storeu_ps(&vy[i], velocity_y);
+            _mm_storeu_ps(&px[i], _mm_add_ps(_mm_loadu_ps(&px[i]), _mm_mul_ps(velocity_x, step)));
+            _mm_storeu_ps(&py[i], _mm_add_ps(_mm_loadu_ps(&py[i]), _mm_mul_ps(velocity_y, step)));
+            _mm_storeu_ps(&life[i], _mm_sub_ps(_mm_loadu_ps(&life[i]), step));
+        }
+#elif defined(PARTICLE_EMITTER_NEON)
+        const float32x4_t step = vdupq_n_f32(dt);
+        const float32x4_t dvx  = vdupq_n_f32(gx);
+        const float32x4_t dvy  = vdupq_n_f32(gy);
+        for (size_t i = begin; i < end; i += BlockSize)
+        {
+            const float32x4_t velocity_x = vaddq_f32(vld1q_f32(&vx[i]), dvx);
+            const float32x4_t velocity_y = vaddq_f32(vld1q_f32(&vy[i]), dvy);
+            vst1q_f32(&vx[i], velocity_x);
+            vst1q_f32(&vy[i], velocity_y);
+            vst1q_f32(&px[i], vmlaq_f32(vld1q_f32(&px[i]), velocity_x, step));
+            vst1q_f32(&py[i], vmlaq_f32(vld1q_f32(&py[i]), velocity_y, step));
+            vst1q_f32(&life[i], vsubq_f32(vld1q_f32(&life[i]), step));
+        }
+#else
+        for (size_t i = begin; i < end; ++i)
+        {
+            vx[i] += gx;
+            vy[i] += gy;
+            px[i] += vx[i] * dt;
+            py[i] += vy[i] * dt;
+            life[i] -= dt;
+        }
+#endif
+    }
+
+    void ParticleEmitter::remove_dead()
+    {
+        // swap the last live particle into each hole, order does not matter for additive looking effects
+        size_t i = 0;
+        while (i < count)
+        {
+            if (life[i] > 0.f)
+            {
+                ++i;
+                continue;
+            }
+            --count;
+            px[i]   = px[count];
+            py[i]   = py[count];
+            vx[i]   = vx[count];
+            vy[i]   = vy[count];
+            life[i] = life[count];
+            tint[i] = tint[count];
+        }
+    }
+
+    void ParticleEmitter::fill_instances(size_t begin, size_t end, const Math::TransformationMatrix& camera_matrix, float size_on_screen)
+    {
+        const float m00 = static_cast<float>(camera_matrix[0][0]), m01 = static_cast<float>(camera_matrix[0][1]), m02 = static_cast<float>(camera_matrix[0][2]);
+        const float m10 = static_cast<float>(camera_matrix[1][0]), m11 = static_cast<float>(camera_matrix[1][1]), m12 = static_cast<float>(camera_matrix[1][2]);
+        for (size_t i = begin; i < end; ++i)
+        {
+            CS200::ParticleInstance& instance = instances[i];
+            instance.x                        = m00 * px[i] + m01 * py[i] + m02;
+            instance.y                        = m10 * px[i] + m11 * py[i] + m12;
+            instance.size                     = size_on_screen;
+            instance.tint                     = tint[i];
+            // alpha fades linearly with the remaining life
+            instance.tint[3] = static_cast<unsigned char>(static_cast<float>(tint[i][3]) * std::clamp(life[i] * inv_max_life, 0.f, 1.f));
+        }
+    }
+
+    void ParticleEmitter::Draw(const Math::TransformationMatrix& camera_matrix, float depth)
+    {
+        if (count == 0 || texture == nullptr)
+        {
+            return;
+        }
+        // the camera only translates and zooms, so one uniform scale covers every particle
+        const double scale          = std::sqrt(std::abs(camera_matrix[0][0] * camera_matrix[1][1] - camera_matrix[0][1] * camera_matrix[1][0]));
+        const float  size_on_screen = size * static_cast<float>(scale);
+
+        instances.resize(count);
+        if (count >= ParallelThreshold)
+        {
+            Engine::GetJobSystem().ParallelFor(count, ParallelThreshold / 4, [this, &camera_matrix, size_on_screen](size_t first, size_t last) {
+                fill_instances(first, last, camera_matrix, size_on_screen);
+            });
+        }
+        else
+        {
+            fill_instances(0, count, camera_matrix, size_on_screen);
+        }
+        Engine::GetTextureManager().GetRenderer2D()->DrawParticles(instances, texture->GetHandle(), Math::vec2{ 0.0, 0.0 }, Math::vec2{ 1.0, 1.0 }, depth);
+    }
+}
@@ -0,0 +1,69 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  ParticleEmitter.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#pragma once
+#include "../CS200/IRenderer2D.h"
+#include "../CS200/RGBA.h"
+#include "Component.h"
+#include "Matrix.h"
+#include "Vec2.h"
+
+#include <array>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace CS230
+{
+    class Texture;
+
+    // Particle system that does not go through GameObjectManager.
+    // State lives in float arrays (position, velocity, life), Update runs a 4-wide SIMD kernel over them
+    // (split across the job system for big emitters) and dead particles are swapped out so the live ones stay packed.
+    // Draw turns the live particles into one DrawParticles call, a single instanced draw on InstancedRenderer2D.
+    // Add it as a GameState component so Update is driven by UpdateGSComponents.
+    class ParticleEmitter : public Component
+    {
+    public:
+        static constexpr size_t ParallelThreshold = 65'536; // below this a job split costs more than it saves
+
+        ParticleEmitter(const std::filesystem::path& texture_file, size_t max_count, double max_life, double particle_size);
+        ParticleEmitter(std::shared_ptr<Texture> particle_texture, size_t max_count, double max_life, double particle_size);
+
+        // same parameters as ParticleManager::Emit: speed is |direction| scaled by [0.5, 1), angle spread is centered on direction.
+        // Particles that do not fit are dropped.
+        void Emit(size_t count, Math::vec2 emitter_position, Math::vec2 emitter_velocity, Math::vec2 direction, double spread, CS200::RGBA color = CS200::WHITE);
+        void Update(double dt) override;
+        void Draw(const Math::TransformationMatrix& camera_matrix, float depth = 0.5f);
+
+        void SetGravity(Math::vec2 acceleration) { gravity = acceleration; }
+
+        size_t Count() const { return count; }
+        size_t Capacity() const { return capacity; }
+
+    private:
+        static constexpr size_t BlockSize = 4;
+
+        void simulate(size_t begin, size_t end, float dt); // begin/end multiples of BlockSize
+        void remove_dead();
+        void fill_instances(size_t begin, size_t end, const Math::TransformationMatrix& camera_matrix, float size_on_screen);
+
+        std::shared_ptr<Texture> texture;
+        size_t                   capacity;
+        size_t                   count = 0;
+        float                    inv_max_life;
+        float                    max_life;
+        float                    size;
+        Math::vec2               gravity{};
+
+        std::vector<float>                        px, py, vx, vy, life;
+        std::vector<std::array<unsigned char, 4>> tint;
+        std::vector<CS200::ParticleInstance>      instances; // Draw scratch
+    };
+}
@@ -7,6 +7,9 @@
  */
 #include "Path.h"
 
+#include "AssetArchive.h"
+#include "MappedFile.h"
+
 #include <SDL.h>
 #include <optional>
 
@@ -32,6 +35,13 @@ namespace
 
         return std::nullopt;
     }
+
+    // written once by mount_archive before loading starts, only read afterwards
+    std::unique_ptr<CS230::AssetArchive>& mounted_archive()
+    {
+        static std::unique_ptr<CS230::AssetArchive> archive;
+        return archive;
+    }
 }
 
 namespace assets
@@ -58,6 +68,11 @@ namespace assets
 
     std::filesystem::path locate_asset(const std::filesystem::path& asset_path)
     {
+        if (is_archived(asset_path))
+        {
+            return CS230::AssetArchive::MakeKey(asset_path);
+        }
+
         auto asset_filepath = asset_path;
         if (!std::filesystem::exists(asset_filepath))
         {
@@ -70,4 +85,75 @@ namespace assets
         }
         return asset_filepath;
     }
+
+    bool mount_archive(const std::filesystem::path& archive_path)
+    {
+        std::unique_ptr<CS230::AssetArchive> archive = CS230::AssetArchive::Open(archive_path);
+        if (archive == nullptr && archive_path.is_relative())
+        {
+            const auto base_path = SDL_GetBasePath();
+            if (base_path != nullptr)
+            {
+                archive = CS230::AssetArchive::Open(std::filesystem::path(base_path) / archive_path);
+                SDL_free(base_path);
+            }
+        }
+        if (archive == nullptr)
+        {
+            return false;
+        }
+        mounted_archive() = std::move(archive);
+        return true;
+    }
+
+    void unmount_archive()
+    {
+        mounted_archive().reset();
+    }
+
+    bool is_archived(const std::filesystem::path& asset_path)
+    {
+        const auto& archive = mounted_archive();
+        return archive != nullptr && archive->Contains(CS230::AssetArchive::MakeKey(asset_path));
+    }
+
+    AssetData read_asset(const std::filesystem::path& asset_path)
+    {
+        if (const auto& archive = mounted_archive(); archive != nullptr)
+        {
+            if (std::optional<AssetData> data = archive->Read(CS230::AssetArchive::MakeKey(asset_path)))
+            {
+                return std::move(*data);
+            }
+        }
+        const std::filesystem::path                file_path = locate_asset(asset_path);
+        std::shared_ptr<const CS230::MappedFile> file      = CS230::MappedFile::Open(file_path);
+        if (file == nullptr)
+        {
+            throw std::runtime_error("Failed to read asset: " + asset_path.string());
+        }
+        const std::span<const std::byte> bytes = file->Bytes();
+        return { bytes, std::move(file) };
+    }
+
+    bool asset_exists(const std::filesystem::path& asset_path)
+    {
+        if (is_archived(asset_path))
+        {
+            return true;
+        }
+        std::error_code error;
+        if (std::filesystem::exists(asset_path, error))
+        {
+            return true;
+        }
+        try
+        {
+            return std::filesystem::exists(get_base_path() / asset_path, error);
+        }
+        catch (const std::exception&)
+        {
+            return false; // no Assets folder at all
+        }
+    }
 }
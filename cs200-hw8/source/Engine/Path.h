@@ -7,11 +7,46 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
+#include <memory>
+#include <span>
+#include <string_view>
 
 namespace assets
 {
+    /**
+     * Whole contents of one asset. The bytes stay valid as long as owner (the mapped file,
+     * the mounted archive or a decompressed copy) is kept alive.
+     */
+    struct AssetData
+    {
+        std::span<const std::byte>  bytes;
+        std::shared_ptr<const void> owner;
+
+        std::string_view text() const
+        {
+            return { reinterpret_cast<const char*>(bytes.data()), bytes.size() };
+        }
+    };
 
     std::filesystem::path get_base_path();
+    /**
+     * Paths inside the mounted archive come back as its key ("Assets/shaders/shape/shape.vert")
+     * without touching the file system, everything else is searched on disk as before.
+     */
     std::filesystem::path locate_asset(const std::filesystem::path& asset_path);
+
+    /**
+     * Mounts a packed archive (see CS230::AssetArchive), looked for next to the working
+     * directory and then next to the executable. Returns false when there is none.
+     */
+    bool mount_archive(const std::filesystem::path& archive_path);
+    void unmount_archive();
+    bool is_archived(const std::filesystem::path& asset_path);
+
+    /** Reads through the mounted archive when it has the path, maps the file from disk otherwise. Throws when missing. */
+    AssetData read_asset(const std::filesystem::path& asset_path);
+    /** Non-throwing check for optional files such as baked siblings. */
+    bool      asset_exists(const std::filesystem::path& asset_path);
 }
@@ -0,0 +1,219 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  RenderThread.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "RenderThread.h"
+
+#include <SDL.h>
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+namespace CS230
+{
+    RenderThread::~RenderThread()
+    {
+        Stop();
+    }
+
+    void RenderThread::Start(SDL_Window* window, SDL_GLContext context)
+    {
+        if (thread.joinable())
+        {
+            return;
+        }
+        sdl_window   = window;
+        gl_context   = context;
+        submitted    = 0;
+        presented    = 0;
+        stopping     = false;
+        context_here = false;
+        // the render thread makes it current before its first frame
+        SDL_GL_MakeCurrent(sdl_window, nullptr);
+        thread = std::thread(&RenderThread::thread_main, this);
+    }
+
+    void RenderThread::Stop()
+    {
+        if (!thread.joinable())
+        {
+            return;
+        }
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        thread.join();
+        SDL_GL_MakeCurrent(sdl_window, gl_context);
+    }
+
+    CS200::RenderCommandList& RenderThread::BeginFrame()
+    {
+        if (acquired > 0)
+        {
+            throw std::runtime_error("RenderThread::BeginFrame called while the main thread holds the GL context");
+        }
+        std::unique_lock lock(mutex);
+        progress.wait(lock, [this] { return submitted - presented < FramesInFlight; });
+        if (error)
+        {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+        // the frame that used this slot FramesInFlight frames ago has been presented
+        Frame& frame = frames[submitted % FramesInFlight];
+        frame.list.Reset();
+        recording = true;
+        return frame.list;
+    }
+
+    void RenderThread::SubmitFrame(CS200::IRenderer2D& renderer, Present present)
+    {
+        if (!recording)
+        {
+            throw std::runtime_error("RenderThread::SubmitFrame without BeginFrame");
+        }
+        {
+            std::lock_guard lock(mutex);
+            Frame& frame   = frames[submitted % FramesInFlight];
+            frame.renderer = &renderer;
+            frame.present  = std::move(present);
+            ++submitted;
+            recording = false;
+        }
+        wake.notify_one();
+    }
+
+    void RenderThread::WaitIdle()
+    {
+        std::unique_lock lock(mutex);
+        progress.wait(lock, [this] { return presented == submitted; });
+        if (error)
+        {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+    void RenderThread::Acquire()
+    {
+        if (acquired++ > 0)
+        {
+            return;
+        }
+        {
+            std::unique_lock lock(mutex);
+            progress.wait(lock, [this] { return presented == submitted; });
+            release_requested = true;
+            wake.notify_one();
+            progress.wait(lock, [this] { return !context_here; });
+        }
+        SDL_GL_MakeCurrent(sdl_window, gl_context);
+    }
+
+    void RenderThread::Release()
+    {
+        if (--acquired > 0)
+        {
+            return;
+        }
+        SDL_GL_MakeCurrent(sdl_window, nullptr);
+        {
+            std::lock_guard lock(mutex);
+            release_requested = false;
+        }
+        wake.notify_one();
+    }
+
+    FrameTimeHistory::Percentiles RenderThread::GetFrameTimes() const
+    {
+        std::lock_guard lock(mutex);
+        return frame_times.Get();
+    }
+
+    void RenderThread::thread_main()
+    {
+        std::unique_lock lock(mutex);
+        while (true)
+        {
+            wake.wait(lock, [this] { return stopping || release_requested || presented < submitted; });
+            if (release_requested)
+            {
+                // only ever requested while no frame is queued, so the main thread can have it right away
+                if (context_here)
+                {
+                    SDL_GL_MakeCurrent(sdl_window, nullptr);
+                    context_here = false;
+                    progress.notify_all();
+                }
+                wake.wait(lock, [this] { return !release_requested || stopping; });
+                continue;
+            }
+            if (presented < submitted)
+            {
+                if (!context_here)
+                {
+                    SDL_GL_MakeCurrent(sdl_window, gl_context);
+                    context_here = true;
+                }
+                Frame& frame = frames[presented % FramesInFlight];
+                lock.unlock();
+
+                const auto         start = std::chrono::steady_clock::now();
+                std::exception_ptr failure;
+                try
+                {
+                    frame.list.Replay(*frame.renderer);
+                    if (frame.present)
+                    {
+                        frame.present();
+                    }
+                }
+                catch (...)
+                {
+                    failure = std::current_exception();
+                }
+                const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                lock.lock();
+                if (failure && !error)
+                {
+                    error = failure;
+                }
+                frame_times.Add(milliseconds);
+                ++presented;
+                progress.notify_all();
+                continue;
+            }
+            if (stopping)
+            {
+                break;
+            }
+        }
+        if (context_here)
+        {
+            SDL_GL_MakeCurrent(sdl_window, nullptr);
+            context_here = false;
+        }
+    }
+
+    GLContextScope::GLContextScope(RenderThread& the_render_thread) : render_thread(the_render_thread.IsRunning() ? &the_render_thread : nullptr)
+    {
+        if (render_thread != nullptr)
+        {
+            render_thread->Acquire();
+        }
+    }
+
+    GLContextScope::~GLContextScope()
+    {
+        if (render_thread != nullptr)
+        {
+            render_thread->Release();
+        }
+    }
+}
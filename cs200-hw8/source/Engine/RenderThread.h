@@ -0,0 +1,116 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  RenderThread.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "CS200/RenderCommandList.h"
+#include "FrameTimeHistory.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+struct SDL_Window;
+typedef void* SDL_GLContext;
+
+namespace CS200
+{
+    class IRenderer2D;
+}
+
+namespace CS230
+{
+    // Thread that owns the GL context and issues recorded frames, so the game can update and record frame
+    // N + 1 while frame N is submitted. There are FramesInFlight command lists: one being recorded by the
+    // main thread and one being replayed here; BeginFrame() waits when the render thread falls behind.
+    //
+    // GL work that is not in a command list (creating textures, loading a state, a state that draws with
+    // GL directly) runs between Acquire() and Release(), usually through GLContextScope: the main thread
+    // waits for the queued frames and takes the context until the scope ends.
+    class RenderThread
+    {
+    public:
+        static constexpr size_t FramesInFlight = 2;
+
+        // runs on the render thread after the frame's commands, for ImGui and the buffer swap
+        using Present = std::function<void()>;
+
+        RenderThread() = default;
+        ~RenderThread();
+
+        RenderThread(const RenderThread&)            = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        // the context has to be current on the calling thread, it is handed to the render thread
+        void Start(SDL_Window* window, SDL_GLContext context);
+        // presents every submitted frame and makes the context current on the calling thread again
+        void Stop();
+        bool IsRunning() const { return thread.joinable(); }
+
+        CS200::RenderCommandList& BeginFrame();
+        void                      SubmitFrame(CS200::IRenderer2D& renderer, Present present = {});
+        // blocks until every submitted frame has been presented
+        void WaitIdle();
+
+        void Acquire();
+        void Release();
+
+        // time the render thread spent on each frame, replay and present included
+        FrameTimeHistory::Percentiles GetFrameTimes() const;
+
+    private:
+        struct Frame
+        {
+            CS200::RenderCommandList list;
+            CS200::IRenderer2D*      renderer = nullptr;
+            Present                  present;
+        };
+
+        void thread_main();
+
+        SDL_Window*   sdl_window = nullptr;
+        SDL_GLContext gl_context = nullptr;
+
+        std::array<Frame, FramesInFlight> frames;
+        uint64_t                          submitted = 0; // frames handed over, frame i lives in frames[i % FramesInFlight]
+        uint64_t                          presented = 0;
+        bool                              recording = false; // main thread only
+        int                               acquired  = 0;     // Acquire depth, main thread only
+
+        mutable std::mutex      mutex;
+        std::condition_variable wake;     // render thread waits for frames or a context request
+        std::condition_variable progress; // main thread waits for presented frames or the context
+        bool                    release_requested = false;
+        bool                    context_here      = false; // current on the render thread
+        bool                    stopping          = false;
+        std::exception_ptr      error{}; // first exception of a replay, rethrown on the main thread
+        FrameTimeHistory        frame_times;
+
+        std::thread thread;
+    };
+
+    // takes the GL context for the scope when the render thread is running, does nothing otherwise
+    class GLContextScope
+    {
+    public:
+        explicit GLContextScope(RenderThread& the_render_thread);
+        ~GLContextScope();
+
+        GLContextScope(const GLContextScope&)            = delete;
+        GLContextScope& operator=(const GLContextScope&) = delete;
+
+    private:
+        RenderThread* render_thread;
+    };
+}
@@ -0,0 +1,219 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "SDFFont.h"
+
+#include "BakedAsset.h"
+#include "CS200/IRenderer2D.h"
+#include "CS200/Image.h"
+#include "Engine.h"
+#include "Logger.h"
+#include "OpenGL/Texture.h"
+#include "Path.h"
+#include "RenderThread.h"
+#include "TextureManager.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+    constexpr int AtlasWidth = 512;
+
+    // one unit edge between a covered and an empty font pixel, axis aligned
+    struct Edge
+    {
+        float x;
+        float y;
+        bool  vertical;
+    };
+
+    float squared_distance(const Edge& edge, float px, float py)
+    {
+        const float along  = edge.vertical ? py - edge.y : px - edge.x;
+        const float across = edge.vertical ? px - edge.x : py - edge.y;
+        const float beyond = std::max({ -along, 0.0f, along - 1.0f });
+        return across * across + beyond * beyond;
+    }
+}
+
+namespace CS230
+{
+    SDFFont::SDFFont(const std::filesystem::path& font_image)
+    {
+        const auto sdf_path = baked::FindBakedSDFFont(assets::locate_asset(font_image));
+        if (!sdf_path)
+        {
+            throw std::runtime_error("No distance field atlas for " + font_image.generic_string() + ", run asset_baker on it");
+        }
+        const assets::AssetData                 file = assets::read_asset(*sdf_path);
+        const std::optional<baked::SDFFontView> view = baked::ReadSDFFont(file.bytes);
+        if (!view || view->glyphs.size() != glyphs.size())
+        {
+            throw std::runtime_error(sdf_path->generic_string() + " is not a valid distance field atlas");
+        }
+
+        // rows are stored bottom to top, exactly the order the texture wants them in
+        const Math::ivec2        atlas_size{ static_cast<int>(view->record.atlas_width), static_cast<int>(view->record.atlas_height) };
+        std::vector<CS200::RGBA> texels(view->distances.size());
+        std::transform(view->distances.begin(), view->distances.end(), texels.begin(), [](uint8_t distance) { return distance * 0x01010101u; });
+        {
+            const GLContextScope gl_context(Engine::GetRenderThread());
+            const OpenGL::TextureHandle handle = OpenGL::CreateTextureFromMemory(atlas_size, texels, OpenGL::Filtering::Linear, OpenGL::Wrapping::ClampToEdge);
+            atlas.reset(new Texture(handle, atlas_size));
+        }
+
+        const double width  = atlas_size.x;
+        const double height = atlas_size.y;
+        for (size_t i = 0; i < glyphs.size(); ++i)
+        {
+            const baked::SDFGlyph& box = view->glyphs[i];
+            glyphs[i].texture_coord_bl = { box.left / width, box.bottom / height };
+            glyphs[i].texture_coord_tr = { (box.left + box.width) / width, (box.bottom + box.height) / height };
+            glyphs[i].size             = { static_cast<double>(box.width), static_cast<double>(box.height) };
+            glyphs[i].advance          = box.advance;
+        }
+        padding     = view->record.padding;
+        line_height = view->record.line_height;
+    }
+
+    std::vector<std::byte> SDFFont::Bake(const CS200::Image& image)
+    {
+        const auto        rects      = Font::ScanCharRects(image);
+        const Math::ivec2 image_size = image.GetSize();
+
+        // shelf packing, glyph boxes left to right and shelves bottom to top with one empty texel between boxes
+        std::vector<baked::SDFGlyph> boxes;
+        boxes.reserve(rects.size());
+        int pen_x        = 0;
+        int shelf_bottom = 0;
+        int shelf_height = 0;
+        int line_height  = 0;
+        for (const Math::irect& rect : rects)
+        {
+            const Math::ivec2 glyph_size = rect.Size();
+            const int         box_width  = glyph_size.x + 2 * Padding;
+            const int         box_height = glyph_size.y + 2 * Padding;
+            if (box_width > AtlasWidth)
+            {
+                throw std::runtime_error("Font glyph wider than the distance field atlas");
+            }
+            if (pen_x + box_width > AtlasWidth)
+            {
+                shelf_bottom += shelf_height + 1;
+                pen_x        = 0;
+                shelf_height = 0;
+            }
+            boxes.push_back({ pen_x, shelf_bottom, box_width, box_height, glyph_size.x });
+            pen_x += box_width + 1;
+            shelf_height = std::max(shelf_height, box_height);
+            line_height  = std::max(line_height, glyph_size.y);
+        }
+        const int atlas_height = shelf_bottom + shelf_height;
+
+        std::vector<uint8_t> distances(static_cast<size_t>(AtlasWidth * atlas_height), 1); // -Spread, what every clamped outside texel holds
+        std::vector<uint8_t> coverage;
+        std::vector<Edge>    edges;
+        for (size_t i = 0; i < rects.size(); ++i)
+        {
+            const Math::irect& rect  = rects[i];
+            const int          width = rect.Size().x;
+            const int          rows  = rect.Size().y;
+
+            // glyph pixels with y going up, row 0 is the bottom row of the glyph in the image
+            coverage.assign(static_cast<size_t>(width * rows), 0);
+            for (int y = 0; y < rows; ++y)
+            {
+                const int image_y = rect.Bottom() + (rows - 1 - y);
+                for (int x = 0; x < width; ++x)
+                {
+                    const CS200::RGBA pixel                      = image.data()[rect.Left() + x + image_y * image_size.x];
+                    coverage[static_cast<size_t>(x + y * width)] = (CS200::rgba_to_abgr(pixel) & 0xFF) >= 0x80 ? 1 : 0;
+                }
+            }
+            const auto covered = [&](int x, int y) { return x >= 0 && y >= 0 && x < width && y < rows && coverage[static_cast<size_t>(x + y * width)] != 0; };
+
+            edges.clear();
+            for (int y = 0; y <= rows; ++y)
+            {
+                for (int x = 0; x <= width; ++x)
+                {
+                    if (y < rows && covered(x - 1, y) != covered(x, y))
+                    {
+                        edges.push_back({ static_cast<float>(x), static_cast<float>(y), true });
+                    }
+                    if (x < width && covered(x, y - 1) != covered(x, y))
+                    {
+                        edges.push_back({ static_cast<float>(x), static_cast<float>(y), false });
+                    }
+                }
+            }
+
+            const baked::SDFGlyph& box = boxes[i];
+            for (int ty = 0; ty < box.height; ++ty)
+            {
+                for (int tx = 0; tx < box.width; ++tx)
+                {
+                    // texel center in glyph pixels, nothing further than Spread matters after clamping
+                    const float px      = static_cast<float>(tx - Padding) + 0.5f;
+                    const float py      = static_cast<float>(ty - Padding) + 0.5f;
+                    float       closest = Spread * Spread;
+                    for (const Edge& edge : edges)
+                    {
+                        closest = std::min(closest, squared_distance(edge, px, py));
+                    }
+                    const float distance = covered(tx - Padding, ty - Padding) ? std::sqrt(closest) : -std::sqrt(closest);
+                    const float encoded  = std::clamp(std::round(128.0f + 127.0f * distance / Spread), 0.0f, 255.0f);
+                    distances[static_cast<size_t>((box.bottom + ty) * AtlasWidth + box.left + tx)] = static_cast<uint8_t>(encoded);
+                }
+            }
+        }
+
+        const baked::SDFFontRecord record{ AtlasWidth, static_cast<uint32_t>(atlas_height), static_cast<uint32_t>(boxes.size()), line_height, Padding, Spread };
+        return baked::WriteSDFFont(record, boxes, distances);
+    }
+
+    void SDFFont::DrawText(const Math::TransformationMatrix& transform, std::string_view text, const SDFTextStyle& style, float depth) const
+    {
+        CS200::IRenderer2D* renderer = Engine::GetTextureManager().GetRenderer2D();
+        int                 pen_x    = 0;
+        for (const char c : text)
+        {
+            const Glyph& glyph = glyph_for(c);
+            if (c != ' ')
+            {
+                // the quad includes the padding around the glyph box, that is where outlines and glows are drawn
+                const Math::vec2 center{ pen_x - padding + glyph.size.x * 0.5, -padding + glyph.size.y * 0.5 };
+                renderer->DrawSDFGlyph(
+                    transform * Math::TranslationMatrix(center) * Math::ScaleMatrix(glyph.size), atlas->textureHandle, glyph.texture_coord_bl, glyph.texture_coord_tr, style.fill_color,
+                    style.line_color, style.outline_width, style.glow_width, depth);
+            }
+            pen_x += glyph.advance;
+        }
+    }
+
+    Math::ivec2 SDFFont::MeasureText(std::string_view text) const
+    {
+        int width = 0;
+        for (const char c : text)
+        {
+            width += glyph_for(c).advance;
+        }
+        return { width, line_height };
+    }
+
+    const SDFFont::Glyph& SDFFont::glyph_for(char c) const
+    {
+        if (c >= ' ' && c <= 'z')
+        {
+            return glyphs[static_cast<size_t>(c - ' ')];
+        }
+        LOG_ERROR("Char '{}' not found", static_cast<int>(c));
+        return glyphs[0];
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "Font.h"
+#include "Matrix.h"
+#include "Texture.h"
+#include "Vec2.h"
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace CS200
+{
+    class Image;
+}
+
+namespace CS230
+{
+    struct SDFTextStyle
+    {
+        CS200::RGBA fill_color    = CS200::WHITE;
+        CS200::RGBA line_color    = CS200::BLACK;
+        double      outline_width = 0.0; // atlas spread units, 1.0 is SDFFont::Spread texels of the source font
+        double      glow_width    = 0.0; // soft falloff beyond the outline, same units
+    };
+
+    /**
+     * \brief Distance field version of a bitmap font, drawn through the renderer's SDF path
+     *
+     * The atlas is baked offline by asset_baker from the same font image a Font reads
+     * (Font_Simple.png -> Font_Simple.sdff). Every texel holds the signed distance to the
+     * nearest glyph edge, so the renderer can place a sharp edge at any scale and add an
+     * outline or a glow around it from the same texture; one atlas replaces both
+     * Font_Simple.png and Font_Outlined.png. The atlases of the shipped fonts are checked in
+     * next to the images, rerun asset_baker on Assets/fonts after editing a font image.
+     *
+     * Glyph quads go through IRenderer2D::DrawSDFGlyph and join the batch of circles and
+     * rectangles, a whole screen of text is part of the same SDF draw call.
+     */
+    class SDFFont
+    {
+    public:
+        static constexpr int   Padding = 6;    // texels around every glyph, the widest outline plus glow
+        static constexpr float Spread  = 6.0f; // distance in texels stored at the ends of the 0..255 range
+
+        /**
+         * \brief Load the distance field atlas baked for a font image
+         * \param font_image The bitmap font the atlas was baked from, its .sdff sibling is read
+         *
+         * Throws when there is no .sdff or it is not a valid baked atlas.
+         */
+        explicit SDFFont(const std::filesystem::path& font_image);
+
+        /**
+         * \brief Bake the distance field atlas of a bitmap font image (asset_baker)
+         * \param image Font image loaded without a vertical flip, same format Font expects
+         * \return Contents of the .sdff file
+         *
+         * Glyph coverage is the image alpha; each atlas texel stores the exact distance to the
+         * nearest edge of the covered pixels, one texel per font pixel.
+         */
+        static std::vector<std::byte> Bake(const CS200::Image& image);
+
+        /**
+         * \brief Draw text into the current renderer scene
+         * \param transform Placement of the text, its origin is the bottom-left of the first character
+         * \param text String of text to draw using this font
+         * \param style Fill, outline and glow of the text
+         * \param depth Depth of every glyph quad
+         */
+        void DrawText(const Math::TransformationMatrix& transform, std::string_view text, const SDFTextStyle& style = {}, float depth = 0.6f) const;
+
+        Math::ivec2 MeasureText(std::string_view text) const;
+
+    private:
+        struct Glyph
+        {
+            Math::vec2 texture_coord_bl{};
+            Math::vec2 texture_coord_tr{};
+            Math::vec2 size{}; // quad size in font pixels, padding included
+            int        advance = 0;
+        };
+
+        const Glyph& glyph_for(char c) const;
+
+        std::unique_ptr<Texture>           atlas;
+        std::array<Glyph, Font::num_chars> glyphs{};
+        int                                padding     = 0;
+        int                                line_height = 0;
+    };
+}
@@ -0,0 +1,150 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  SpatialGrid.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    bool overlaps(const Math::rect& a, const Math::rect& b)
+    {
+        return a.Left() <= b.Right() && b.Left() <= a.Right() && a.Bottom() <= b.Top() && b.Bottom() <= a.Top();
+    }
+
+    // keeps cell coordinates in 32 bits so they pack into one key, anything this far out shares the edge cells
+    constexpr double CellLimit = 1'000'000'000.0;
+}
+
+namespace CS230
+{
+    int64_t SpatialGrid::cell_coordinate(double value) const
+    {
+        return static_cast<int64_t>(std::clamp(std::floor(value / cell_size), -CellLimit, CellLimit));
+    }
+
+    uint64_t SpatialGrid::cell_key(int64_t x, int64_t y) const
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    void SpatialGrid::Build(std::span<const Math::rect> bounds)
+    {
+        entries.clear();
+        oversized.clear();
+        pairs.clear();
+        if (bounds.size() < 2)
+        {
+            return;
+        }
+
+        cell_size = fixed_cell_size;
+        if (cell_size <= 0.0)
+        {
+            // twice the average extent: a typical box covers one to four cells
+            double extent = 0.0;
+            for (const Math::rect& box : bounds)
+            {
+                const Math::vec2 size = box.Size();
+                extent += std::max(size.x, size.y);
+            }
+            cell_size = std::max(1.0, 2.0 * extent / static_cast<double>(bounds.size()));
+        }
+
+        for (uint32_t i = 0; i < bounds.size(); ++i)
+        {
+            const Math::rect& box    = bounds[i];
+            const int64_t     left   = cell_coordinate(box.Left());
+            const int64_t     right  = cell_coordinate(box.Right());
+            const int64_t     bottom = cell_coordinate(box.Bottom());
+            const int64_t     top    = cell_coordinate(box.Top());
+            if ((right - left + 1) * (top - bottom + 1) > MaxCellsPerBox)
+            {
+                oversized.push_back(i);
+                continue;
+            }
+            for (int64_t y = bottom; y <= top; ++y)
+            {
+                for (int64_t x = left; x <= right; ++x)
+                {
+                    entries.push_back(Entry{ cell_key(x, y), i });
+                }
+            }
+        }
+
+        // counting sort into hash buckets, two linear passes instead of a comparison sort
+        size_t bucket_count = 64;
+        while (bucket_count < entries.size() * 2)
+        {
+            bucket_count *= 2;
+        }
+        const uint64_t bucket_mask = bucket_count - 1;
+        const auto     bucket_of   = [bucket_mask](uint64_t cell) { return static_cast<size_t>((cell * 0x9E3779B97F4A7C15ull) >> 32 & bucket_mask); };
+
+        bucket_starts.assign(bucket_count + 1, 0);
+        for (const Entry& entry : entries)
+        {
+            ++bucket_starts[bucket_of(entry.cell) + 1];
+        }
+        for (size_t i = 1; i <= bucket_count; ++i)
+        {
+            bucket_starts[i] += bucket_starts[i - 1];
+        }
+        sorted.resize(entries.size());
+        bucket_fill.assign(bucket_starts.begin(), bucket_starts.end() - 1);
+        for (const Entry& entry : entries)
+        {
+            sorted[bucket_fill[bucket_of(entry.cell)]++] = entry;
+        }
+
+        for (size_t bucket = 0; bucket < bucket_count; ++bucket)
+        {
+            const uint32_t run_begin = bucket_starts[bucket];
+            const uint32_t run_end   = bucket_starts[bucket + 1];
+            for (uint32_t i = run_begin; i < run_end; ++i)
+            {
+                const Math::rect& a = bounds[sorted[i].box];
+                for (uint32_t j = i + 1; j < run_end; ++j)
+                {
+                    // different cells can hash to the same bucket
+                    if (sorted[j].cell != sorted[i].cell || !overlaps(a, bounds[sorted[j].box]))
+                    {
+                        continue;
+                    }
+                    // only the cell that owns the overlap's bottom left corner reports the pair
+                    const Math::rect& b     = bounds[sorted[j].box];
+                    const uint64_t    owner = cell_key(cell_coordinate(std::max(a.Left(), b.Left())), cell_coordinate(std::max(a.Bottom(), b.Bottom())));
+                    if (owner == sorted[i].cell)
+                    {
+                        pairs.push_back({ std::min(sorted[i].box, sorted[j].box), std::max(sorted[i].box, sorted[j].box) });
+                    }
+                }
+            }
+        }
+
+        // few and large (level bounds, triggers), brute force against everything else
+        for (size_t i = 0; i < oversized.size(); ++i)
+        {
+            const uint32_t big = oversized[i];
+            for (uint32_t other = 0; other < bounds.size(); ++other)
+            {
+                const bool other_oversized = std::binary_search(oversized.begin(), oversized.end(), other);
+                if (other == big || (other_oversized && other < big) || !overlaps(bounds[big], bounds[other]))
+                {
+                    continue;
+                }
+                pairs.push_back({ std::min(big, other), std::max(big, other) });
+            }
+        }
+
+        // same order the old nested loop visited pairs in
+        std::sort(pairs.begin(), pairs.end());
+    }
+}
@@ -0,0 +1,61 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  SpatialGrid.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "Rect.h"
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace CS230
+{
+    // Collision broadphase: a uniform grid stored as a spatial hash, rebuilt from scratch every frame.
+    // Every box is written once per cell it covers as a (cell key, box) entry, the entries are counting sorted into
+    // hash buckets, and boxes sharing a cell become candidates. A pair that shares several cells is only reported from the cell
+    // holding the bottom left corner of the two boxes' overlap, so every pair comes out exactly once.
+    class SpatialGrid
+    {
+    public:
+        using Pair = std::pair<uint32_t, uint32_t>; // indices into the bounds given to Build, first < second
+
+        // 0 picks a cell size from the average box size on every Build
+        void   SetCellSize(double size) { fixed_cell_size = size; }
+        double CellSize() const { return cell_size; }
+
+        // fills Pairs() with every pair of overlapping boxes (touching counts), sorted
+        void Build(std::span<const Math::rect> bounds);
+
+        const std::vector<Pair>& Pairs() const { return pairs; }
+
+    private:
+        struct Entry
+        {
+            uint64_t cell;
+            uint32_t box;
+        };
+
+        // boxes covering more cells than this skip the grid and are tested against everything
+        static constexpr int64_t MaxCellsPerBox = 64;
+
+        int64_t  cell_coordinate(double value) const;
+        uint64_t cell_key(int64_t x, int64_t y) const;
+
+        double                fixed_cell_size = 0.0;
+        double                cell_size       = 1.0;
+        std::vector<Entry>    entries;
+        std::vector<Entry>    sorted;
+        std::vector<uint32_t> bucket_starts;
+        std::vector<uint32_t> bucket_fill;
+        std::vector<uint32_t> oversized;
+        std::vector<Pair>     pairs;
+    };
+}
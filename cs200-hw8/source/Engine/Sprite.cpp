@@ -10,10 +10,8 @@ Created:    March 19, 2025
 
 #include "GameObject.h"
 #include "Sprite.h"
-#include "TextureManager.h"
 #include "Logger.h"
-#include "Path.h"
-#include <fstream>
+#include <utility>
 
 CS230::Sprite::Sprite(const std::filesystem::path& sprite_file, GameObject* _given_object) {
     Load(sprite_file, _given_object);
@@ -21,168 +19,109 @@ CS230::Sprite::Sprite(const std::filesystem::path& sprite_file, GameObject* _giv
 
 CS230::Sprite::~Sprite()
 {
-    for (Animation* animation : animations) {
-        delete animation;
+    if (player != nullptr) {
+        player->Release(playback);
     }
-    animations.clear();
 }
 
 CS230::Sprite::Sprite(Sprite&& temporary) noexcept :
-    texture(std::move(temporary.texture)),
-    hotspots(std::move(temporary.hotspots)),
+    definition(std::move(temporary.definition)),
     current_animation(temporary.current_animation),
-    frame_size(temporary.frame_size),
-    frame_texels(std::move(temporary.frame_texels)),
-    animations(std::move(temporary.animations))
+    player(std::exchange(temporary.player, nullptr)),
+    playback(std::exchange(temporary.playback, AnimationPlayer::InvalidId)),
+    given_object(temporary.given_object)
 {}
 
 CS230::Sprite& CS230::Sprite::operator=(Sprite && temporary) noexcept
 {
-    std::swap(texture, temporary.texture);
-    std::swap(hotspots, temporary.hotspots);
+    std::swap(definition, temporary.definition);
     std::swap(current_animation, temporary.current_animation);
-    std::swap(frame_size, temporary.frame_size);
-    std::swap(frame_texels, frame_texels);
-    std::swap(animations, temporary.animations);
+    std::swap(player, temporary.player);
+    std::swap(playback, temporary.playback);
+    std::swap(given_object, temporary.given_object);
     return *this;
 }
 
-void CS230::Sprite::Update(double dt)
-{
-    animations[current_animation]->Update(dt);
-}
-
 void CS230::Sprite::Load(const std::filesystem::path& sprite_file, GameObject* _given_object)
 {
-    const std::filesystem::path sprite_path = assets::locate_asset(sprite_file);
     given_object = _given_object;
-    animations.clear();
-    if (sprite_path.extension() != ".spt")
-    {
-        throw std::runtime_error(sprite_path.generic_string() + " is not a .spt file");
-    }
-    
-    std::ifstream               in_file(sprite_path);
-
-    if (in_file.is_open() == false) {
-        throw std::runtime_error("Failed to load " + sprite_path.generic_string());
+    definition   = Engine::GetSpriteDefinitionCache().Load(sprite_file);
+    if (playback == AnimationPlayer::InvalidId) {
+        player   = &Engine::GetAnimationPlayer();
+        playback = player->Create();
     }
 
-    hotspots.clear();
-    frame_texels.clear();
-
-    std::string text;
-    in_file >> text;
-    texture = Engine::GetTextureManager().Load(text);
-    frame_size = Engine::GetTextureManager().Load(text)->GetSize();
-
-    in_file >> text;
-    while (in_file.eof() == false) {
-        if (text == "FrameSize") {
-            in_file >> frame_size.x;
-            in_file >> frame_size.y;
-        }
-        
-        else if (text == "NumFrames") {
-            int frame_count;
-            in_file >> frame_count;
-            for (int i = 0; i < frame_count; i++) {
-                frame_texels.push_back({ frame_size.x * i, 0 });
-            }
-        }
-        else if (text == "Frame") {
-            int frame_location_x, frame_location_y;
-            in_file >> frame_location_x;
-            in_file >> frame_location_y;
-            frame_texels.push_back({ frame_location_x, frame_location_y });
-        }
-        else if (text == "HotSpot") {
-            int hotspot_x, hotspot_y;
-            in_file >> hotspot_x;
-            in_file >> hotspot_y;
-            hotspots.push_back({ hotspot_x, hotspot_y });
-        }
-        else if (text == "Anim") {
-            in_file >> text;
-            animations.push_back(new Animation(text));
-        }
-        else if (text == "RectCollision") {
-            Math::irect boundary;
-            in_file >> boundary.point_1.x >> boundary.point_1.y >> boundary.point_2.x >> boundary.point_2.y;
+    switch (definition->collision_shape) {
+        case SpriteDefinition::CollisionShape::None: break;
+        case SpriteDefinition::CollisionShape::Rect:
             if (given_object == nullptr) {
                 Engine::GetLogger().LogError("Cannot add collision to a null object");
             }
             else {
-                given_object->AddGOComponent(new RectCollision(boundary, given_object));
+                given_object->AddGOComponent(new RectCollision(definition->collision_rect, given_object));
             }
-        }
-        else if (text == "CircleCollision") {
-            double radius;
-            in_file >> radius;
+            break;
+        case SpriteDefinition::CollisionShape::Circle:
             if (given_object == nullptr) {
                 Engine::GetLogger().LogError("Cannot add collision to a null object");
             }
             else {
-                given_object->AddGOComponent(new CircleCollision(radius, given_object));
+                given_object->AddGOComponent(new CircleCollision(definition->collision_radius, given_object));
             }
-        }
-        else {
-            Engine::GetLogger().LogError("Unknown command: " + text);
-        }
-        in_file >> text;
-    }
-    if (frame_texels.empty() == true) {
-        frame_texels.push_back({ 0,0 });
+            break;
     }
-
-    if (animations.empty() == true) {
-        animations.push_back(new Animation());
-        PlayAnimation(0);
-    }
-    
-
+    PlayAnimation(0);
 }
 
 void CS230::Sprite::Draw(Math::TransformationMatrix display_matrix, unsigned int color, float depth)
 {
-	texture->Draw(display_matrix * Math::TranslationMatrix(-GetHotSpot(0)), GetFrameTexel(animations[current_animation]->CurrentFrame()), GetFrameSize(), color,depth);
+	Draw(Math::Affine2D(display_matrix), color, depth);
+}
+
+void CS230::Sprite::Draw(const Math::Affine2D& display_matrix, unsigned int color, float depth)
+{
+	definition->texture->Draw(display_matrix * Math::Affine2D::Translation(-GetHotSpot(0)), GetFrameTexel(player->CurrentFrame(playback)), GetFrameSize(), color, depth);
 }
 
 Math::ivec2 CS230::Sprite::GetHotSpot(size_t index)
 {
-	if ( index > hotspots.size()) {
-		Engine::GetLogger().LogDebug("Invalid index in hospot!");
+	if (definition->hotspots.empty()) {
+		// no hotspots means the origin, Draw asks for hotspot 0 of every sprite every frame
+		return Math::ivec2{ 0,0 };
+	}
+	if (index >= definition->hotspots.size()) {
+		LOG_DEBUG("Invalid index {} in hotspot!", index);
 		return Math::ivec2{ 0,0 };
 	}
-	return hotspots[index];
+	return definition->hotspots[index];
 }
 
 Math::ivec2 CS230::Sprite::GetFrameSize()
 {
-    return frame_size;
+    return definition->frame_size;
 }
 
 void CS230::Sprite::PlayAnimation(size_t animation)
 {
-    if (animation >= animations.size()) {
+    if (animation >= definition->animations.size()) {
         Engine::GetLogger().LogDebug("Invalid index in animation!");
         current_animation = 0;
         return;
     }
     current_animation = animation;
-    animations[current_animation]->Reset();
+    player->Play(playback, *definition->animations[current_animation]);
 }
 
 bool CS230::Sprite::AnimationEnded()
 {
-    return animations[current_animation]->Ended();
+    return player->Ended(playback);
 }
 
 Math::ivec2 CS230::Sprite::GetFrameTexel(size_t index) const
 {
-    if ( index >= frame_texels.size()) {
+    if ( index >= definition->frame_texels.size()) {
         Engine::GetLogger().LogDebug("Invalid index in frametexles!");
         return Math::ivec2{ 0,0 };
     }
-    return frame_texels[index];
+    return definition->frame_texels[index];
 }
@@ -17,10 +17,12 @@ Created:    March 19, 2025
 #include "Animation.h"
 #include "Component.h"
 #include "Collision.h"
+#include "SpriteDefinition.h"
 
 
 namespace CS230 {
     class GameObject;
+    // Lightweight instance of a SpriteDefinition: a shared definition pointer and a playback slot.
     class Sprite : public Component {
     public:
         Sprite(const std::filesystem::path& sprite_file,GameObject* given_object);
@@ -31,9 +33,9 @@ namespace CS230 {
 
         Sprite(Sprite&& temporary) noexcept;
         Sprite& operator=(Sprite&& temporary) noexcept;
-        void Update(double dt) override;
         void Load(const std::filesystem::path& sprite_file, GameObject* _given_object);
 		void		Draw(Math::TransformationMatrix display_matrix, unsigned int color = 0xFFFFFFFF, float depth = 0.5f);
+		void		Draw(const Math::Affine2D& display_matrix, unsigned int color = 0xFFFFFFFF, float depth = 0.5f);
         Math::ivec2 GetHotSpot(size_t index);
         Math::ivec2 GetFrameSize();
 
@@ -43,14 +45,12 @@ namespace CS230 {
         const size_t& CurrentAnimation() const { return current_animation; }
     private:
         Math::ivec2 GetFrameTexel(size_t index) const;
-        // Texture* texture;
-        std::shared_ptr<CS230::Texture> texture;
-        std::vector<Math::ivec2> hotspots;
-
-        size_t current_animation;
-        Math::ivec2 frame_size;
-        std::vector<Math::ivec2> frame_texels;
-        std::vector<Animation*> animations;
+
+        // parsed .spt data shared with every other Sprite of the same file, the rest is this instance's playback
+        std::shared_ptr<const SpriteDefinition> definition;
+        size_t                                  current_animation = 0;
+        AnimationPlayer*                        player   = nullptr; // the state's player when the sprite was loaded
+        AnimationPlayer::Id                     playback = AnimationPlayer::InvalidId; // advanced by AnimationPlayer::AdvanceAll
 
         GameObject* given_object;
     };
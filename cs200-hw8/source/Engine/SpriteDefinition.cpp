@@ -0,0 +1,196 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  SpriteDefinition.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "SpriteDefinition.h"
+#include "BakedAsset.h"
+#include "Engine.h"
+#include "Logger.h"
+#include "Path.h"
+#include "Texture.h"
+#include "TextureManager.h"
+
+#include <optional>
+#include <sstream>
+
+namespace CS230
+{
+    SpriteSource SpriteSource::ParseText(const std::filesystem::path& sprite_path, const TextureSizeQuery& texture_size)
+    {
+        if (sprite_path.extension() != ".spt")
+        {
+            throw std::runtime_error(sprite_path.generic_string() + " is not a .spt file");
+        }
+
+        std::istringstream in_file{ std::string(assets::read_asset(sprite_path).text()) };
+
+        SpriteSource sprite;
+        in_file >> sprite.texture_file;
+        sprite.frame_size = texture_size(sprite.texture_file);
+
+        std::string text;
+        while (in_file >> text)
+        {
+            if (text == "FrameSize")
+            {
+                in_file >> sprite.frame_size.x;
+                in_file >> sprite.frame_size.y;
+            }
+            else if (text == "NumFrames")
+            {
+                int frame_count;
+                in_file >> frame_count;
+                for (int i = 0; i < frame_count; i++)
+                {
+                    sprite.frame_texels.push_back({ sprite.frame_size.x * i, 0 });
+                }
+            }
+            else if (text == "Frame")
+            {
+                int frame_location_x, frame_location_y;
+                in_file >> frame_location_x;
+                in_file >> frame_location_y;
+                sprite.frame_texels.push_back({ frame_location_x, frame_location_y });
+            }
+            else if (text == "HotSpot")
+            {
+                int hotspot_x, hotspot_y;
+                in_file >> hotspot_x;
+                in_file >> hotspot_y;
+                sprite.hotspots.push_back({ hotspot_x, hotspot_y });
+            }
+            else if (text == "Anim")
+            {
+                in_file >> text;
+                sprite.animation_files.push_back(text);
+            }
+            else if (text == "RectCollision")
+            {
+                Math::irect boundary;
+                in_file >> boundary.point_1.x >> boundary.point_1.y >> boundary.point_2.x >> boundary.point_2.y;
+                if (sprite.collision_shape == SpriteDefinition::CollisionShape::None)
+                {
+                    sprite.collision_shape = SpriteDefinition::CollisionShape::Rect;
+                    sprite.collision_rect  = boundary;
+                }
+            }
+            else if (text == "CircleCollision")
+            {
+                double radius;
+                in_file >> radius;
+                if (sprite.collision_shape == SpriteDefinition::CollisionShape::None)
+                {
+                    sprite.collision_shape  = SpriteDefinition::CollisionShape::Circle;
+                    sprite.collision_radius = radius;
+                }
+            }
+            else
+            {
+                LOG_ERROR("Unknown command: {}", text);
+            }
+        }
+        return sprite;
+    }
+
+    std::shared_ptr<const SpriteDefinition> SpriteDefinitionCache::Load(const std::filesystem::path& sprite_file)
+    {
+        const std::filesystem::path sprite_path = assets::locate_asset(sprite_file);
+        auto                        found       = sprites.find(sprite_path);
+        if (found == sprites.end())
+        {
+            found = sprites.emplace(sprite_path, build_definition(sprite_path)).first;
+        }
+        return found->second;
+    }
+
+    std::shared_ptr<const AnimationData> SpriteDefinitionCache::LoadAnimation(const std::filesystem::path& animation_file)
+    {
+        const std::filesystem::path animation_path = assets::locate_asset(animation_file);
+        auto                        found          = animations.find(animation_path);
+        if (found != animations.end())
+        {
+            return found->second;
+        }
+
+        std::shared_ptr<const AnimationData> animation;
+        if (const auto baked_path = baked::FindBaked(animation_path))
+        {
+            assets::AssetData file   = assets::read_asset(*baked_path);
+            const auto        frames = baked::ReadAnimation(file.bytes);
+            if (!frames.empty())
+            {
+                animation = std::make_shared<const AnimationData>(frames, std::move(file.owner));
+            }
+            else
+            {
+                LOG_ERROR("Ignoring {}, not a valid baked animation", baked_path->generic_string());
+            }
+        }
+        if (animation == nullptr)
+        {
+            animation = std::make_shared<const AnimationData>(animation_path);
+        }
+        return animations.emplace(animation_path, std::move(animation)).first->second;
+    }
+
+    void SpriteDefinitionCache::Unload()
+    {
+        sprites.clear();
+        animations.clear();
+    }
+
+    std::shared_ptr<const SpriteDefinition> SpriteDefinitionCache::build_definition(const std::filesystem::path& sprite_path)
+    {
+        auto definition = std::make_shared<SpriteDefinition>();
+
+        std::optional<SpriteSource> sprite;
+        if (const auto baked_path = baked::FindBaked(sprite_path))
+        {
+            sprite = baked::ReadSprite(assets::read_asset(*baked_path).bytes);
+            if (!sprite)
+            {
+                LOG_ERROR("Ignoring {}, not a valid baked sprite", baked_path->generic_string());
+            }
+        }
+        if (sprite)
+        {
+            definition->texture = Engine::GetTextureManager().Load(sprite->texture_file);
+        }
+        else
+        {
+            sprite = SpriteSource::ParseText(sprite_path,
+                                             [&definition](const std::string& texture_file)
+                                             {
+                                                 definition->texture = Engine::GetTextureManager().Load(texture_file);
+                                                 return definition->texture->GetSize();
+                                             });
+        }
+
+        definition->frame_size       = sprite->frame_size;
+        definition->frame_texels     = std::move(sprite->frame_texels);
+        definition->hotspots         = std::move(sprite->hotspots);
+        definition->collision_shape  = sprite->collision_shape;
+        definition->collision_rect   = sprite->collision_rect;
+        definition->collision_radius = sprite->collision_radius;
+        for (const std::string& animation_file : sprite->animation_files)
+        {
+            definition->animations.push_back(LoadAnimation(animation_file));
+        }
+
+        if (definition->frame_texels.empty() == true)
+        {
+            definition->frame_texels.push_back({ 0, 0 });
+        }
+        if (definition->animations.empty() == true)
+        {
+            definition->animations.push_back(LoadAnimation("./Assets/animations/None.anm"));
+        }
+        LOG_EVENT("Loading Sprite: {}", sprite_path.generic_string());
+        return definition;
+    }
+}
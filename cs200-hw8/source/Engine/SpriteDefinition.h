@@ -0,0 +1,85 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  SpriteDefinition.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#pragma once
+#include "Animation.h"
+#include "Rect.h"
+#include "Vec2.h"
+
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace CS230
+{
+    class Texture;
+
+    // Everything a .spt file describes, parsed once and shared read-only by every Sprite made from it.
+    struct SpriteDefinition
+    {
+        enum class CollisionShape
+        {
+            None,
+            Rect,
+            Circle,
+        };
+
+        std::shared_ptr<Texture>                          texture;
+        Math::ivec2                                       frame_size{};
+        std::vector<Math::ivec2>                          frame_texels;
+        std::vector<Math::ivec2>                          hotspots;
+        std::vector<std::shared_ptr<const AnimationData>> animations; // never empty, falls back to None.anm
+
+        // the Collision component a Sprite adds to its object, only the first collision line counts
+        CollisionShape collision_shape = CollisionShape::None;
+        Math::irect    collision_rect{};
+        double         collision_radius = 0.0;
+    };
+
+    // What a .spt file says before anything it names is loaded. Read from the text file, or from the .sptb
+    // the asset baker wrote for it, and turned into a SpriteDefinition by SpriteDefinitionCache.
+    struct SpriteSource
+    {
+        std::string                      texture_file;
+        Math::ivec2                      frame_size{};
+        std::vector<Math::ivec2>         frame_texels;
+        std::vector<Math::ivec2>         hotspots;
+        std::vector<std::string>         animation_files;
+        SpriteDefinition::CollisionShape collision_shape = SpriteDefinition::CollisionShape::None;
+        Math::irect                      collision_rect{};
+        double                           collision_radius = 0.0;
+
+        // frame_size defaults to the texture size and NumFrames depends on it, so the parser asks for it
+        using TextureSizeQuery = std::function<Math::ivec2(const std::string& texture_file)>;
+        static SpriteSource ParseText(const std::filesystem::path& sprite_path, const TextureSizeQuery& texture_size);
+    };
+
+    // Parses every .spt and .anm file once. Loads of the same path (after locate_asset) return the same object,
+    // so a pool of 1000 particles shares one definition, one texture and one set of animations.
+    // A baked sibling (Ship.spt -> Ship.sptb, Ship.anm -> Ship.anmb) is used instead of the text file when it is
+    // valid and not older than it; baked animation frames are read straight out of the mapped file.
+    // Like TextureManager it keeps what it loaded until Unload.
+    class SpriteDefinitionCache
+    {
+    public:
+        std::shared_ptr<const SpriteDefinition> Load(const std::filesystem::path& sprite_file);
+        std::shared_ptr<const AnimationData>    LoadAnimation(const std::filesystem::path& animation_file);
+
+        void Unload();
+
+    private:
+        std::shared_ptr<const SpriteDefinition> build_definition(const std::filesystem::path& sprite_path);
+
+        std::map<std::filesystem::path, std::shared_ptr<const SpriteDefinition>> sprites;
+        std::map<std::filesystem::path, std::shared_ptr<const AnimationData>>    animations;
+    };
+}
@@ -0,0 +1,288 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#include "TextLayout.h"
+
+#include "Engine.h"
+#include "Logger.h"
+#include "TextureManager.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    struct Line
+    {
+        size_t begin;
+        size_t end;
+        int    width;
+    };
+
+    bool in_font(char c)
+    {
+        return c >= ' ' && c <= 'z';
+    }
+}
+
+namespace CS230
+{
+    void KerningTable::Set(char left, char right, int adjustment)
+    {
+        if (!in_font(left) || !in_font(right))
+        {
+            throw std::runtime_error("Kerning pair outside of the font characters");
+        }
+        if (pairs.empty())
+        {
+            pairs.assign(static_cast<size_t>(Font::num_chars * Font::num_chars), 0);
+        }
+        const int clamped = std::clamp(adjustment, static_cast<int>(std::numeric_limits<int8_t>::min()), static_cast<int>(std::numeric_limits<int8_t>::max()));
+        pairs[static_cast<size_t>((left - ' ') * Font::num_chars + (right - ' '))] = static_cast<int8_t>(clamped);
+    }
+
+    int KerningTable::Get(char left, char right) const
+    {
+        if (pairs.empty() || !in_font(left) || !in_font(right))
+        {
+            return 0;
+        }
+        return pairs[static_cast<size_t>((left - ' ') * Font::num_chars + (right - ' '))];
+    }
+
+    void TextRun::Draw(const Math::TransformationMatrix& transform, CS200::RGBA color, float depth) const
+    {
+        if (!quads.empty())
+        {
+            Engine::GetTextureManager().GetRenderer2D()->DrawGlyphQuads(transform, quads, atlas, color, depth);
+        }
+    }
+
+    TextLayout::TextLayout(const Font& the_font) : font(&the_font)
+    {
+    }
+
+    std::shared_ptr<const TextRun> TextLayout::Layout(std::string_view text, const TextLayoutOptions& options)
+    {
+        const RunKeyView key{ text, options, hash_run(text, options) };
+        if (const auto found = runs.find(key); found != runs.end())
+        {
+            CachedRun& entry = found->second;
+            if (&entry != most_recent)
+            {
+                unlink(entry);
+                link_front(entry);
+            }
+            return entry.run;
+        }
+
+        std::shared_ptr<const TextRun> run      = build(text, options);
+        const auto                     inserted = runs.try_emplace(RunKey{ std::string(text), options, key.hash }).first;
+        CachedRun&                     entry    = inserted->second;
+        entry.run                               = run;
+        entry.bytes                             = run->quads.size() * sizeof(CS200::GlyphQuad) + text.size();
+        entry.key                               = &inserted->first;
+        link_front(entry);
+        cached_bytes += entry.bytes;
+        evict_to_budget();
+        return run;
+    }
+
+    void TextLayout::SetKerning(KerningTable table)
+    {
+        kerning = std::move(table);
+        runs.clear();
+        most_recent = least_recent = nullptr;
+        cached_bytes               = 0;
+    }
+
+    void TextLayout::SetCacheBudget(size_t bytes)
+    {
+        cache_budget = bytes;
+        evict_to_budget();
+    }
+
+    void TextLayout::unlink(CachedRun& entry)
+    {
+        (entry.newer != nullptr ? entry.newer->older : most_recent)  = entry.older;
+        (entry.older != nullptr ? entry.older->newer : least_recent) = entry.newer;
+        entry.newer                                                  = nullptr;
+        entry.older                                                  = nullptr;
+    }
+
+    void TextLayout::link_front(CachedRun& entry)
+    {
+        entry.older = most_recent;
+        if (most_recent != nullptr)
+        {
+            most_recent->newer = &entry;
+        }
+        else
+        {
+            least_recent = &entry;
+        }
+        most_recent = &entry;
+    }
+
+    void TextLayout::evict_to_budget()
+    {
+        // the newest run stays even if it alone is over budget, it is about to be drawn
+        while (cached_bytes > cache_budget && least_recent != nullptr && least_recent != most_recent)
+        {
+            CachedRun& victim = *least_recent;
+            unlink(victim);
+            cached_bytes -= victim.bytes;
+            runs.erase(runs.find(*victim.key));
+        }
+    }
+
+    size_t TextLayout::hash_run(std::string_view text, const TextLayoutOptions& options)
+    {
+        size_t hash = std::hash<std::string_view>{}(text);
+        for (const int value : { options.max_width, static_cast<int>(options.align), options.line_spacing })
+        {
+            hash ^= std::hash<int>{}(value) + 0x9e3779b9u + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+
+    std::shared_ptr<TextRun> TextLayout::build(std::string_view text, const TextLayoutOptions& options) const
+    {
+        const auto measure = [&](size_t begin, size_t end)
+        {
+            int width = 0;
+            for (size_t i = begin; i < end; ++i)
+            {
+                width += advance(text[i], i + 1 < end ? text[i + 1] : '\0');
+            }
+            return width;
+        };
+        const auto trim = [&](size_t begin, size_t end)
+        {
+            while (end > begin && text[end - 1] == ' ')
+            {
+                --end;
+            }
+            return end;
+        };
+
+        // greedy line breaking, one paragraph per '\n'
+        std::vector<Line> lines;
+        size_t            paragraph_begin = 0;
+        while (paragraph_begin <= text.size())
+        {
+            const size_t paragraph_end = std::min(text.find('\n', paragraph_begin), text.size());
+            size_t       line_begin    = paragraph_begin;
+            size_t       word_begin    = paragraph_begin;
+            bool         line_has_word = false;
+            while (true)
+            {
+                const size_t word_end = std::min(text.find(' ', word_begin), paragraph_end);
+                if (options.max_width > 0 && word_end > word_begin && measure(line_begin, word_end) > options.max_width)
+                {
+                    if (line_has_word)
+                    {
+                        const size_t end = trim(line_begin, word_begin);
+                        lines.push_back({ line_begin, end, measure(line_begin, end) });
+                        line_begin    = word_begin;
+                        line_has_word = false;
+                        continue;
+                    }
+                    // a word wider than the line on its own, at least one character per line
+                    size_t split = word_begin + 1;
+                    while (split < word_end && measure(line_begin, split + 1) <= options.max_width)
+                    {
+                        ++split;
+                    }
+                    lines.push_back({ line_begin, split, measure(line_begin, split) });
+                    line_begin = word_begin = split;
+                    continue;
+                }
+
+                line_has_word = line_has_word || word_end > word_begin;
+                word_begin    = word_end;
+                while (word_begin < paragraph_end && text[word_begin] == ' ')
+                {
+                    ++word_begin;
+                }
+                if (word_begin == paragraph_end)
+                {
+                    lines.push_back({ line_begin, paragraph_end, measure(line_begin, paragraph_end) });
+                    break;
+                }
+            }
+            paragraph_begin = paragraph_end + 1;
+        }
+
+        int line_height = 0;
+        for (const Math::irect& rect : font->char_rects)
+        {
+            line_height = std::max(line_height, rect.Size().y);
+        }
+        int widest = 0;
+        for (const Line& line : lines)
+        {
+            widest = std::max(widest, line.width);
+        }
+        const int box_width = options.max_width > 0 ? std::max(options.max_width, widest) : widest;
+
+        auto run        = std::make_shared<TextRun>();
+        run->atlas      = font->texture.GetHandle();
+        run->line_count = static_cast<int>(lines.size());
+        run->quads.reserve(text.size());
+
+        const Math::ivec2 atlas_size = font->texture.GetSize();
+        const float       atlas_w    = static_cast<float>(atlas_size.x);
+        const float       atlas_h    = static_cast<float>(atlas_size.y);
+        const int         line_step  = line_height + options.line_spacing;
+        int               min_x      = std::numeric_limits<int>::max();
+        int               max_x      = std::numeric_limits<int>::min();
+        for (size_t l = 0; l < lines.size(); ++l)
+        {
+            const Line& line = lines[l];
+            const int   slack  = box_width - line.width;
+            int         pen_x  = options.align == TextAlign::Left ? 0 : (options.align == TextAlign::Center ? slack / 2 : slack);
+            const int   line_y = -static_cast<int>(l) * line_step;
+            min_x              = std::min(min_x, pen_x);
+            max_x              = std::max(max_x, pen_x + line.width);
+            for (size_t i = line.begin; i < line.end; ++i)
+            {
+                const char         c    = text[i];
+                const Math::irect& rect = glyph_rect(c);
+                if (c != ' ')
+                {
+                    // image rows run top to bottom, the texture's v runs bottom to top
+                    const Math::ivec2 size = rect.Size();
+                    run->quads.push_back(
+                        { static_cast<float>(pen_x), static_cast<float>(line_y), static_cast<float>(pen_x + size.x), static_cast<float>(line_y + size.y),
+                          static_cast<float>(rect.Left()) / atlas_w, 1.0f - static_cast<float>(rect.Top()) / atlas_h, static_cast<float>(rect.Right()) / atlas_w,
+                          1.0f - static_cast<float>(rect.Bottom()) / atlas_h });
+                }
+                pen_x += advance(c, i + 1 < line.end ? text[i + 1] : '\0');
+            }
+        }
+        run->bounds = { { min_x, -static_cast<int>(lines.size() - 1) * line_step }, { max_x, line_height } };
+        return run;
+    }
+
+    const Math::irect& TextLayout::glyph_rect(char c) const
+    {
+        if (in_font(c))
+        {
+            return font->char_rects[static_cast<size_t>(c - ' ')];
+        }
+        LOG_ERROR("Char '{}' not found", static_cast<int>(c));
+        return font->char_rects[0];
+    }
+
+    int TextLayout::advance(char c, char next) const
+    {
+        return glyph_rect(c).Size().x + kerning.Get(c, next);
+    }
+}
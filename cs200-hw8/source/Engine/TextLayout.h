@@ -0,0 +1,185 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ */
+
+#pragma once
+#include "CS200/IRenderer2D.h"
+#include "Font.h"
+#include "Matrix.h"
+#include "Rect.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CS230
+{
+    enum class TextAlign
+    {
+        Left,
+        Center,
+        Right
+    };
+
+    struct TextLayoutOptions
+    {
+        int       max_width    = 0; // font pixels, lines wrap at spaces to stay inside it, 0 never wraps
+        TextAlign align        = TextAlign::Left;
+        int       line_spacing = 0; // font pixels added between lines
+
+        bool operator==(const TextLayoutOptions&) const = default;
+    };
+
+    /**
+     * \brief Extra advance for pairs of characters, in font pixels
+     *
+     * Bitmap font images carry no kerning, so a table starts empty and is filled by
+     * whoever knows the font (AV, To, ...). The adjustment is added to the advance of the
+     * left character when it is followed by the right one; negative pulls them together.
+     */
+    class KerningTable
+    {
+    public:
+        void Set(char left, char right, int adjustment);
+        int  Get(char left, char right) const;
+        bool Empty() const { return pairs.empty(); }
+
+    private:
+        std::vector<int8_t> pairs{}; // Font::num_chars squared once the first pair is set
+    };
+
+    /**
+     * \brief Immutable result of laying out one string with one font
+     *
+     * The run space has its origin at the bottom-left of the first line, like a PrintToTexture texture;
+     * later lines go down from there. A run is built once by TextLayout and drawn every frame
+     * with a single DrawGlyphQuads call, so batching renderers take the whole text as one
+     * contiguous block of vertices.
+     */
+    class TextRun
+    {
+    public:
+        std::span<const CS200::GlyphQuad> Quads() const { return quads; }
+
+        // covers every line, including spaces and the full line height
+        Math::irect Bounds() const { return bounds; }
+
+        int LineCount() const { return line_count; }
+
+        void Draw(const Math::TransformationMatrix& transform, CS200::RGBA color = CS200::WHITE, float depth = 0.6f) const;
+
+    private:
+        friend class TextLayout;
+
+        std::vector<CS200::GlyphQuad> quads{};
+        Math::irect                   bounds{};
+        int                           line_count = 0;
+        OpenGL::TextureHandle         atlas{};
+    };
+
+    /**
+     * \brief Lays out text for one font and keeps the runs it made
+     *
+     * Layout returns the cached run when the same text was laid out with the same options
+     * before, so UI text that does not change is measured and wrapped once. Runs only go
+     * stale when their inputs do: new text or options are a different cache entry, and
+     * SetKerning drops every run. The cache is least recently used first under a byte budget
+     * (glyph quads plus the key text), the same scheme as Font::PrintToTexture: a hit relinks
+     * one entry, a miss evicts from the back until it fits, so text that changes every frame
+     * costs one build and at most a few O(1) evictions. An evicted run stays alive for as long
+     * as a caller still holds it.
+     *
+     * Line breaks:
+     * - '\n' always starts a new line
+     * - with a max_width, lines break at the last space that keeps them inside it; a word
+     *   wider than max_width on its own is broken between characters
+     * - spaces at the end of a wrapped line are not counted for alignment
+     */
+    class TextLayout
+    {
+    public:
+        static constexpr size_t DefaultCacheBudget = 256 * 1024;
+
+        explicit TextLayout(const Font& font);
+
+        std::shared_ptr<const TextRun> Layout(std::string_view text, const TextLayoutOptions& options = {});
+
+        void                SetKerning(KerningTable table);
+        const KerningTable& GetKerning() const { return kerning; }
+
+        void   SetCacheBudget(size_t bytes);
+        size_t CachedRunCount() const { return runs.size(); }
+        size_t CachedBytes() const { return cached_bytes; }
+
+    private:
+        struct RunKey
+        {
+            std::string       text;
+            TextLayoutOptions options;
+            size_t            hash;
+        };
+
+        struct RunKeyView
+        {
+            std::string_view  text;
+            TextLayoutOptions options;
+            size_t            hash;
+        };
+
+        struct RunKeyHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(const RunKey& key) const { return key.hash; }
+
+            size_t operator()(const RunKeyView& key) const { return key.hash; }
+        };
+
+        struct RunKeyEqual
+        {
+            using is_transparent = void;
+
+            template <typename A, typename B>
+            bool operator()(const A& a, const B& b) const
+            {
+                return a.hash == b.hash && a.options == b.options && std::string_view(a.text) == std::string_view(b.text);
+            }
+        };
+
+        // map nodes never move, so the list links point straight at them
+        struct CachedRun
+        {
+            std::shared_ptr<const TextRun> run{};
+            size_t                         bytes = 0;
+            const RunKey*                  key   = nullptr;
+            CachedRun*                     newer = nullptr;
+            CachedRun*                     older = nullptr;
+        };
+
+        static size_t hash_run(std::string_view text, const TextLayoutOptions& options);
+
+        void unlink(CachedRun& entry);
+        void link_front(CachedRun& entry);
+        void evict_to_budget();
+
+        std::shared_ptr<TextRun> build(std::string_view text, const TextLayoutOptions& options) const;
+        const Math::irect&       glyph_rect(char c) const;
+        int                      advance(char c, char next) const;
+
+        const Font*                                                    font;
+        KerningTable                                                   kerning{};
+        std::unordered_map<RunKey, CachedRun, RunKeyHash, RunKeyEqual> runs{};
+        CachedRun*                                                     most_recent  = nullptr;
+        CachedRun*                                                     least_recent = nullptr;
+        size_t                                                         cache_budget = DefaultCacheBudget;
+        size_t                                                         cached_bytes = 0;
+    };
+}
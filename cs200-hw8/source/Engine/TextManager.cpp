@@ -1,7 +1,24 @@
 #include "TextManager.h"
+#include "BakedAsset.h"
+#include "Path.h"
 
 
 void TextManager::DrawText(const std::string& text, const Math::vec2& position, Fonts font, const Math::vec2& scale, CS200::RGBA color) const
+{
+    DrawTextRun(*LayoutText(text, font), position, scale, color);
+}
+
+std::shared_ptr<const CS230::TextRun> TextManager::LayoutText(const std::string& text, Fonts font, const CS230::TextLayoutOptions& options) const
+{
+    return layouts[font]->Layout(text, options);
+}
+
+void TextManager::DrawTextRun(const CS230::TextRun& run, const Math::vec2& position, const Math::vec2& scale, CS200::RGBA color) const
+{
+    run.Draw(Math::TranslationMatrix(position) * Math::ScaleMatrix(scale), color);
+}
+
+void TextManager::DrawStaticText(const std::string& text, const Math::vec2& position, Fonts font, const Math::vec2& scale, CS200::RGBA color) const
 {
     if (auto text_texture = fonts[font]->PrintToTexture(text, color); text_texture)
     {
@@ -10,7 +27,16 @@ void TextManager::DrawText(const std::string& text, const Math::vec2& position,
     }
 }
 
-
+void TextManager::DrawSDFText(const std::string& text, const Math::vec2& position, Fonts font, const Math::vec2& scale, const CS230::SDFTextStyle& style) const
+{
+    if (sdf_fonts[font] == nullptr)
+    {
+        DrawText(text, position, font, scale, style.fill_color);
+        return;
+    }
+    const auto transform = Math::TranslationMatrix(position) * Math::ScaleMatrix(scale);
+    sdf_fonts[font]->DrawText(transform, text, style);
+}
 
 void TextManager::Init()
 {
@@ -21,4 +47,8 @@ void TextManager::Init()
 void TextManager::add_font(const std::filesystem::path& file_name)
 {
     fonts.push_back(std::make_unique<CS230::Font>(file_name));
+    layouts.push_back(std::make_unique<CS230::TextLayout>(*fonts.back()));
+    // the atlas is optional, asset_baker writes it next to the font image
+    const bool has_sdf = CS230::baked::FindBakedSDFFont(assets::locate_asset(file_name)).has_value();
+    sdf_fonts.push_back(has_sdf ? std::make_unique<CS230::SDFFont>(file_name) : nullptr);
 }
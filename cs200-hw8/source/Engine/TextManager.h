@@ -7,6 +7,8 @@
  */
 #include "Font.h"
 #include "Fonts.h"
+#include "SDFFont.h"
+#include "TextLayout.h"
 #include <memory>
 #include <vector>
 
@@ -15,12 +17,23 @@ class TextManager
 public:
     TextManager() = default;
     void Init();
+    // laid out once per distinct string and drawn as one block of glyph quads into the current batch, no GPU allocation
     void DrawText(const std::string& text, const Math::vec2& position, Fonts font, const Math::vec2& scale = { 1.0, 1.0 }, CS200::RGBA color = CS200::WHITE) const;
+    // wrapped and aligned text; keep the run and draw it with DrawTextRun for as long as the text does not change
+    std::shared_ptr<const CS230::TextRun> LayoutText(const std::string& text, Fonts font, const CS230::TextLayoutOptions& options = {}) const;
+    void DrawTextRun(const CS230::TextRun& run, const Math::vec2& position, const Math::vec2& scale = { 1.0, 1.0 }, CS200::RGBA color = CS200::WHITE) const;
+    CS230::TextLayout& GetLayout(Fonts font) { return *layouts[font]; }
+    // renders the string into a cached texture once and draws that; only for text that never changes
+    void DrawStaticText(const std::string& text, const Math::vec2& position, Fonts font, const Math::vec2& scale = { 1.0, 1.0 }, CS200::RGBA color = CS200::WHITE) const;
+    // distance field glyphs, sharp at any scale with the style's outline and glow; plain DrawText when the font has no baked .sdff
+    void DrawSDFText(const std::string& text, const Math::vec2& position, Fonts font, const Math::vec2& scale = { 1.0, 1.0 }, const CS230::SDFTextStyle& style = {}) const;
 
 private:
     // static CS230::Font* get_font(size_t);
 
     void add_font(const std::filesystem::path& file_name);
 
-    std::vector<std::unique_ptr<CS230::Font>> fonts{};
+    std::vector<std::unique_ptr<CS230::Font>>    fonts{};
+    std::vector<std::unique_ptr<CS230::SDFFont>> sdf_fonts{}; // same index as fonts, null when not baked
+    std::vector<std::unique_ptr<CS230::TextLayout>> layouts{};   // same index as fonts, owns the cached runs
 };
\ No newline at end of file
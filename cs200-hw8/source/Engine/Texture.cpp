@@ -15,18 +15,29 @@
 #include "Engine.h"
 #include "Matrix.h"
 #include "OpenGL/GL.h"
+#include "RenderThread.h"
 #include "TextureManager.h"
 #include "Window.h"
 
 namespace CS230
 {
 
-	void Texture::Draw([[maybe_unused]] const Math::TransformationMatrix& display_matrix, unsigned int color, float depth)
+	void Texture::Draw(const Math::TransformationMatrix& display_matrix, unsigned int color, float depth)
 	{
-		Draw(display_matrix, { 0, 0 }, image_size, color, depth);
+		Draw(Math::Affine2D(display_matrix), { 0, 0 }, image_size, color, depth);
 	}
 
 	void Texture::Draw(const Math::TransformationMatrix& display_matrix, Math::ivec2 texel_position, Math::ivec2 frame_size, unsigned int color, float depth)
+	{
+		Draw(Math::Affine2D(display_matrix), texel_position, frame_size, color, depth);
+	}
+
+	void Texture::Draw(const Math::Affine2D& display_matrix, unsigned int color, float depth)
+	{
+		Draw(display_matrix, { 0, 0 }, image_size, color, depth);
+	}
+
+	void Texture::Draw(const Math::Affine2D& display_matrix, Math::ivec2 texel_position, Math::ivec2 frame_size, unsigned int color, float depth)
 	{
 		CS200::IRenderer2D* renderer = Engine::GetTextureManager().GetRenderer2D();
 
@@ -43,8 +54,10 @@ namespace CS230
 		const Math::vec2 texel_coord_bl = { u_left, v_bottom };
 		const Math::vec2 texel_coord_tr = { u_right, v_top };
 
-		Math::vec2 set_bottom_left{ frame_size.x * 0.5, frame_size.y * 0.5 };
-		const auto world_transformation = display_matrix * Math::TranslationMatrix(set_bottom_left) * Math::ScaleMatrix(frame_size);
+		// unit quad scaled to the frame and moved so its bottom left sits on the origin
+		const float			 frame_w			  = static_cast<float>(frame_size.x);
+		const float			 frame_h			  = static_cast<float>(frame_size.y);
+		const Math::Affine2D world_transformation = display_matrix * Math::Affine2D(frame_w, 0.0f, frame_w * 0.5f, 0.0f, frame_h, frame_h * 0.5f);
 
 		renderer->DrawQuad(world_transformation, textureHandle, texel_coord_bl, texel_coord_tr, color, depth);
 	}
@@ -56,6 +69,10 @@ namespace CS230
 
 	Texture::~Texture()
 	{
+		if (textureHandle == 0)
+			return;
+		// waits for frames still drawing with it when the render thread is running
+		const GLContextScope gl_context(Engine::GetRenderThread());
 		GL::DeleteTextures(1, &textureHandle), textureHandle = 0;
 	}
 
@@ -76,6 +93,7 @@ namespace CS230
 	{
 		const auto image = CS200::Image{ file_name, true };
 		image_size		 = image.GetSize();
+		const GLContextScope gl_context(Engine::GetRenderThread());
 		textureHandle	 = OpenGL::CreateTextureFromImage(image, OpenGL::Filtering::NearestPixel, OpenGL::Wrapping::ClampToEdge);
 	}
 
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "Affine2D.h"
 #include "CS200/Image.h"
 #include "Matrix.h"
 #include "OpenGL/Texture.h"
@@ -66,6 +67,7 @@ namespace CS230
 
 		friend class TextureManager;
 		friend class Font;
+		friend class SDFFont;
 
 		/**
 		 * \brief Draw the entire texture with transformation and color tinting
@@ -132,6 +134,15 @@ namespace CS230
 		 */
 		void Draw(const Math::TransformationMatrix& display_matrix, Math::ivec2 texel_position, Math::ivec2 frame_size, unsigned int color = 0xFFFFFFFF, float depth = 0.f);
 
+		/**
+		 * \brief Draw with a float affine transform (Engine/Affine2D.h)
+		 *
+		 * Same results as the TransformationMatrix overloads, which convert and forward here. The frame
+		 * placement is composed in float and handed to IRenderer2D::DrawQuad without going through doubles.
+		 */
+		void Draw(const Math::Affine2D& display_matrix, unsigned int color = 0xFFFFFFFF, float depth = 0.6f);
+		void Draw(const Math::Affine2D& display_matrix, Math::ivec2 texel_position, Math::ivec2 frame_size, unsigned int color = 0xFFFFFFFF, float depth = 0.f);
+
 		/**
 		 * \brief Get the dimensions of the texture in pixels
 		 * \return Vector containing width and height of the texture
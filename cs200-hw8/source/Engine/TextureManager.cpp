@@ -16,6 +16,7 @@
 #include "Logger.h"
 #include "OpenGL/GL.h"
 #include "Path.h"
+#include "RenderThread.h"
 #include "Texture.h"
 #include "Window.h"
 
@@ -29,7 +30,7 @@ namespace CS230
 			// textures[file_name] = new Texture(file_name);
 			textures[file_path] = std::shared_ptr<Texture>(new Texture(file_path));
 
-			Engine::GetLogger().LogEvent("Loading Texture: " + file_path.string());
+			LOG_EVENT("Loading Texture: {}", file_path.string());
 		}
 		return textures[file_path];
 	}
@@ -58,10 +59,10 @@ namespace CS230
 
 	void TextureManager::Unload()
 	{
-		for (std::pair<std::filesystem::path, std::shared_ptr<Texture>> texture : textures)
+		for (const auto& texture : textures)
 		{
 			// delete texture.second;
-			Engine::GetLogger().LogEvent("Unload Texture: " + texture.first.string());
+			LOG_EVENT("Unload Texture: {}", texture.first.string());
 		}
 		textures.clear();
 	}
@@ -70,9 +71,21 @@ namespace CS230
 	{
 		// auto& renderer_2d = Engine::GetRenderer2D();
 		auto& render_info = get_render_info();
+		// with the render thread running the GL work below needs the context, and while a frame is being recorded
+		// its scene stays open in the command list, the texture is drawn right away through the real renderer
+		render_info.Recording	 = recording_renderer != nullptr;
+		render_info.HoldsContext = Engine::GetRenderThread().IsRunning();
+		if (render_info.HoldsContext)
+		{
+			Engine::GetRenderThread().Acquire();
+		}
+		render_info.Active = true;
 		//  * - Ends current 2D renderer scene to ensure clean state transition
         CS200::IRenderer2D* renderer_2d = GetRenderer2D();
-		renderer_2d->EndScene();
+		if (!render_info.Recording)
+		{
+			renderer_2d->EndScene();
+		}
 
 		//  * - Creates OpenGL framebuffer with color attachment of specified dimensions
 		render_info.Size   = { width, height };
@@ -109,10 +122,18 @@ namespace CS230
 		//  * - Restores original clear color values from saved state
 		GL::ClearColor(render_info.ClearColor[0], render_info.ClearColor[1], render_info.ClearColor[2], render_info.ClearColor[3]);
 		//  * - Begins new 2D renderer scene with screen-appropriate coordinate system
-		renderer_2d->BeginScene(CS200::build_ndc_matrix(Engine::GetWindow().GetSize()));
+		if (!render_info.Recording)
+		{
+			renderer_2d->BeginScene(CS200::build_ndc_matrix(Engine::GetWindow().GetSize()));
+		}
 		//  * - Deletes temporary framebuffer to free GPU resources
 		auto framebuffer_to_delete = render_info.Target.Framebuffer;
 		GL::DeleteFramebuffers(1, &framebuffer_to_delete);
+		render_info.Active = false;
+		if (render_info.HoldsContext)
+		{
+			Engine::GetRenderThread().Release();
+		}
 
 
 		//          * Texture Creation:
@@ -131,6 +152,8 @@ namespace CS230
 		if (current_renderer_type == type)
 			return; // Already using this renderer
 
+		const GLContextScope gl_context(Engine::GetRenderThread());
+
 		// Shutdown current renderer
 		if (renderer2D)
 		{
@@ -161,9 +184,18 @@ namespace CS230
 
 	CS200::IRenderer2D* TextureManager::GetRenderer2D()
 	{
+		if (recording_renderer != nullptr && !get_render_info().Active)
+		{
+			return recording_renderer;
+		}
 		return renderer2D.get();
 	}
 
+	void TextureManager::SetRecordingRenderer(CS200::IRenderer2D* renderer)
+	{
+		recording_renderer = renderer;
+	}
+
 	void TextureManager::Shutdown()
 	{
         renderer2D->Shutdown();
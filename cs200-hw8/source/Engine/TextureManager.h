@@ -35,12 +35,16 @@ namespace CS230
 		void							SwitchRenderer(RendererType type);
 		RendererType					GetCurrentRendererType() const;
 		static CS200::IRenderer2D*		GetRenderer2D();
+		// while set, GetRenderer2D() returns this renderer instead (the Engine's recorded frames); render texture mode
+		// still draws straight through the real one since its result is needed right away
+		static void						SetRecordingRenderer(CS200::IRenderer2D* renderer);
 		void							Shutdown();
 
 
 	private:
 		RendererType									  current_renderer_type = RendererType::Batch;
 		inline static std::unique_ptr<CS200::IRenderer2D> renderer2D{};
+		inline static CS200::IRenderer2D*				  recording_renderer = nullptr;
 
 		std::map<std::filesystem::path, std::shared_ptr<Texture>> textures;
 
@@ -51,6 +55,9 @@ namespace CS230
 			Math::ivec2					 Size{};
 			std::array<GLfloat, 4>		 ClearColor{};
 			std::array<GLint, 4>		 Viewport{};
+			bool						 Active		  = false;
+			bool						 Recording	  = false; // started while a frame was being recorded
+			bool						 HoldsContext = false; // took the GL context from the render thread
 		};
 
 		// inline static RenderInfo render_info{};
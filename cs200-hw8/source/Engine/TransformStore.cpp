@@ -0,0 +1,240 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  TransformStore.cpp
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+#include "TransformStore.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define TRANSFORM_STORE_SSE
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define TRANSFORM_STORE_NEON
+#endif
+
+namespace CS230
+{
+    TransformStore::Id TransformStore::Create(Math::vec2 position, double rotation, Math::vec2 scale)
+    {
+        assert(!parallel_phase);
+        Id id;
+        if (!free_ids.empty())
+        {
+            id = free_ids.back();
+            free_ids.pop_back();
+        }
+        else
+        {
+            id = static_cast<Id>(px.size());
+            // grow a whole block at a time so the kernel never reads past the end
+            if (id % BlockSize == 0)
+            {
+                const size_t new_size = px.size() + BlockSize;
+                for (auto* array : { &px, &py, &sx, &sy, &cos_r, &sin_r, &m00, &m01, &m02, &m10, &m11, &m12, &prev00, &prev01, &prev02, &prev10, &prev11, &prev12 })
+                {
+                    array->resize(new_size, 0.f);
+                }
+                dirty_blocks.push_back(0);
+                moved_blocks.push_back(0);
+                fresh.resize(new_size, 0);
+                // the padding entries of the new block are free for later Creates
+                for (Id pad = static_cast<Id>(new_size - 1); pad > id; --pad)
+                {
+                    free_ids.push_back(pad);
+                }
+            }
+        }
+        SetPosition(id, position);
+        SetRotation(id, rotation);
+        SetScale(id, scale);
+        ResetInterpolation(id);
+        return id;
+    }
+
+    void TransformStore::Release(Id id)
+    {
+        assert(!parallel_phase);
+        if (id == InvalidId)
+        {
+            return;
+        }
+        sx[id] = sy[id] = 0.f;
+        mark_dirty(id);
+        free_ids.push_back(id);
+    }
+
+    void TransformStore::SetPosition(Id id, Math::vec2 position)
+    {
+        px[id] = static_cast<float>(position.x);
+        py[id] = static_cast<float>(position.y);
+        mark_dirty(id);
+    }
+
+    void TransformStore::SetRotation(Id id, double rotation)
+    {
+        // trig stays out of the per-frame kernel, it only runs when the rotation actually changes
+        cos_r[id] = static_cast<float>(std::cos(rotation));
+        sin_r[id] = static_cast<float>(std::sin(rotation));
+        mark_dirty(id);
+    }
+
+    void TransformStore::SetScale(Id id, Math::vec2 scale)
+    {
+        sx[id] = static_cast<float>(scale.x);
+        sy[id] = static_cast<float>(scale.y);
+        mark_dirty(id);
+    }
+
+    void TransformStore::Flush()
+    {
+        assert(!parallel_phase);
+        const size_t block_count = dirty_blocks.size();
+        size_t       block       = 0;
+        while (block < block_count)
+        {
+            if (dirty_blocks[block] == 0)
+            {
+                ++block;
+                continue;
+            }
+            // run of consecutive dirty blocks goes through the kernel in one call
+            size_t run_end = block + 1;
+            while (run_end < block_count && dirty_blocks[run_end] != 0)
+            {
+                ++run_end;
+            }
+            compute_blocks(block, run_end - block);
+            block = run_end;
+        }
+    }
+
+    Math::TransformationMatrix TransformStore::GetMatrix(Id id) const
+    {
+        return GetAffine(id).ToMatrix();
+    }
+
+    Math::Affine2D TransformStore::GetAffine(Id id) const
+    {
+        if (is_dirty(id))
+        {
+            // same math as the kernel, only this entry's inputs are read
+            return { cos_r[id] * sx[id], -sin_r[id] * sy[id], px[id], sin_r[id] * sx[id], cos_r[id] * sy[id], py[id] };
+        }
+        return { m00[id], m01[id], m02[id], m10[id], m11[id], m12[id] };
+    }
+
+    Math::vec2 TransformStore::TransformPoint(Id id, Math::vec2 point) const
+    {
+        return GetAffine(id) * point;
+    }
+
+    void TransformStore::SaveTick()
+    {
+        assert(!parallel_phase);
+        Flush();
+        // a block nobody moved since the last tick already has prev == current
+        for (size_t block = 0; block < moved_blocks.size(); ++block)
+        {
+            if (moved_blocks[block] == 0)
+            {
+                continue;
+            }
+            const auto begin = static_cast<std::ptrdiff_t>(block * BlockSize);
+            for (auto [from, to] : { std::pair{ &m00, &prev00 }, std::pair{ &m01, &prev01 }, std::pair{ &m02, &prev02 }, std::pair{ &m10, &prev10 },
+                                     std::pair{ &m11, &prev11 }, std::pair{ &m12, &prev12 } })
+            {
+                std::copy_n(from->begin() + begin, BlockSize, to->begin() + begin);
+            }
+            moved_blocks[block] = 0;
+        }
+        std::fill(fresh.begin(), fresh.end(), uint8_t{ 0 });
+    }
+
+    Math::TransformationMatrix TransformStore::GetInterpolatedMatrix(Id id, double alpha) const
+    {
+        return GetInterpolatedAffine(id, alpha).ToMatrix();
+    }
+
+    Math::Affine2D TransformStore::GetInterpolatedAffine(Id id, double alpha) const
+    {
+        Math::Affine2D affine = GetAffine(id);
+        if (fresh[id] != 0 || alpha >= 1.0)
+        {
+            return affine;
+        }
+        // lerping the affine entries is exact for translation, rotation only turns a tick's worth so the
+        // slight shrink halfway through a turn does not show
+        const float t    = static_cast<float>(std::max(alpha, 0.0));
+        const auto  lerp = [t](float from, float to) { return from + (to - from) * t; };
+        affine[0][0]     = lerp(prev00[id], affine[0][0]);
+        affine[0][1]     = lerp(prev01[id], affine[0][1]);
+        affine[0][2]     = lerp(prev02[id], affine[0][2]);
+        affine[1][0]     = lerp(prev10[id], affine[1][0]);
+        affine[1][1]     = lerp(prev11[id], affine[1][1]);
+        affine[1][2]     = lerp(prev12[id], affine[1][2]);
+        return affine;
+    }
+
+    void TransformStore::compute_blocks(size_t first_block, size_t block_count)
+    {
+        const size_t begin = first_block * BlockSize;
+        const size_t end   = begin + block_count * BlockSize;
+
+#if defined(TRANSFORM_STORE_SSE)
+        const __m128 zero = _mm_setzero_ps();
+        for (size_t i = begin; i < end; i += BlockSize)
+        {
+            const __m128 c  = _mm_loadu_ps(&cos_r[i]);
+            const __m128 s  = _mm_loadu_ps(&sin_r[i]);
+            const __m128 vx = _mm_loadu_ps(&sx[i]);
+            const __m128 vy = _mm_loadu_ps(&sy[i]);
+            _mm_storeu_ps(&m00[i], _mm_mul_ps(c, vx));
+            _mm_storeu_ps(&m01[i], _mm_sub_ps(zero, _mm_mul_ps(s, vy)));
+            _mm_storeu_ps(&m02[i], _mm_loadu_ps(&px[i]));
+            _mm_storeu_ps(&m10[i], _mm_mul_ps(s, vx));
+            _mm_storeu_ps(&m11[i], _mm_mul_ps(c, vy));
+            _mm_storeu_ps(&m12[i], _mm_loadu_ps(&py[i]));
+        }
+#elif defined(TRANSFORM_STORE_NEON)
+        for (size_t i = begin; i < end; i += BlockSize)
+        {
+            const float32x4_t c  = vld1q_f32(&cos_r[i]);
+            const float32x4_t s  = vld1q_f32(&sin_r[i]);
+            const float32x4_t vx = vld1q_f32(&sx[i]);
+            const float32x4_t vy = vld1q_f32(&sy[i]);
+            vst1q_f32(&m00[i], vmulq_f32(c, vx));
+            vst1q_f32(&m01[i], vnegq_f32(vmulq_f32(s, vy)));
+            vst1q_f32(&m02[i], vld1q_f32(&px[i]));
+            vst1q_f32(&m10[i], vmulq_f32(s, vx));
+            vst1q_f32(&m11[i], vmulq_f32(c, vy));
+            vst1q_f32(&m12[i], vld1q_f32(&py[i]));
+        }
+#else
+        for (size_t i = begin; i < end; ++i)
+        {
+            m00[i] = cos_r[i] * sx[i];
+            m01[i] = -sin_r[i] * sy[i];
+            m02[i] = px[i];
+            m10[i] = sin_r[i] * sx[i];
+            m11[i] = cos_r[i] * sy[i];
+            m12[i] = py[i];
+        }
+#endif
+        for (size_t block = first_block; block < first_block + block_count; ++block)
+        {
+            dirty_blocks[block] = 0;
+            moved_blocks[block] = 1;
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*
+Copyright (C) 2023 DigiPen Institute of Technology
+Reproduction or distribution of this file or its contents without
+prior written consent is prohibited
+File Name:  TransformStore.h
+Project:    CS230 Engine
+Author:     Taekyung Ho
+Created:    October 19, 2026
+*/
+
+#pragma once
+#include "Affine2D.h"
+#include "Matrix.h"
+#include "Vec2.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace CS230
+{
+    // Structure-of-arrays storage for every GameObject transform.
+    // Translation/rotation/scale live in float arrays, sin/cos are cached when the rotation changes,
+    // and Flush() rebuilds the 2x3 affine of every dirty 4-wide block in one SIMD pass:
+    //     | cos*sx  -sin*sy  px |
+    //     | sin*sx   cos*sy  py |
+    //
+    // Threading: Create, Release, Flush and SaveTick are serial. The setters and getters may run on job
+    // threads as long as every thread only touches its own objects' entries; neighbours in the same block
+    // only share the atomic dirty flag. The getters never write, an entry whose block is still dirty is
+    // computed from its own inputs on the fly.
+    class TransformStore
+    {
+    public:
+        using Id = uint32_t;
+        static constexpr Id     InvalidId = std::numeric_limits<Id>::max();
+        static constexpr size_t BlockSize = 4;
+
+        Id   Create(Math::vec2 position, double rotation, Math::vec2 scale);
+        void Release(Id id);
+
+        void SetPosition(Id id, Math::vec2 position);
+        void SetRotation(Id id, double rotation);
+        void SetScale(Id id, Math::vec2 scale);
+
+        // rebuild every dirty affine, serial; GameObjectManager runs it before and after the parallel update
+        void Flush();
+
+        // brackets GameObjectManager's parallel update, the serial calls assert they are not inside one
+        void BeginParallelPhase() { parallel_phase = true; }
+        void EndParallelPhase() { parallel_phase = false; }
+
+        Math::TransformationMatrix GetMatrix(Id id) const;
+        Math::Affine2D             GetAffine(Id id) const;
+        Math::vec2                 TransformPoint(Id id, Math::vec2 point) const;
+
+        // render interpolation between fixed simulation ticks: SaveTick() runs before every tick and keeps the
+        // affines the tick starts from, GetInterpolatedMatrix blends from those to the current ones
+        void                       SaveTick();
+        Math::TransformationMatrix GetInterpolatedMatrix(Id id, double alpha) const;
+        Math::Affine2D             GetInterpolatedAffine(Id id, double alpha) const;
+        // the entry is drawn at its current transform until the next tick, for teleports and spawns
+        void ResetInterpolation(Id id) { fresh[id] = 1; }
+
+        size_t Count() const { return px.size() - free_ids.size(); }
+
+    private:
+        // atomic so objects updated on different job threads can share a block
+        void mark_dirty(Id id) { std::atomic_ref<uint8_t>(dirty_blocks[id / BlockSize]).store(1, std::memory_order_relaxed); }
+        bool is_dirty(Id id) const
+        {
+            return std::atomic_ref<uint8_t>(const_cast<uint8_t&>(dirty_blocks[id / BlockSize])).load(std::memory_order_relaxed) != 0;
+        }
+        void compute_blocks(size_t first_block, size_t block_count);
+
+        // inputs
+        std::vector<float> px, py, sx, sy, cos_r, sin_r;
+        // outputs, row major 2x3
+        std::vector<float> m00, m01, m02, m10, m11, m12;
+        // affines at the start of the last tick, SaveTick only copies the blocks recomputed since
+        std::vector<float>   prev00, prev01, prev02, prev10, prev11, prev12;
+        std::vector<uint8_t> fresh;
+
+        std::vector<uint8_t> dirty_blocks;
+        std::vector<uint8_t> moved_blocks; // recomputed since the last SaveTick
+        std::vector<Id>      free_ids;
+        bool                 parallel_phase = false;
+    };
+}
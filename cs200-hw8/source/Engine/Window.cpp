@@ -26,7 +26,7 @@ namespace
         // // https://wiki.libsdl.org/SDL2/SDL_GL_SetAttribute
         if (const auto success = SDL_GL_SetAttribute(attr, value); success != 0)
         {
-            Engine::GetLogger().LogError(std::string{ "Failed to Set GL Attribute: " } + SDL_GetError());
+            LOG_ERROR("Failed to Set GL Attribute: {}", SDL_GetError());
         }
     }
 }
@@ -88,12 +88,7 @@ namespace CS230
         }
 
         // Configure VSync
-        constexpr int ADAPTIVE_VSYNC = -1;
-        constexpr int VSYNC          = 1;
-        if (const auto result = SDL_GL_SetSwapInterval(ADAPTIVE_VSYNC); result != 0)
-        {
-            SDL_GL_SetSwapInterval(VSYNC);
-        }
+        SetVSync(VSync::Adaptive);
 
         // Initialize our rendering abstraction layer
         CS200::RenderingAPI::Init();
@@ -118,9 +113,17 @@ namespace CS230
 
     void Window::Update()
     {
-        SDL_GL_SwapWindow(sdl_window);
+        SwapBuffers();
+        PollEvents();
+    }
 
+    void Window::SwapBuffers()
+    {
+        SDL_GL_SwapWindow(sdl_window);
+    }
 
+    void Window::PollEvents()
+    {
         SDL_Event event{ 0 };
         while (SDL_PollEvent(&event) != 0)
         {
@@ -132,7 +135,11 @@ namespace CS230
                 case SDL_WINDOWEVENT_RESIZED: window_size = { event.window.data1, event.window.data2 }; break;
                 case SDL_WINDOWEVENT_SIZE_CHANGED:
                     SDL_GL_GetDrawableSize(sdl_window, &window_size.x, &window_size.y);
-                    GL::Viewport(0, 0, window_size.x, window_size.y);
+                    // with the render thread running the context is not here, the engine sets the viewport every frame anyway
+                    if (SDL_GL_GetCurrentContext() == gl_context)
+                    {
+                        GL::Viewport(0, 0, window_size.x, window_size.y);
+                    }
                     break;
                     break;
                 default: break;
@@ -174,6 +181,33 @@ namespace CS230
         return gl_context;
     }
 
+    Window::VSync Window::SetVSync(VSync mode)
+    {
+        constexpr int ADAPTIVE_VSYNC = -1;
+        constexpr int VSYNC          = 1;
+        constexpr int NO_VSYNC       = 0;
+        if (mode == VSync::Adaptive && SDL_GL_SetSwapInterval(ADAPTIVE_VSYNC) != 0)
+        {
+            mode = VSync::On;
+        }
+        if (mode != VSync::Adaptive)
+        {
+            SDL_GL_SetSwapInterval(mode == VSync::On ? VSYNC : NO_VSYNC);
+        }
+        vsync = mode;
+        return vsync;
+    }
+
+    int Window::GetRefreshRate() const
+    {
+        SDL_DisplayMode mode{};
+        if (sdl_window == nullptr || SDL_GetWindowDisplayMode(sdl_window, &mode) != 0)
+        {
+            return 0;
+        }
+        return mode.refresh_rate;
+    }
+
     void Window::SetEventCallback(WindowEventCallback callback)
     {
         eventCallback = std::move(callback);
@@ -33,7 +33,9 @@ namespace CS230
 
     public:
         void Start(std::string_view title);
-        void Update();
+        void Update(); // SwapBuffers() then PollEvents()
+        void SwapBuffers();
+        void PollEvents();
         bool IsClosed() const;
 
         [[nodiscard]] Math::ivec2 GetSize() const noexcept
@@ -52,6 +54,24 @@ namespace CS230
         SDL_Window*   GetSDLWindow() const;
         SDL_GLContext GetGLContext() const;
 
+        // Adaptive swaps late frames right away instead of waiting a whole refresh, not every driver has it
+        enum class VSync
+        {
+            Off,
+            On,
+            Adaptive
+        };
+
+        // needs the GL context current, returns the mode that took effect (Adaptive falls back to On)
+        VSync SetVSync(VSync mode);
+        VSync GetVSync() const noexcept
+        {
+            return vsync;
+        }
+
+        // refresh rate of the display the window is on, 0 when SDL does not know it
+        int GetRefreshRate() const;
+
         using WindowEventCallback = std::function<void(const SDL_Event&)>;
         void SetEventCallback(WindowEventCallback callback);
 
@@ -74,6 +94,7 @@ namespace CS230
         gsl::owner<SDL_Window*>   sdl_window = nullptr;
         gsl::owner<SDL_GLContext> gl_context = nullptr;
         bool                      closed     = false;
+        VSync                     vsync      = VSync::Off;
         // Math::ivec2               size       = { 800, 600 };
 
         WindowEventCallback eventCallback;
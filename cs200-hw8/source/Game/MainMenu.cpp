@@ -32,11 +32,22 @@ namespace
 	const double TITLE_Y_RATIO_FROM_BOTTOM = 0.8;
 	const double TITLE_SCALE_VAL		   = 1.5;
 
+	// --- Title text, the Simple font's distance field with an outline instead of the Outlined bitmap font ---
+	const std::string		  TITLE_TEXT = "CS200 HW8";
+	const CS230::SDFTextStyle TITLE_STYLE{ MainMenu::title_color, CS200::BLACK, 0.5, 0.0 };
+
 	const double MENU_CENTER_X_RATIO	 = 0.5;
 	const double MENU_WIDTH_RATIO		 = 0.4;
 	const double MENU_ITEM_HEIGHT_RATIO	 = 0.05;
 	const double MENU_ITEM_SPACING_RATIO = 0.03;
 	const double MENU_START_Y_RATIO		 = 0.4;
+
+	// --- Spark stream behind the selected option ---
+	const size_t SPARK_CAPACITY	 = 512;
+	const double SPARK_LIFE		 = 0.8;
+	const double SPARK_SIZE		 = 12.0;
+	const double SPARK_INTERVAL	 = 1.0 / 60.0; // one emit per interval, independent of the frame rate
+	const size_t SPARKS_PER_EMIT = 2;
 }
 
 MainMenu::MainMenu() : current_option(Option::DemoDepthPost)
@@ -95,15 +106,25 @@ void MainMenu::Load()
 	menu_start_pos_bl	   = Math::vec2{ text_x, item_bottom_y_from_bottom };
 	menu_item_size		   = Math::vec2{ text_width, text_height };
 	menu_item_total_height = text_height + (window_size.y * MENU_ITEM_SPACING_RATIO);
+
+	auto& text_manager				   = Engine::GetTextManager();
+	option_runs[Option::DemoDepthPost] = text_manager.LayoutText("Demo Depth Post", Fonts::Outlined);
+	option_runs[Option::Exit]		   = text_manager.LayoutText("Exit", Fonts::Outlined);
+
+	auto* sparks = new CS230::ParticleEmitter("Assets/images/DemoDepthPost/duck.png", SPARK_CAPACITY, SPARK_LIFE, SPARK_SIZE);
+	sparks->SetGravity({ 0.0, -300.0 });
+	AddGSComponent(sparks);
 }
 
-void MainMenu::Update([[maybe_unused]] double dt)
+void MainMenu::Update(double dt)
 {
 	CS230::Input& input		  = Engine::GetInput();
 	// Math::vec2	  mouse_pos	  = input.GetMousePos();
 	// auto		  window_size = Engine::GetWindow().GetSize();
 	
 	update_colors();
+	emit_sparks(dt);
+	UpdateGSComponents(dt);
 	if (input.KeyJustReleased(CS230::Input::Keys::Up))
 	{
 		int current_index = static_cast<int>(current_option);
@@ -150,6 +171,8 @@ void MainMenu::Update([[maybe_unused]] double dt)
 
 void MainMenu::Unload()
 {
+	option_runs.clear();
+	ClearGSComponents();
 }
 
 void MainMenu::Draw()
@@ -160,7 +183,7 @@ void MainMenu::Draw()
 
 	auto& text_manager = Engine::GetTextManager();
 
-	text_manager.DrawText("CS200 HW8", title_pos, Fonts::Outlined, title_scale, title_color);
+	text_manager.DrawSDFText(TITLE_TEXT, title_pos, Fonts::Simple, title_scale, TITLE_STYLE);
 
 	double current_item_y = 0;
 	int	   i			  = 0;
@@ -168,16 +191,29 @@ void MainMenu::Draw()
 	// Option: demo depth post
 	i			   = static_cast<int>(Option::DemoDepthPost);
 	current_item_y = menu_start_pos_bl.y - (i * menu_item_total_height);
-	text_manager.DrawText("Demo Depth Post", Math::vec2{ menu_start_pos_bl.x, current_item_y }, Fonts::Outlined, { 1.0, 1.0 }, colors[Option::DemoDepthPost]);
+	text_manager.DrawTextRun(*option_runs[Option::DemoDepthPost], Math::vec2{ menu_start_pos_bl.x, current_item_y }, { 1.0, 1.0 }, colors[Option::DemoDepthPost]);
 
 	// Option: exit
 	i			   = static_cast<int>(Option::Exit);
 	current_item_y = menu_start_pos_bl.y - (i * menu_item_total_height);
-	text_manager.DrawText("Exit", Math::vec2{ menu_start_pos_bl.x, current_item_y }, Fonts::Outlined, { 1.0, 1.0 }, colors[Option::Exit]);
+	text_manager.DrawTextRun(*option_runs[Option::Exit], Math::vec2{ menu_start_pos_bl.x, current_item_y }, { 1.0, 1.0 }, colors[Option::Exit]);
+
+	GetGSComponent<CS230::ParticleEmitter>()->Draw(Math::TransformationMatrix());
 
 	renderer_2d->EndScene();
 }
 
+void MainMenu::emit_sparks(double dt)
+{
+	auto*			 sparks = GetGSComponent<CS230::ParticleEmitter>();
+	const int		 i		= static_cast<int>(current_option);
+	const Math::vec2 origin{ menu_start_pos_bl.x, menu_start_pos_bl.y - (i * menu_item_total_height) + menu_item_size.y / 2.0 };
+	for (spark_timer += dt; spark_timer >= SPARK_INTERVAL; spark_timer -= SPARK_INTERVAL)
+	{
+		sparks->Emit(SPARKS_PER_EMIT, origin, { 0.0, 0.0 }, { -150.0, 150.0 }, 1.0, seleted_color);
+	}
+}
+
 gsl::czstring MainMenu::GetName() const
 {
 	return "MainMenu";
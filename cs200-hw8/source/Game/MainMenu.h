@@ -13,10 +13,15 @@ Created:    May 6, 2025
 #include "../Engine/Engine.h"
 #include "../Engine/Font.h"
 #include "../Engine/GameState.h"
+#include "../Engine/ParticleEmitter.h"
+#include "../Engine/TextLayout.h"
 #include "../Engine/Texture.h"
 
 #include "../Engine/Fonts.h"
 
+#include <map>
+#include <memory>
+
 class MainMenu : public CS230::GameState
 {
 public:
@@ -42,6 +47,9 @@ private:
 
 	std::map<Option, CS200::RGBA> colors;
 
+	// laid out once in Load, the menu text never changes; the title is drawn from the distance field atlas instead
+	std::map<Option, std::shared_ptr<const CS230::TextRun>> option_runs;
+
 
 	Math::vec2 title_pos;
 	Math::vec2 title_scale;
@@ -50,7 +58,10 @@ private:
 	Math::vec2 menu_item_size;
 	double	   menu_item_total_height;
 
+	double spark_timer = 0.0; // time owed to the spark stream behind the selected option
+
 	void select_option();
+	void emit_sparks(double dt);
 	void update_colors();
 
 	static constexpr Math::ivec2 default_window_size = { 800, 600 };
@@ -304,6 +304,11 @@ namespace GL
         glCheck(glEnableVertexAttribArray(index));
     }
 
+    void Finish(VOID_SOURCE_LOCATION)
+    {
+        glCheck(glFinish());
+    }
+
     void FrontFace(GLenum mode SOURCE_LOCATION)
     {
         glCheck(glFrontFace(mode));
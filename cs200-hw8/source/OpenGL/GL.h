@@ -72,6 +72,7 @@ namespace GL
     void           DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid* indices SOURCE_LOCATION);
     void           Enable(GLenum cap SOURCE_LOCATION);
     void           EnableVertexAttribArray(GLuint index SOURCE_LOCATION);
+    void           Finish(VOID_SOURCE_LOCATION);
     void           FrontFace(GLenum mode SOURCE_LOCATION);
     void           GenBuffers(GLsizei n, GLuint* buffers SOURCE_LOCATION);
     void           GenTextures(GLsizei n, GLuint* textures SOURCE_LOCATION);
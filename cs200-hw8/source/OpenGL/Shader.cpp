@@ -18,7 +18,7 @@ namespace
     void                                                 print_glsl_text(std::string_view source);
     [[nodiscard]] OpenGL::Handle                         compile_shader_source(GLenum type, std::string_view glsl_text);
     [[nodiscard]] OpenGL::Handle                         compile_shader_file(GLenum type, const std::filesystem::path& file_path);
-    [[nodiscard]] OpenGL::ShaderHandle                   link_shader_program(OpenGL::Handle vertex_handle, OpenGL::Handle fragment_handle);
+    [[nodiscard]] OpenGL::ShaderHandle                   link_shader_program(OpenGL::Handle vertex_handle, OpenGL::Handle fragment_handle, std::span<const char*> feedback_varyings = {});
     [[nodiscard]] std::unordered_map<std::string, GLint> get_uniform_locations(OpenGL::ShaderHandle shader);
 }
 
@@ -44,6 +44,16 @@ namespace OpenGL
         return cs;
     }
 
+    CompiledShader CreateShader(std::filesystem::path vertex_filepath, std::filesystem::path fragment_filepath, std::span<const char*> feedback_varyings)
+    {
+        const auto     vertex_handle   = compile_shader_file(GL_VERTEX_SHADER, vertex_filepath);
+        const auto     fragment_handle = compile_shader_file(GL_FRAGMENT_SHADER, fragment_filepath);
+        CompiledShader cs{};
+        cs.Shader           = link_shader_program(vertex_handle, fragment_handle, feedback_varyings);
+        cs.UniformLocations = get_uniform_locations(cs.Shader);
+        return cs;
+    }
+
     void DestroyShader(CompiledShader& shader) noexcept
     {
         GL::DeleteProgram(shader.Shader);
@@ -62,7 +72,7 @@ namespace OpenGL
         }
         else
         {
-            Engine::GetLogger().LogError("Uniform block '" + std::string(uniform_block_name) + "' not found in shader.");
+            LOG_ERROR("Uniform block '{}' not found in shader.", uniform_block_name);
         }
     }
 }
@@ -77,7 +87,7 @@ namespace
         CountInt           line_number          = 1;
         std::string        line;
         std::ostringstream sout;
-        std::istringstream source_stream(source.data());
+        std::istringstream source_stream{ std::string(source) };
         while (std::getline(source_stream, line))
         {
             sout << std::setw(max_linenumber_width) << std::right << line_number << "| " << line << '\n';
@@ -89,8 +99,10 @@ namespace
     OpenGL::Handle compile_shader_source(GLenum type, std::string_view glsl_text)
     {
         OpenGL::Handle shader = GL::CreateShader(type);
-        GLchar const*  source[]{ glsl_text.data() };
-        GL::ShaderSource(shader, 1, source, nullptr);
+        // the text is a view into a mapped file, an archive or a decode buffer, none of which end in a NUL
+        GLchar const*  source[]{ glsl_text.empty() ? "" : glsl_text.data() };
+        const GLint    length = static_cast<GLint>(glsl_text.size());
+        GL::ShaderSource(shader, 1, source, &length);
         GL::CompileShader(shader);
         GLint is_compiled = 0;
         GL::GetShaderiv(shader, GL_COMPILE_STATUS, &is_compiled);
@@ -112,20 +124,20 @@ namespace
 
     OpenGL::Handle compile_shader_file(GLenum type, const std::filesystem::path& file_path)
     {
-        const auto    shader_file_path = assets::locate_asset(file_path);
-        std::ifstream ifs(shader_file_path, std::ios::in);
-        if (!ifs)
+        assets::AssetData shader_file;
+        try
+        {
+            shader_file = assets::read_asset(file_path);
+        }
+        catch (const std::exception&)
         {
-            Engine::GetLogger().LogError("Cannot open " + file_path.string());
+            LOG_ERROR("Cannot open {}", file_path.string());
             return 0;
         }
-        std::string glsl_text;
-        glsl_text.reserve(gsl::narrow<std::size_t>(std::filesystem::file_size(shader_file_path)));
-        std::copy((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>(), std::back_insert_iterator(glsl_text));
-        return compile_shader_source(type, std::string_view(glsl_text));
+        return compile_shader_source(type, shader_file.text());
     }
 
-    OpenGL::ShaderHandle link_shader_program(OpenGL::Handle vertex_handle, OpenGL::Handle fragment_handle)
+    OpenGL::ShaderHandle link_shader_program(OpenGL::Handle vertex_handle, OpenGL::Handle fragment_handle, std::span<const char*> feedback_varyings)
     {
         OpenGL::ShaderHandle program_handle = GL::CreateProgram();
         if (program_handle == 0)
@@ -136,6 +148,12 @@ namespace
         GL::AttachShader(program_handle, vertex_handle);
         GL::AttachShader(program_handle, fragment_handle);
 
+        if (!feedback_varyings.empty())
+        {
+            // has to happen before linking, the linker assigns the capture layout
+            GL::TransformFeedbackVaryings(program_handle, static_cast<GLsizei>(feedback_varyings.size()), feedback_varyings.data(), GL_INTERLEAVED_ATTRIBS);
+        }
+
         GL::LinkProgram(program_handle);
 
         GL::DeleteShader(vertex_handle);
@@ -9,6 +9,7 @@
 
 #include "Handle.h"
 #include <filesystem>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -130,6 +131,23 @@ namespace OpenGL
      */
     CompiledShader CreateShader(std::string_view vertex_source, std::string_view fragment_source);
 
+    /**
+     * \brief Create shader program whose vertex shader outputs are captured with transform feedback
+     * \param vertex_filepath Path to the vertex shader source file (.vert)
+     * \param fragment_filepath Path to the fragment shader source file (.frag)
+     * \param feedback_varyings Names of the vertex shader outputs to capture, in buffer order
+     * \return Fully compiled shader program with cached uniform locations
+     *
+     * Same as the file-based CreateShader, except that the listed outputs are
+     * registered with GL::TransformFeedbackVaryings before the program is linked.
+     * They are captured in GL_INTERLEAVED_ATTRIBS mode, so one buffer bound to
+     * transform feedback binding 0 receives one tightly packed record per vertex.
+     *
+     * Varyings can only be declared before linking, which is why this is a
+     * separate entry point instead of something applied to an existing program.
+     */
+    CompiledShader CreateShader(std::filesystem::path vertex_filepath, std::filesystem::path fragment_filepath, std::span<const char*> feedback_varyings);
+
     /**
      * \brief Safely destroy shader program and release all associated resources
      * \param shader Compiled shader structure to destroy (will be reset to safe state)
@@ -0,0 +1,290 @@
+/**
+ * \file
+ * \author Taekyung Ho
+ * \date 2025 Fall
+ * \par CS200 Computer Graphics I
+ * \copyright DigiPen Institute of Technology
+ *
+ * Offline converter from the text assets to the binary formats in Engine/BakedAsset.h.
+ *
+ *   asset_baker [--force] [--font image.png]... [--pack out.pak [--compress]] <file or directory>...
+ *
+ * Directories are walked recursively. Every .spt becomes a .sptb, every .anm an .anmb and every
+ * image inside a folder named "fonts" (or passed with --font) a .fntb glyph table plus an .sdff
+ * distance field atlas (Engine/SDFFont.h), written next to the source. Outputs newer than their
+ * source are skipped unless --force is given. The engine keeps reading the text files when no
+ * baked file is present, so baking is an optional build step.
+ *
+ * --pack then writes every file of the inputs (baked ones included) into one AssetArchive, keyed by
+ * the path the game asks for: packing ../Assets stores ../Assets/shaders/shape/shape.vert as
+ * "Assets/shaders/shape/shape.vert". --compress stores entries LZ4 compressed where that pays off;
+ * images and baked files are always stored as is (already compressed / used in place).
+ */
+#include "CS200/Image.h"
+#include "Engine/Animation.h"
+#include "Engine/AssetArchive.h"
+#include "Engine/BakedAsset.h"
+#include "Engine/Font.h"
+#include "Engine/Path.h"
+#include "Engine/SDFFont.h"
+#include "Engine/SpriteDefinition.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stb_image.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	namespace fs = std::filesystem;
+
+	struct Options
+	{
+		bool				  force	   = false;
+		bool				  compress = false;
+		fs::path			  pack;
+		std::vector<fs::path> fonts;
+		std::vector<fs::path> inputs;
+	};
+
+	struct Totals
+	{
+		int baked	= 0;
+		int skipped = 0;
+		int failed	= 0;
+	};
+
+	Math::ivec2 image_size(const std::string& texture_file)
+	{
+		const std::string path	 = assets::locate_asset(texture_file).string();
+		int				  width	 = 0;
+		int				  height = 0;
+		int				  channels;
+		if (stbi_info(path.c_str(), &width, &height, &channels) == 0)
+		{
+			throw std::runtime_error("Failed to read the size of " + texture_file);
+		}
+		return { width, height };
+	}
+
+	enum class Job
+	{
+		Text,		// .spt / .anm
+		FontGlyphs, // font image -> .fntb
+		SDFFont,	// font image -> .sdff
+	};
+
+	std::vector<std::byte> bake(const fs::path& source, Job job)
+	{
+		if (job == Job::FontGlyphs)
+		{
+			const CS200::Image image(source, false);
+			const auto		   rects = CS230::Font::ScanCharRects(image);
+			return CS230::baked::WriteFontGlyphs(rects);
+		}
+		if (job == Job::SDFFont)
+		{
+			return CS230::SDFFont::Bake(CS200::Image(source, false));
+		}
+		if (source.extension() == ".spt")
+		{
+			return CS230::baked::WriteSprite(CS230::SpriteSource::ParseText(source, image_size));
+		}
+		const CS230::AnimationData animation(source);
+		return CS230::baked::WriteAnimation(animation.Frames());
+	}
+
+	// the runtime only compares dates in developer builds, the baker always does
+	bool is_up_to_date(const fs::path& source, const fs::path& target)
+	{
+		std::error_code error;
+		const auto		target_time = fs::last_write_time(target, error);
+		if (error)
+			return false;
+		const auto source_time = fs::last_write_time(source, error);
+		return error || source_time <= target_time;
+	}
+
+	void bake_file(const fs::path& source, Job job, const Options& options, Totals& totals)
+	{
+		const bool	   is_sdf = job == Job::SDFFont;
+		const fs::path target = is_sdf ? CS230::baked::SDFFontPathFor(source) : CS230::baked::BakedPathFor(source);
+		if (!options.force && is_up_to_date(source, target))
+		{
+			++totals.skipped;
+			return;
+		}
+		try
+		{
+			const std::vector<std::byte> bytes = bake(source, job);
+			std::ofstream				 file(target, std::ios::binary | std::ios::trunc);
+			if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+			{
+				throw std::runtime_error("Failed to write " + target.string());
+			}
+			std::cout << source.generic_string() << " -> " << target.filename().generic_string() << " (" << bytes.size() << " bytes)\n";
+			++totals.baked;
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << source.generic_string() << ": " << e.what() << '\n';
+			++totals.failed;
+		}
+	}
+
+	bool is_font_image(const fs::path& path)
+	{
+		const fs::path extension = path.extension();
+		return path.parent_path().filename() == "fonts" && (extension == ".png" || extension == ".jpg" || extension == ".bmp" || extension == ".tga");
+	}
+
+	void bake_font(const fs::path& font_image, const Options& options, Totals& totals)
+	{
+		bake_file(font_image, Job::FontGlyphs, options, totals);
+		bake_file(font_image, Job::SDFFont, options, totals);
+	}
+
+	void bake_path(const fs::path& input, const Options& options, Totals& totals)
+	{
+		if (!fs::is_directory(input))
+		{
+			if (is_font_image(input))
+				bake_font(input, options, totals);
+			else
+				bake_file(input, Job::Text, options, totals);
+			return;
+		}
+		for (const fs::directory_entry& entry : fs::recursive_directory_iterator(input))
+		{
+			const fs::path& path = entry.path();
+			if (!entry.is_regular_file())
+				continue;
+			if (path.extension() == ".spt" || path.extension() == ".anm")
+				bake_file(path, Job::Text, options, totals);
+			else if (is_font_image(path))
+				bake_font(path, options, totals);
+		}
+	}
+
+	std::vector<std::byte> read_file(const fs::path& path)
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+			throw std::runtime_error("Failed to read " + path.string());
+		std::vector<std::byte> bytes(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+		return bytes;
+	}
+
+	bool worth_compressing(const fs::path& path)
+	{
+		const fs::path extension = path.extension();
+		for (const char* stored : { ".png", ".jpg", ".jpeg", ".sptb", ".anmb", ".fntb", ".sdff", ".pak" })
+		{
+			if (extension == stored)
+				return false;
+		}
+		return true;
+	}
+
+	void pack(const Options& options)
+	{
+		std::vector<CS230::AssetArchive::PackEntry> entries;
+		const auto add = [&](const fs::path& file, const fs::path& key)
+		{
+			std::error_code not_there;
+			if (fs::equivalent(file, options.pack, not_there))
+				return; // repacking into the folder being packed
+			entries.push_back({ CS230::AssetArchive::MakeKey(key), read_file(file), options.compress && worth_compressing(file) });
+		};
+		for (const fs::path& input : options.inputs)
+		{
+			if (!fs::is_directory(input))
+			{
+				add(input, input);
+				continue;
+			}
+			fs::path root = input.lexically_normal();
+			if (!root.has_filename())
+				root = root.parent_path();
+			for (const fs::directory_entry& entry : fs::recursive_directory_iterator(root))
+			{
+				if (entry.is_regular_file())
+					add(entry.path(), root.filename() / entry.path().lexically_relative(root));
+			}
+		}
+
+		// same input, same archive: keep the table of contents independent of directory iteration order
+		std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.key < b.key; });
+		const std::vector<std::byte> bytes = CS230::AssetArchive::Build(entries);
+		std::ofstream				 file(options.pack, std::ios::binary | std::ios::trunc);
+		if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+			throw std::runtime_error("Failed to write " + options.pack.string());
+
+		size_t source_bytes = 0;
+		for (const auto& entry : entries)
+			source_bytes += entry.contents.size();
+		std::cout << options.pack.generic_string() << ": " << entries.size() << " files, " << source_bytes << " -> " << bytes.size() << " bytes\n";
+	}
+
+	Options parse_options(int argc, char** argv)
+	{
+		Options options;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+			if (arg == "--force")
+				options.force = true;
+			else if (arg == "--compress")
+				options.compress = true;
+			else if (arg == "--pack" && i + 1 < argc)
+				options.pack = argv[++i];
+			else if (arg == "--font" && i + 1 < argc)
+				options.fonts.emplace_back(argv[++i]);
+			else if (!arg.starts_with("--"))
+				options.inputs.emplace_back(arg);
+			else
+			{
+				options.inputs.clear();
+				options.fonts.clear();
+				break;
+			}
+		}
+		if (options.inputs.empty() && options.fonts.empty())
+		{
+			std::cerr << "usage: asset_baker [--force] [--font image.png]... [--pack out.pak [--compress]] <file or directory>...\n";
+			std::exit(-1);
+		}
+		return options;
+	}
+}
+
+int main(int argc, char** argv)
+try
+{
+	const Options options = parse_options(argc, argv);
+
+	Totals totals;
+	for (const fs::path& font : options.fonts)
+		bake_font(font, options, totals);
+	for (const fs::path& input : options.inputs)
+		bake_path(input, options, totals);
+
+	std::cout << totals.baked << " baked, " << totals.skipped << " up to date, " << totals.failed << " failed\n";
+	if (totals.failed != 0)
+		return -1;
+
+	if (!options.pack.empty())
+		pack(options);
+	return 0;
+}
+catch (const std::exception& e)
+{
+	std::cerr << e.what() << '\n';
+	return -1;
+}
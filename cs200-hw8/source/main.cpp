@@ -10,6 +10,8 @@
 #include "Engine/Window.h"
 #include "Game/Splash.h"
 
+#include <string_view>
+
 namespace
 {
     [[maybe_unused]] int  gWindowWidth  = 400;
@@ -60,9 +62,16 @@ EMSCRIPTEN_BINDINGS(main_window)
 }
 #endif
 
-int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+int main(int argc, char* argv[])
 {
     Engine& engine = Engine::Instance();
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string_view(argv[i]) == "--render-thread")
+        {
+            Engine::SetRenderThreadEnabled(true);
+        }
+    }
     engine.Start("Taekyung Ho CS200 HW8");
     engine.GetGameStateManager().PushState<Splash>();
 